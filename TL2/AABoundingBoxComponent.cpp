@@ -49,13 +49,8 @@ void UAABoundingBoxComponent::Render(URenderer* Renderer, const FMatrix& ViewMat
 {
   //  if (USelectionManager::GetInstance().GetSelectedActor() == GetOwner())
     //{
-        TArray<FVector> Start;
-        TArray<FVector> End;
-        TArray<FVector4> Color;
-
         Bound = GetWorldBoundFromCube();
-        CreateLineData(Bound.Min, Bound.Max, Start, End, Color);
-        Renderer->AddLines(Start, End, Color);
+        Renderer->AddBoxes(std::span<const FBound>(&Bound, 1), LineColor);
    // }
 }
 
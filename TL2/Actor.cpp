@@ -7,6 +7,9 @@
 #include "MeshComponent.h"
 #include "TextRenderComponent.h"
 #include "MovementComponent.h"
+#include "LightComponent.h"
+#include "World.h"
+#include "Level.h"
 
 AActor::AActor()
 {
@@ -202,6 +205,22 @@ UWorld* AActor::GetWorld() const
     return World;
 }
 
+void AActor::SetActorHiddenInGame(bool bNewHidden)
+{
+    if (bHiddenInGame == bNewHidden)
+    {
+        return;
+    }
+
+    bHiddenInGame = bNewHidden;
+
+    // 숨김 액터는 BVH에서 제외되므로 구조가 바뀜
+    if (World)
+    {
+        World->MarkBVHDirty();
+    }
+}
+
 // ParentComponent 하위에 새로운 컴포넌트를 추가합니다
 USceneComponent* AActor::CreateAndAttachComponent(USceneComponent* ParentComponent, UClass* ComponentClass)
 {
@@ -227,6 +246,18 @@ USceneComponent* AActor::CreateAndAttachComponent(USceneComponent* ParentCompone
 
             NewComponent->SetupAttachment(ParentComponent, EAttachmentRule::KeepRelative);
             NewComponent->SetOwner(this);
+
+            // 월드에 이미 있는 액터에 라이트를 붙이면 바로 등록
+            if (ULightComponent* LightComponent = Cast<ULightComponent>(NewComponent); LightComponent && World)
+            {
+                World->GetLightRegistry().Register(LightComponent);
+            }
+
+            // TLAS 컴포넌트 항목과 프록시 피킹 대상 목록을 다시 모으도록 BVH 재빌드 예약
+            if (World)
+            {
+                World->MarkBVHDirty();
+            }
         }
     }
 
@@ -320,6 +351,16 @@ bool AActor::DeleteActorComponent(UActorComponent* ComponentToDelete)
     return true;
 }
 
+void AActor::SetName(const FString& InName)
+{
+    Name = InName;
+
+    if (World && World->GetLevel())
+    {
+        World->GetLevel()->NotifyActorRenamed(this);
+    }
+}
+
 UObject* AActor::Duplicate()
 {
     return nullptr;
@@ -328,6 +369,8 @@ UObject* AActor::Duplicate()
 UObject* AActor::Duplicate(FObjectDuplicationParameters Parameters)
 {
     auto DupObject = static_cast<AActor*>(Super_t::Duplicate(Parameters));
+    DupObject->bIsSelected = false;
+    DupObject->TransformVersion = GenerateVersion();	// 원본과 다른 피킹 캐시 키
 
     /** @note 기본 생성자가 생성하는 컴포넌트를 맵에 업데이트 */
     if (RootComponent)
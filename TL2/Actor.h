@@ -57,13 +57,22 @@ public:
     void SetIsPicked(bool picked) { bIsPicked = picked; }
     bool GetIsPicked() { return bIsPicked; }
 
+    // 이 액터의 컴포넌트 트랜스폼이 실제로 바뀔 때마다 증가 (피킹 캐시 키)
+    uint64 GetTransformVersion() const { return TransformVersion; }
+    void BumpTransformVersion() { TransformVersion = GenerateVersion(); }
+
+    // USelectionManager가 관리하는 선택 비트 (렌더 루프에서 조회 없이 하이라이트 판정)
+    void SetIsSelected(bool bInSelected) { bIsSelected = bInSelected; }
+    bool IsSelected() const { return bIsSelected; }
+
     
 
     //-----------------------------
     //----------Getter------------
     const TSet<UActorComponent*>& GetComponents() const;
 
-    void SetName(const FString& InName) { Name = InName; }
+    // 레벨에 속해 있으면 ULevel에 이름 변경을 알림 (아웃라이너 갱신)
+    void SetName(const FString& InName);
     const FName& GetName() const { return Name; }
 
     template<typename T>
@@ -108,7 +117,7 @@ public:
 public:
 
     // Visibility properties
-    void SetActorHiddenInGame(bool bNewHidden) { bHiddenInGame = bNewHidden; }
+    void SetActorHiddenInGame(bool bNewHidden);
     bool GetActorHiddenInGame() const { return bHiddenInGame; }
     bool IsActorVisible() const { return !bHiddenInGame; }
     
@@ -146,6 +155,9 @@ public:
 protected:
     // [PIE] 값 복사
     bool bIsPicked = false;
+    // 선택 상태는 복제하지 않음 (Duplicate에서 초기화)
+    bool bIsSelected = false;
+    uint64 TransformVersion = GenerateVersion();
     bool bCanEverTick = true;
     bool bHiddenInGame = false;
     bool bTickInEditor = false;
@@ -0,0 +1,277 @@
+﻿#include "pch.h"
+#include "ActorSearchIndex.h"
+#include "Actor.h"
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+	// 빈 슬롯이 이보다 많고 살아있는 슬롯 수도 넘으면 재구성
+	constexpr int32 MinDeadSlotsForCompaction = 1024;
+
+	inline uint32 MakeTrigram(const char* Chars)
+	{
+		return (static_cast<uint32>(static_cast<uint8>(Chars[0])) << 16)
+			| (static_cast<uint32>(static_cast<uint8>(Chars[1])) << 8)
+			| static_cast<uint32>(static_cast<uint8>(Chars[2]));
+	}
+
+	inline char ToLowerChar(char C)
+	{
+		return static_cast<char>(std::tolower(static_cast<unsigned char>(C)));
+	}
+
+	inline bool ContainsSubstring(const char* Name, uint32 NameLength, const char* Query, uint32 QueryLength)
+	{
+		if (QueryLength == 0)
+			return true;
+		if (QueryLength > NameLength)
+			return false;
+		return std::search(Name, Name + NameLength, Query, Query + QueryLength) != Name + NameLength;
+	}
+}
+
+void FActorSearchIndex::Add(AActor* Actor)
+{
+	if (!Actor || SlotByActor.Find(Actor))
+		return;
+
+	const UClass* Class = Actor->GetClass();
+	TArray<AActor*>& ClassActors = ActorsByClass[Class];
+	ClassActors.Add(Actor);
+
+	const int32 Slot = AddSlot(Actor, Class, Actor->GetName().ToString(), ClassActors.Num() - 1);
+	SlotByActor.Add(Actor, Slot);
+}
+
+void FActorSearchIndex::Remove(AActor* Actor)
+{
+	const int32* Found = SlotByActor.Find(Actor);
+	if (!Found)
+		return;
+
+	const int32 Slot = *Found;
+	SlotByActor.Remove(Actor);
+
+	// 클래스 목록에서 swap-remove 후 옮겨진 액터의 위치 갱신
+	const FEntry& Entry = Entries[Slot];
+	if (TArray<AActor*>* ClassActors = ActorsByClass.Find(Entry.Class))
+	{
+		AActor* Moved = ClassActors->back();
+		(*ClassActors)[Entry.ClassIndex] = Moved;
+		ClassActors->pop_back();
+		if (Moved != Actor)
+		{
+			Entries[*SlotByActor.Find(Moved)].ClassIndex = Entry.ClassIndex;
+		}
+		if (ClassActors->IsEmpty())
+		{
+			ActorsByClass.Remove(Entry.Class);
+		}
+	}
+
+	RemoveSlot(Slot);
+	CompactIfNeeded();
+}
+
+void FActorSearchIndex::Rename(AActor* Actor)
+{
+	int32* Found = SlotByActor.Find(Actor);
+	if (!Found)
+		return;
+
+	// 기존 슬롯은 비우고 새 이름으로 슬롯을 새로 만듦 (클래스 목록 위치는 그대로)
+	const FEntry OldEntry = Entries[*Found];
+	RemoveSlot(*Found);
+	*Found = AddSlot(Actor, OldEntry.Class, Actor->GetName().ToString(), OldEntry.ClassIndex);
+
+	CompactIfNeeded();
+}
+
+void FActorSearchIndex::Clear()
+{
+	Entries.clear();
+	NameChars.clear();
+	SlotByActor.clear();
+	Postings.clear();
+	ActorsByClass.clear();
+	DeadSlotCount = 0;
+}
+
+int32 FActorSearchIndex::FindByName(const FString& Query, TArray<AActor*>& OutActors, const UClass* ClassFilter, int32 MaxResults) const
+{
+	FString LowerQuery = Query;
+	for (char& C : LowerQuery)
+	{
+		C = ToLowerChar(C);
+	}
+	const char* QueryChars = LowerQuery.c_str();
+	const uint32 QueryLength = static_cast<uint32>(LowerQuery.size());
+	const int32 Limit = MaxResults < 0 ? static_cast<int32>(Entries.Num()) : MaxResults;
+
+	int32 NumFound = 0;
+
+	// 3글자 미만은 트라이그램을 만들 수 없으므로 연속 이름 버퍼를 직접 훑음
+	if (QueryLength < 3)
+	{
+		for (const FEntry& Entry : Entries)
+		{
+			if (NumFound >= Limit)
+				break;
+			if (PassesFilter(Entry, QueryChars, QueryLength, ClassFilter))
+			{
+				OutActors.Add(Entry.Actor);
+				++NumFound;
+			}
+		}
+		return NumFound;
+	}
+
+	// 쿼리의 트라이그램별 슬롯 목록 (하나라도 없으면 일치하는 이름이 없음)
+	TArray<const TArray<int32>*> Lists;
+	Lists.Reserve(QueryLength - 2);
+	for (uint32 i = 0; i + 3 <= QueryLength; ++i)
+	{
+		const TArray<int32>* List = Postings.Find(MakeTrigram(QueryChars + i));
+		if (!List)
+			return 0;
+		if (std::find(Lists.begin(), Lists.end(), List) == Lists.end())
+		{
+			Lists.Add(List);
+		}
+	}
+	std::sort(Lists.begin(), Lists.end(), [](const TArray<int32>* A, const TArray<int32>* B) { return A->Num() < B->Num(); });
+
+	// 가장 짧은 목록의 슬롯마다 나머지 목록에서 이진 탐색 (커서는 앞으로만 이동)
+	TArray<TArray<int32>::const_iterator> Cursors;
+	Cursors.Reserve(Lists.Num());
+	for (const TArray<int32>* List : Lists)
+	{
+		Cursors.Add(List->begin());
+	}
+
+	for (int32 Slot : *Lists[0])
+	{
+		if (NumFound >= Limit)
+			break;
+
+		bool bInAll = true;
+		for (int32 ListIndex = 1; ListIndex < Lists.Num(); ++ListIndex)
+		{
+			TArray<int32>::const_iterator& Cursor = Cursors[ListIndex];
+			Cursor = std::lower_bound(Cursor, Lists[ListIndex]->end(), Slot);
+			if (Cursor == Lists[ListIndex]->end())
+				return NumFound; // 더 큰 슬롯은 남아있지 않음
+			if (*Cursor != Slot)
+			{
+				bInAll = false;
+				break;
+			}
+		}
+
+		// 트라이그램이 모두 있어도 연속 부분 문자열이 아닐 수 있으므로 실제 이름으로 확인
+		if (bInAll && PassesFilter(Entries[Slot], QueryChars, QueryLength, ClassFilter))
+		{
+			OutActors.Add(Entries[Slot].Actor);
+			++NumFound;
+		}
+	}
+
+	return NumFound;
+}
+
+void FActorSearchIndex::GetActorsOfClass(const UClass* Class, TArray<AActor*>& OutActors, bool bIncludeSubclasses) const
+{
+	if (!Class)
+		return;
+
+	if (!bIncludeSubclasses)
+	{
+		if (const TArray<AActor*>* ClassActors = ActorsByClass.Find(Class))
+		{
+			OutActors.insert(OutActors.end(), ClassActors->begin(), ClassActors->end());
+		}
+		return;
+	}
+
+	// 클래스 종류는 액터 수보다 훨씬 적으므로 버킷 단위로 상속 관계 확인
+	for (const auto& Pair : ActorsByClass)
+	{
+		if (Pair.first && Pair.first->IsChildOf(Class))
+		{
+			OutActors.insert(OutActors.end(), Pair.second.begin(), Pair.second.end());
+		}
+	}
+}
+
+int32 FActorSearchIndex::AddSlot(AActor* Actor, const UClass* Class, const FString& Name, int32 ClassIndex)
+{
+	const int32 Slot = Entries.Num();
+
+	FEntry Entry;
+	Entry.Actor = Actor;
+	Entry.Class = Class;
+	Entry.NameOffset = static_cast<uint32>(NameChars.Num());
+	Entry.NameLength = static_cast<uint32>(Name.size());
+	Entry.ClassIndex = ClassIndex;
+	Entries.Add(Entry);
+
+	NameChars.Reserve(NameChars.Num() + Name.size());
+	for (char C : Name)
+	{
+		NameChars.Add(ToLowerChar(C));
+	}
+
+	// 같은 이름 안에서 반복되는 트라이그램은 한 번만 등록 (목록 끝이 이미 이 슬롯이면 건너뜀)
+	const char* LowerName = NameChars.data() + Entry.NameOffset;
+	for (uint32 i = 0; i + 3 <= Entry.NameLength; ++i)
+	{
+		TArray<int32>& List = Postings[MakeTrigram(LowerName + i)];
+		if (List.IsEmpty() || List.back() != Slot)
+		{
+			List.Add(Slot);
+		}
+	}
+
+	return Slot;
+}
+
+void FActorSearchIndex::RemoveSlot(int32 Slot)
+{
+	// 트라이그램 목록에는 남겨두고 검색 시 빈 슬롯으로 걸러냄
+	Entries[Slot].Actor = nullptr;
+	++DeadSlotCount;
+}
+
+void FActorSearchIndex::CompactIfNeeded()
+{
+	if (DeadSlotCount < MinDeadSlotsForCompaction || DeadSlotCount < SlotByActor.Num())
+		return;
+
+	TArray<FEntry> OldEntries;
+	TArray<char> OldNameChars;
+	OldEntries.swap(Entries);
+	OldNameChars.swap(NameChars);
+	Postings.clear();
+	DeadSlotCount = 0;
+
+	Entries.Reserve(SlotByActor.Num());
+	NameChars.Reserve(OldNameChars.Num());
+	for (const FEntry& OldEntry : OldEntries)
+	{
+		if (!OldEntry.Actor)
+			continue;
+
+		FString Name(OldNameChars.data() + OldEntry.NameOffset, OldEntry.NameLength);
+		SlotByActor.Add(OldEntry.Actor, AddSlot(OldEntry.Actor, OldEntry.Class, Name, OldEntry.ClassIndex));
+	}
+}
+
+bool FActorSearchIndex::PassesFilter(const FEntry& Entry, const char* Query, uint32 QueryLength, const UClass* ClassFilter) const
+{
+	if (!Entry.Actor)
+		return false;
+	if (ClassFilter && !(Entry.Class && Entry.Class->IsChildOf(ClassFilter)))
+		return false;
+	return ContainsSubstring(NameChars.data() + Entry.NameOffset, Entry.NameLength, Query, QueryLength);
+}
@@ -0,0 +1,57 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class AActor;
+struct UClass;
+
+/**
+ * FActorSearchIndex
+ * - 레벨 액터를 이름(부분 문자열, 대소문자 무시)과 클래스로 찾는 인덱스. ULevel이 추가/제거/이름 변경 시점에 갱신
+ * - 이름은 등록 시 한 번만 소문자로 풀어 연속 버퍼에 저장 (검색마다 FName → FString 변환 없음)
+ * - 이름의 3글자 조각(트라이그램) → 슬롯 목록으로 후보를 교집합한 뒤 실제 문자열로 확인
+ * - 제거/이름 변경은 슬롯만 비우고, 빈 슬롯이 쌓이면 한 번에 재구성
+ */
+class FActorSearchIndex
+{
+public:
+	void Add(AActor* Actor);
+	// 이미 해제된 액터일 수 있으므로 역참조하지 않음
+	void Remove(AActor* Actor);
+	// 인덱스에 없는 액터는 무시 (레벨에 추가되기 전 이름 설정 등)
+	void Rename(AActor* Actor);
+	void Clear();
+
+	// 이름에 Query가 포함된 액터를 OutActors에 추가 (ClassFilter가 있으면 그 클래스와 하위 클래스만)
+	// MaxResults가 음수면 제한 없음. 추가한 개수 반환
+	int32 FindByName(const FString& Query, TArray<AActor*>& OutActors, const UClass* ClassFilter = nullptr, int32 MaxResults = -1) const;
+
+	// 클래스별 액터 목록 (bIncludeSubclasses면 하위 클래스 액터까지)
+	void GetActorsOfClass(const UClass* Class, TArray<AActor*>& OutActors, bool bIncludeSubclasses = true) const;
+
+	int32 Num() const { return SlotByActor.Num(); }
+
+private:
+	struct FEntry
+	{
+		AActor* Actor = nullptr;		// nullptr이면 빈 슬롯
+		const UClass* Class = nullptr;
+		uint32 NameOffset = 0;			// NameChars 내 소문자 이름 시작 위치
+		uint32 NameLength = 0;
+		int32 ClassIndex = -1;			// ActorsByClass[Class] 내 위치
+	};
+
+	int32 AddSlot(AActor* Actor, const UClass* Class, const FString& Name, int32 ClassIndex);
+	void RemoveSlot(int32 Slot);
+	void CompactIfNeeded();
+	bool PassesFilter(const FEntry& Entry, const char* Query, uint32 QueryLength, const UClass* ClassFilter) const;
+
+	TArray<FEntry> Entries;
+	TArray<char> NameChars;
+	TMap<AActor*, int32> SlotByActor;
+
+	// 트라이그램 → 슬롯 목록 (슬롯은 항상 증가하는 순서로 추가되므로 정렬 상태 유지)
+	TMap<uint32, TArray<int32>> Postings;
+	int32 DeadSlotCount = 0;
+
+	TMap<const UClass*, TArray<AActor*>> ActorsByClass;
+};
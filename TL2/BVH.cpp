@@ -1,9 +1,13 @@
 ﻿#include "pch.h"
 #include "BVH.h"
 #include "StaticMeshActor.h"
+#include "StaticMeshComponent.h"
+#include "StaticMesh.h"
 #include "Picking.h"
 #include "PickingTimer.h"
 #include "UI/GlobalConsole.h"
+#include "Frustum.h"
+#include "OrientedBox.h"
 #include <algorithm>
 #include <cfloat>
 
@@ -40,42 +44,18 @@ void FBVH::Build(const TArray<AActor*>& Actors)
 
         // Actor의 모든 UStaticMeshComponent를 포함하는 FBound 계산
         FBound CombinedBounds;
-        bool bHasValidBounds = false;
-
-        // Actor의 모든 컴포넌트 순회
-        const TSet<UActorComponent*>& Components = Actor->GetComponents();
-        for (UActorComponent* Component : Components)
-        {
-            // UStaticMeshComponent만 처리
-            if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Component))
-            {
-                // StaticMesh가 없으면 스킵
-                if (!StaticMeshComp->GetStaticMesh())
-                    continue;
-
-                // 해당 컴포넌트의 World AABB 가져오기
-                FBound ComponentBounds = StaticMeshComp->GetWorldBoundingBox();
-
-                if (!bHasValidBounds)
-                {
-                    // 첫 번째 유효한 바운드
-                    CombinedBounds = ComponentBounds;
-                    bHasValidBounds = true;
-                }
-                else
-                {
-                    // 기존 바운드와 합치기 (+= 연산자 사용)
-                    CombinedBounds += ComponentBounds;
-                }
-            }
-        }
-
-        // 유효한 바운드가 있을 때만 추가
-        if (bHasValidBounds)
+        if (CalculateActorBounds(Actor, CombinedBounds))
         {
             FActorBounds AB(Actor, CombinedBounds);
+            GatherComponentBounds(AB);
             ActorBounds.Add(AB);
             ActorIndices.Add(ActorBounds.Num() - 1);
+            ActorToBoundsIndex.Add(Actor, ActorBounds.Num() - 1);
+        }
+        else
+        {
+            // 바운드가 없는 액터(라이트, 데칼 등)는 컬링할 수 없으므로 별도 보관
+            UnboundedActors.Add(Actor);
         }
     }
 
@@ -84,6 +64,8 @@ void FBVH::Build(const TArray<AActor*>& Actors)
 
     // 2. 노드 배열 예약 (최악의 경우 2*N-1개 노드)
     Nodes.Reserve(ActorBounds.Num() * 2);
+    BoundsLeafNode.SetNum(ActorBounds.Num(), -1);
+    DirtyBoundsFlags.SetNum(ActorBounds.Num(), 0);
 
     // 3. 재귀적으로 BVH 구축
     MaxDepth = 0;
@@ -114,7 +96,14 @@ void FBVH::Clear()
 {
     Nodes.Empty();
     ActorBounds.Empty();
+    ComponentBounds.Empty();
     ActorIndices.Empty();
+    UnboundedActors.Empty();
+    ProxyPickActors.Empty();
+    ActorToBoundsIndex.Empty();
+    BoundsLeafNode.Empty();
+    DirtyBoundsIndices.Empty();
+    DirtyBoundsFlags.Empty();
     MaxDepth = 0;
     bIsDirty = false;
 }
@@ -127,23 +116,23 @@ AActor* FBVH::Intersect(const FVector& RayOrigin, const FVector& RayDirection, f
     TStatId BVHIntersectStatId;
     FScopeCycleCounter BVHIntersectTimer(BVHIntersectStatId);
 
-    OutDistance = FLT_MAX;
-    AActor* HitActor = nullptr;
+    FRay Ray;
+    Ray.Origin = RayOrigin;
+    Ray.Direction = RayDirection;
 
-    // 최적화된 Ray 생성 (InverseDirection과 Sign 미리 계산)
-    FOptimizedRay OptRay(RayOrigin, RayDirection);
-    bool bHit = IntersectNode(0, OptRay, OutDistance, HitActor);
+    OutDistance = FLT_MAX;
+    UStaticMeshComponent* HitComponent = IntersectComponents(Ray, OutDistance);
 
     uint64_t IntersectCycles = BVHIntersectTimer.Finish();
     double IntersectTimeMs = FPlatformTime::ToMilliseconds(IntersectCycles);
 
-    if (bHit)
+    if (HitComponent)
     {
         char buf[256];
         sprintf_s(buf, "[BVH Pick] Hit actor at distance %.3f (Time: %.3fms)\n",
             OutDistance, IntersectTimeMs);
         UE_LOG(buf);
-        return HitActor;
+        return HitComponent->GetOwner();
     }
     else
     {
@@ -154,6 +143,245 @@ AActor* FBVH::Intersect(const FVector& RayOrigin, const FVector& RayDirection, f
     }
 }
 
+UStaticMeshComponent* FBVH::IntersectComponents(const FRay& Ray, float& InOutDistance) const
+{
+    if (Nodes.Num() == 0)
+        return nullptr;
+
+    const FOptimizedRay OptRay(Ray.Origin, Ray.Direction);
+    UStaticMeshComponent* HitComponent = nullptr;
+
+    // 진입 거리와 함께 쌓는 스택 (먼 자식을 먼저 넣어 가까운 자식이 먼저 나옴)
+    struct FStackEntry
+    {
+        int NodeIndex;
+        float TNear;
+    };
+    FStackEntry Stack[MaxBVHDepth * 2 + 2];
+    int StackSize = 0;
+
+    float RootTNear;
+    if (!OptRay.IntersectAABB(Nodes[0].BoundingBox, RootTNear))
+        return nullptr;
+    Stack[StackSize++] = { 0, RootTNear };
+
+    // 리프 안의 컴포넌트 후보 (진입 거리 순으로 BLAS 검사)
+    TArray<TPair<float, int>> Candidates;
+
+    while (StackSize > 0)
+    {
+        const FStackEntry Entry = Stack[--StackSize];
+        if (Entry.TNear >= InOutDistance)
+            continue; // 더 가까운 삼각형을 이미 찾음
+
+        const FBVHNode& Node = Nodes[Entry.NodeIndex];
+        if (Node.IsLeaf())
+        {
+            Candidates.clear();
+            for (int i = 0; i < Node.ActorCount; ++i)
+            {
+                const FActorBounds& AB = ActorBounds[ActorIndices[Node.FirstActor + i]];
+                if (!AB.Actor || AB.Actor->GetActorHiddenInGame())
+                    continue;
+
+                for (int c = 0; c < AB.ComponentCount; ++c)
+                {
+                    const int ComponentIndex = AB.FirstComponent + c;
+                    float TNear;
+                    if (OptRay.IntersectAABB(ComponentBounds[ComponentIndex].Bounds, TNear) && TNear < InOutDistance)
+                    {
+                        Candidates.Add({ TNear, ComponentIndex });
+                    }
+                }
+            }
+
+            std::sort(Candidates.begin(), Candidates.end(), [](const TPair<float, int>& A, const TPair<float, int>& B)
+            {
+                return A.first < B.first;
+            });
+
+            for (const TPair<float, int>& Candidate : Candidates)
+            {
+                if (Candidate.first >= InOutDistance)
+                    break;
+
+                const FComponentBounds& ComponentEntry = ComponentBounds[Candidate.second];
+                if (IntersectComponent(ComponentEntry, Ray, InOutDistance))
+                {
+                    HitComponent = ComponentEntry.Component;
+                }
+            }
+            continue;
+        }
+
+        float LeftTNear = FLT_MAX;
+        float RightTNear = FLT_MAX;
+        const bool bLeft = Node.LeftChild >= 0 && OptRay.IntersectAABB(Nodes[Node.LeftChild].BoundingBox, LeftTNear) && LeftTNear < InOutDistance;
+        const bool bRight = Node.RightChild >= 0 && OptRay.IntersectAABB(Nodes[Node.RightChild].BoundingBox, RightTNear) && RightTNear < InOutDistance;
+
+        if (bLeft && bRight)
+        {
+            if (LeftTNear < RightTNear)
+            {
+                Stack[StackSize++] = { Node.RightChild, RightTNear };
+                Stack[StackSize++] = { Node.LeftChild, LeftTNear };
+            }
+            else
+            {
+                Stack[StackSize++] = { Node.LeftChild, LeftTNear };
+                Stack[StackSize++] = { Node.RightChild, RightTNear };
+            }
+        }
+        else if (bLeft)
+        {
+            Stack[StackSize++] = { Node.LeftChild, LeftTNear };
+        }
+        else if (bRight)
+        {
+            Stack[StackSize++] = { Node.RightChild, RightTNear };
+        }
+    }
+
+    return HitComponent;
+}
+
+bool FBVH::IntersectComponent(const FComponentBounds& Entry, const FRay& Ray, float& InOutDistance)
+{
+    UStaticMesh* StaticMesh = Entry.Component ? Entry.Component->GetStaticMesh() : nullptr;
+    FNarrowPhaseBVHNode* MeshBVH = StaticMesh ? StaticMesh->GetMeshBVH() : nullptr;
+    if (!MeshBVH)
+        return false;
+
+    // 월드 → 로컬 (방향은 정규화하고 그 길이로 로컬 거리 ↔ 월드 거리를 환산)
+    FRay LocalRay;
+    LocalRay.Origin = Entry.InvWorldMatrix.TransformPosition(Ray.Origin);
+    LocalRay.Direction = Entry.InvWorldMatrix.TransformVector(Ray.Direction);
+    const float LocalPerWorld = LocalRay.Direction.Size();
+    if (LocalPerWorld <= KINDA_SMALL_NUMBER)
+        return false;
+    LocalRay.Direction = LocalRay.Direction * (1.0f / LocalPerWorld);
+
+    float LocalHitDistance = (InOutDistance < FLT_MAX) ? InOutDistance * LocalPerWorld : FLT_MAX;
+    if (!IntersectTriangleBVH(LocalRay, MeshBVH, StaticMesh->GetStaticMeshAsset(), LocalHitDistance))
+        return false;
+
+    const float WorldHitDistance = LocalHitDistance / LocalPerWorld;
+    if (WorldHitDistance >= InOutDistance)
+        return false;
+
+    InOutDistance = WorldHitDistance;
+    return true;
+}
+
+void FBVH::GatherComponentBounds(FActorBounds& AB)
+{
+    AB.FirstComponent = ComponentBounds.Num();
+    for (UActorComponent* Component : AB.Actor->GetComponents())
+    {
+        UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Component);
+        if (!StaticMeshComp || !StaticMeshComp->GetStaticMesh())
+            continue;
+
+        FComponentBounds Entry;
+        Entry.Bounds = StaticMeshComp->GetWorldBoundingBox();
+        Entry.InvWorldMatrix = StaticMeshComp->GetWorldMatrix().InverseAffine();
+        Entry.Component = StaticMeshComp;
+        ComponentBounds.Add(Entry);
+    }
+    AB.ComponentCount = ComponentBounds.Num() - AB.FirstComponent;
+
+    if (CPickingSystem::HasProxyPickComponents(AB.Actor))
+    {
+        ProxyPickActors.Add(AB.Actor);
+    }
+}
+
+void FBVH::RefreshComponentBounds(const FActorBounds& AB)
+{
+    for (int i = 0; i < AB.ComponentCount; ++i)
+    {
+        FComponentBounds& Entry = ComponentBounds[AB.FirstComponent + i];
+        if (!Entry.Component->GetStaticMesh())
+            continue;
+
+        Entry.Bounds = Entry.Component->GetWorldBoundingBox();
+        Entry.InvWorldMatrix = Entry.Component->GetWorldMatrix().InverseAffine();
+    }
+}
+
+void FBVH::InsertActors(const TArray<AActor*>& NewActors)
+{
+    // 비어 있거나 이미 재빌드 예정이면 어차피 전체 빌드
+    // 삽입마다 한 단계씩 깊어지므로 순회용 고정 스택(MaxBVHDepth * 2 + 2)을 넘기 전에 전체 빌드
+    if (bIsDirty || Nodes.Num() == 0 || MaxDepth + 1 > MaxBVHDepth * 2)
+    {
+        bIsDirty = true;
+        return;
+    }
+
+    // 1. 새 액터의 바운드를 기존 배열 끝에 추가
+    const int FirstNew = ActorBounds.Num();
+    ActorBounds.Reserve(FirstNew + NewActors.Num());
+    ActorIndices.Reserve(FirstNew + NewActors.Num());
+
+    for (AActor* Actor : NewActors)
+    {
+        if (!Actor || Actor->GetActorHiddenInGame() || ActorToBoundsIndex.Contains(Actor))
+            continue;
+
+        FBound CombinedBounds;
+        if (CalculateActorBounds(Actor, CombinedBounds))
+        {
+            FActorBounds AB(Actor, CombinedBounds);
+            GatherComponentBounds(AB);
+            ActorBounds.Add(AB);
+            ActorIndices.Add(ActorBounds.Num() - 1);
+            ActorToBoundsIndex.Add(Actor, ActorBounds.Num() - 1);
+        }
+        else
+        {
+            UnboundedActors.Add(Actor);
+        }
+    }
+
+    const int NewCount = ActorBounds.Num() - FirstNew;
+    if (NewCount == 0)
+        return;
+
+    BoundsLeafNode.resize(ActorBounds.Num(), -1);
+    DirtyBoundsFlags.resize(ActorBounds.Num(), 0);
+
+    // 2. 기존 루트를 배열 끝으로 옮기고 자식/리프 역참조를 갱신 (루트는 항상 0번 노드)
+    const int OldRoot = Nodes.Num();
+    Nodes.Add(Nodes[0]);
+    if (Nodes[OldRoot].IsLeaf())
+    {
+        MakeLeaf(OldRoot, Nodes[OldRoot].FirstActor, Nodes[OldRoot].ActorCount);
+    }
+    else
+    {
+        Nodes[Nodes[OldRoot].LeftChild].Parent = OldRoot;
+        Nodes[Nodes[OldRoot].RightChild].Parent = OldRoot;
+    }
+
+    // 3. 새 액터 구간(ActorIndices 끝)만으로 서브트리 구축
+    Nodes.Reserve(Nodes.Num() + NewCount * 2);
+    MaxDepth += 1;
+    const int NewRoot = BuildRecursive(FirstNew, NewCount, 1);
+
+    // 4. 0번에 두 서브트리를 묶는 새 루트 (두 구간이 연속이므로 전체 구간을 그대로 덮음)
+    FBVHNode Root;
+    Root.LeftChild = OldRoot;
+    Root.RightChild = NewRoot;
+    Root.BoundingBox = Nodes[OldRoot].BoundingBox;
+    Root.BoundingBox += Nodes[NewRoot].BoundingBox;
+    Root.RangeFirst = 0;
+    Root.RangeCount = ActorBounds.Num();
+    Nodes[0] = Root;
+    Nodes[OldRoot].Parent = 0;
+    Nodes[NewRoot].Parent = 0;
+}
+
 int FBVH::BuildRecursive(int FirstActor, int ActorCount, int Depth)
 {
     MaxDepth = FMath::Max(MaxDepth, Depth);
@@ -164,11 +392,12 @@ int FBVH::BuildRecursive(int FirstActor, int ActorCount, int Depth)
     FBVHNode& Node = Nodes[NodeIndex];
 
     Node.BoundingBox = CalculateBounds(FirstActor, ActorCount);
+    Node.RangeFirst = FirstActor;
+    Node.RangeCount = ActorCount;
 
     if (ActorCount <= MaxActorsPerLeaf || Depth >= MaxBVHDepth)
     {
-        Node.FirstActor = FirstActor;
-        Node.ActorCount = ActorCount;
+        MakeLeaf(NodeIndex, FirstActor, ActorCount);
         return NodeIndex;
     }
 
@@ -178,8 +407,7 @@ int FBVH::BuildRecursive(int FirstActor, int ActorCount, int Depth)
 
     if (SplitIndex == FirstActor || SplitIndex == FirstActor + ActorCount)
     {
-        Node.FirstActor = FirstActor;
-        Node.ActorCount = ActorCount;
+        MakeLeaf(NodeIndex, FirstActor, ActorCount);
         return NodeIndex;
     }
 
@@ -190,16 +418,64 @@ int FBVH::BuildRecursive(int FirstActor, int ActorCount, int Depth)
 
     if (LeftCount == 0 || RightCount == 0)
     {
-        Node.FirstActor = FirstActor;
-        Node.ActorCount = ActorCount;
+        MakeLeaf(NodeIndex, FirstActor, ActorCount);
         return NodeIndex;
     }
 
-    Node.LeftChild = BuildRecursive(FirstActor, LeftCount, Depth + 1);
-    Node.RightChild = BuildRecursive(ActualSplit, RightCount, Depth + 1);
+    // 재귀 호출 중 Nodes가 재할당될 수 있으므로 참조 대신 인덱스로 기록
+    const int LeftChild = BuildRecursive(FirstActor, LeftCount, Depth + 1);
+    const int RightChild = BuildRecursive(ActualSplit, RightCount, Depth + 1);
+    Nodes[NodeIndex].LeftChild = LeftChild;
+    Nodes[NodeIndex].RightChild = RightChild;
+    Nodes[LeftChild].Parent = NodeIndex;
+    Nodes[RightChild].Parent = NodeIndex;
 
     return NodeIndex;
 }
+
+void FBVH::MakeLeaf(int NodeIndex, int FirstActor, int ActorCount)
+{
+    FBVHNode& Node = Nodes[NodeIndex];
+    Node.FirstActor = FirstActor;
+    Node.ActorCount = ActorCount;
+
+    for (int i = 0; i < ActorCount; ++i)
+    {
+        BoundsLeafNode[ActorIndices[FirstActor + i]] = NodeIndex;
+    }
+}
+
+bool FBVH::CalculateActorBounds(AActor* Actor, FBound& OutBounds)
+{
+    bool bHasValidBounds = false;
+
+    // Actor의 모든 컴포넌트 순회
+    const TSet<UActorComponent*>& Components = Actor->GetComponents();
+    for (UActorComponent* Component : Components)
+    {
+        // UStaticMeshComponent만 처리
+        UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Component);
+        if (!StaticMeshComp || !StaticMeshComp->GetStaticMesh())
+            continue;
+
+        // 해당 컴포넌트의 World AABB 가져오기
+        FBound ComponentBounds = StaticMeshComp->GetWorldBoundingBox();
+
+        if (!bHasValidBounds)
+        {
+            // 첫 번째 유효한 바운드
+            OutBounds = ComponentBounds;
+            bHasValidBounds = true;
+        }
+        else
+        {
+            // 기존 바운드와 합치기 (+= 연산자 사용)
+            OutBounds += ComponentBounds;
+        }
+    }
+
+    return bHasValidBounds;
+}
 // BVH.cpp
 float FBVH::SurfaceArea(const FBound& b) {
     FVector s = b.Max - b.Min;
@@ -414,164 +690,589 @@ int FBVH::PartitionActors(int FirstActor, int ActorCount, int Axis, float SplitP
     return Left;
 }
 
-bool FBVH::IntersectNode(int NodeIndex,
-    const FOptimizedRay& Ray,
-    float& InOutDistance,
-    AActor*& OutActor) const
+// AABB와 교차하는 모든 액터 찾기
+void FBVH::IntersectAABB(const FBound& QueryAABB, TArray<AActor*>& OutActors) const
 {
-    const FBVHNode& Node = Nodes[NodeIndex];
+    if (Nodes.Num() == 0)
+        return;
 
-    // 최적화된 Ray-AABB 교차 검사 사용
-    float tNear;
-    if (!Ray.IntersectAABB(Node.BoundingBox, tNear))
-        return false;
+    // 루트 노드부터 재귀 탐색
+    IntersectAABBNode(0, QueryAABB, OutActors);
+}
 
-    if (tNear >= InOutDistance)
-        return false;
+void FBVH::IntersectAABBBatch(const TArray<FBound>& QueryAABBs, TArray<TPair<int32, AActor*>>& OutPairs) const
+{
+    if (Nodes.Num() == 0 || QueryAABBs.IsEmpty())
+        return;
 
-    if (Node.IsLeaf())
+    // 노드별로 살아남은 쿼리 인덱스를 이어 붙여 보관 (Entry는 그 구간을 가리킴)
+    TArray<int32> QueryIndices;
+    QueryIndices.Reserve(QueryAABBs.Num() * 4);
+
+    for (int32 i = 0; i < QueryAABBs.Num(); ++i)
+    {
+        if (Nodes[0].BoundingBox.IsIntersect(QueryAABBs[i]))
+        {
+            QueryIndices.Add(i);
+        }
+    }
+
+    if (QueryIndices.IsEmpty())
+        return;
+
+    struct FBatchEntry
     {
-        bool bHit = false;
-        float Closest = InOutDistance;
-        AActor* ClosestActor = nullptr;
+        int NodeIndex;
+        int32 First;
+        int32 Count;
+    };
+
+    TArray<FBatchEntry> Stack;
+    Stack.Reserve(64);
+    Stack.Add({ 0, 0, QueryIndices.Num() });
+
+    while (!Stack.IsEmpty())
+    {
+        const FBatchEntry Entry = Stack.Pop();
+        const FBVHNode& Node = Nodes[Entry.NodeIndex];
+
+        if (Node.IsLeaf())
+        {
+            for (int i = 0; i < Node.ActorCount; ++i)
+            {
+                const FActorBounds& AB = ActorBounds[ActorIndices[Node.FirstActor + i]];
+                if (!AB.Actor || AB.Actor->GetActorHiddenInGame())
+                    continue;
+
+                for (int32 q = Entry.First; q < Entry.First + Entry.Count; ++q)
+                {
+                    const int32 QueryIndex = QueryIndices[q];
+                    if (AB.Bounds.IsIntersect(QueryAABBs[QueryIndex]))
+                    {
+                        OutPairs.Add({ QueryIndex, AB.Actor });
+                    }
+                }
+            }
+            continue;
+        }
+
+        const int Children[2] = { Node.LeftChild, Node.RightChild };
+        for (int ChildIndex : Children)
+        {
+            if (ChildIndex < 0)
+                continue;
+
+            const FBound& ChildBounds = Nodes[ChildIndex].BoundingBox;
+            const int32 ChildFirst = QueryIndices.Num();
+            for (int32 q = Entry.First; q < Entry.First + Entry.Count; ++q)
+            {
+                const int32 QueryIndex = QueryIndices[q];
+                if (ChildBounds.IsIntersect(QueryAABBs[QueryIndex]))
+                {
+                    QueryIndices.Add(QueryIndex);
+                }
+            }
+
+            const int32 ChildCount = QueryIndices.Num() - ChildFirst;
+            if (ChildCount > 0)
+            {
+                Stack.Add({ ChildIndex, ChildFirst, ChildCount });
+            }
+        }
+    }
+}
+
+// AABB 교차 검사용 재귀 함수
+void FBVH::IntersectAABBNode(int NodeIndex, const FBound& QueryAABB, TArray<AActor*>& OutActors) const
+{
+    if (NodeIndex < 0 || NodeIndex >= Nodes.Num())
+        return;
+
+    const FBVHNode& Node = Nodes[NodeIndex];
+
+    // 노드의 AABB와 Query AABB가 교차하는지 확인
+    if (!Node.BoundingBox.IsIntersect(QueryAABB))
+        return;
 
+    // 리프 노드인 경우 액터들 추가
+    if (Node.IsLeaf())
+    {
         for (int i = 0; i < Node.ActorCount; ++i)
         {
             int ActorIndex = ActorIndices[Node.FirstActor + i];
             AActor* Actor = ActorBounds[ActorIndex].Actor;
 
-            float Dist;
-            if (IntersectActor(Actor, Ray.Origin, Ray.Direction, Dist))
+            if (Actor && !Actor->GetActorHiddenInGame())
             {
-                if (Dist < Closest)
+                // 액터의 실제 AABB와 Query AABB가 교차하는지 확인
+                const FBound& ActorAABB = ActorBounds[ActorIndex].Bounds;
+                if (ActorAABB.IsIntersect(QueryAABB))
                 {
-                    Closest = Dist;
-                    ClosestActor = Actor;
-                    bHit = true;
+                    OutActors.Add(Actor);
                 }
             }
         }
+        return;
+    }
 
-        if (bHit)
-        {
-            InOutDistance = Closest;
-            OutActor = ClosestActor;
-        }
+    // 내부 노드인 경우 자식 노드들 재귀 탐색
+    if (Node.LeftChild >= 0)
+    {
+        IntersectAABBNode(Node.LeftChild, QueryAABB, OutActors);
+    }
 
-        return bHit;
+    if (Node.RightChild >= 0)
+    {
+        IntersectAABBNode(Node.RightChild, QueryAABB, OutActors);
     }
+}
+
+// 절두체와 교차하거나 내부에 있는 모든 액터 찾기
+void FBVH::QueryFrustum(const FFrustum& Frustum, TArray<AActor*>& OutActors) const
+{
+    QueryFrustum(Frustum, OutActors, OutActors);
+}
+
+// 완전 포함 / 경계 걸침을 구분해 수집
+void FBVH::QueryFrustum(const FFrustum& Frustum, TArray<AActor*>& OutContained, TArray<AActor*>& OutIntersecting) const
+{
+    if (Nodes.Num() == 0)
+        return;
 
-    struct ChildHit
+    struct FStackEntry
     {
-        int Index;
-        float tNear;
-        bool bValid;
+        int NodeIndex;
+        uint32 PlaneMask;
     };
 
-    auto TestChild = [&](int ChildIdx) -> ChildHit
-        {
-            if (ChildIdx < 0) return { ChildIdx, FLT_MAX, false };
-            float tN;
-            if (Ray.IntersectAABB(Nodes[ChildIdx].BoundingBox, tN))
-                return { ChildIdx, tN, true };
-            return { ChildIdx, FLT_MAX, false };
-        };
+    // 깊이가 MaxBVHDepth로 제한되므로 고정 크기 스택으로 충분
+    FStackEntry Stack[MaxBVHDepth * 2 + 2];
+    int StackSize = 0;
+    Stack[StackSize++] = { 0, FFrustum::AllPlanesMask };
 
-    ChildHit L = TestChild(Node.LeftChild);
-    ChildHit R = TestChild(Node.RightChild);
+    while (StackSize > 0)
+    {
+        const FStackEntry Entry = Stack[--StackSize];
+        const FBVHNode& Node = Nodes[Entry.NodeIndex];
 
-    bool bHit = false;
+        uint32 PlaneMask = Entry.PlaneMask;
+        const EFrustumContainment Containment = Frustum.ClassifyBox(Node.BoundingBox, PlaneMask);
 
-    if (L.bValid && R.bValid)
-    {
-        const ChildHit First = (L.tNear < R.tNear) ? L : R;
-        const ChildHit Second = (L.tNear < R.tNear) ? R : L;
+        if (Containment == EFrustumContainment::Outside)
+            continue;
 
-        if (IntersectNode(First.Index, Ray, InOutDistance, OutActor))
-            bHit = true;
+        // 완전히 내부: 서브트리 구간 전체를 액터 단위 검사 없이 추가
+        if (Containment == EFrustumContainment::Inside)
+        {
+            for (int i = 0; i < Node.RangeCount; ++i)
+            {
+                OutContained.Add(ActorBounds[ActorIndices[Node.RangeFirst + i]].Actor);
+            }
+            continue;
+        }
 
-        if (InOutDistance > Second.tNear)
+        if (Node.IsLeaf())
         {
-            if (IntersectNode(Second.Index, Ray, InOutDistance, OutActor))
-                bHit = true;
+            for (int i = 0; i < Node.ActorCount; ++i)
+            {
+                const FActorBounds& AB = ActorBounds[ActorIndices[Node.FirstActor + i]];
+                uint32 ActorPlaneMask = PlaneMask;
+                const EFrustumContainment ActorContainment = Frustum.ClassifyBox(AB.Bounds, ActorPlaneMask);
+                if (ActorContainment == EFrustumContainment::Inside)
+                {
+                    OutContained.Add(AB.Actor);
+                }
+                else if (ActorContainment == EFrustumContainment::Intersects)
+                {
+                    OutIntersecting.Add(AB.Actor);
+                }
+            }
+            continue;
         }
+
+        if (Node.RightChild >= 0)
+            Stack[StackSize++] = { Node.RightChild, PlaneMask };
+        if (Node.LeftChild >= 0)
+            Stack[StackSize++] = { Node.LeftChild, PlaneMask };
     }
-    else if (L.bValid)
+}
+
+namespace
+{
+    // 점에서 AABB까지 거리의 제곱 (내부면 0)
+    inline float DistanceSquaredToBox(const FVector& Point, const FBound& Box)
+    {
+        const float DX = FMath::Max(FMath::Max(Box.Min.X - Point.X, Point.X - Box.Max.X), 0.0f);
+        const float DY = FMath::Max(FMath::Max(Box.Min.Y - Point.Y, Point.Y - Box.Max.Y), 0.0f);
+        const float DZ = FMath::Max(FMath::Max(Box.Min.Z - Point.Z, Point.Z - Box.Max.Z), 0.0f);
+        return DX * DX + DY * DY + DZ * DZ;
+    }
+
+    inline FBound ExpandBox(const FBound& Box, float Amount)
     {
-        if (IntersectNode(L.Index, Ray, InOutDistance, OutActor))
-            bHit = true;
+        const FVector Offset(Amount, Amount, Amount);
+        return FBound(Box.Min - Offset, Box.Max + Offset);
     }
-    else if (R.bValid)
+
+    // 거리순으로 정렬된 Hits[0, NumHits)에 삽입 (가득 찼으면 가장 먼 항목을 밀어냄)
+    inline void InsertSortedHit(std::span<FSpatialHit> Hits, int32& NumHits, AActor* Actor, float Distance)
     {
-        if (IntersectNode(R.Index, Ray, InOutDistance, OutActor))
-            bHit = true;
+        const int32 Capacity = static_cast<int32>(Hits.size());
+        if (NumHits == Capacity)
+        {
+            if (Capacity == 0 || Distance >= Hits[Capacity - 1].Distance)
+                return;
+            --NumHits;
+        }
+
+        int32 Index = NumHits;
+        while (Index > 0 && Hits[Index - 1].Distance > Distance)
+        {
+            Hits[Index] = Hits[Index - 1];
+            --Index;
+        }
+        Hits[Index] = { Actor, Distance };
+        ++NumHits;
     }
 
-    return bHit;
+    // 버퍼가 가득 찼으면 가장 먼 결과보다 먼 노드는 열 필요가 없음
+    inline float GetPruneDistance(std::span<const FSpatialHit> Hits, int32 NumHits, float Limit)
+    {
+        if (NumHits > 0 && NumHits == static_cast<int32>(Hits.size()))
+        {
+            return FMath::Min(Limit, Hits[NumHits - 1].Distance);
+        }
+        return Limit;
+    }
 }
 
-bool FBVH::IntersectActor(const AActor* Actor, const FVector& RayOrigin, const FVector& RayDirection,
-    float& OutDistance) const
+int32 FBVH::OverlapSphere(const FVector& Center, float Radius, std::span<AActor*> OutActors) const
 {
-    FRay Ray;
-    Ray.Origin = RayOrigin;
-    Ray.Direction = RayDirection;
+    if (Nodes.Num() == 0 || Radius < 0.0f)
+        return 0;
+
+    const float RadiusSq = Radius * Radius;
+    const int32 Capacity = static_cast<int32>(OutActors.size());
+    int32 NumHits = 0;
+
+    // 깊이가 MaxBVHDepth로 제한되므로 고정 크기 스택으로 충분
+    int Stack[MaxBVHDepth * 2 + 2];
+    int StackSize = 0;
+    Stack[StackSize++] = 0;
+
+    while (StackSize > 0)
+    {
+        const FBVHNode& Node = Nodes[Stack[--StackSize]];
+        if (DistanceSquaredToBox(Center, Node.BoundingBox) > RadiusSq)
+            continue;
+
+        if (Node.IsLeaf())
+        {
+            for (int i = 0; i < Node.ActorCount; ++i)
+            {
+                const FActorBounds& AB = ActorBounds[ActorIndices[Node.FirstActor + i]];
+                if (!AB.Actor || AB.Actor->GetActorHiddenInGame())
+                    continue;
+                if (DistanceSquaredToBox(Center, AB.Bounds) > RadiusSq)
+                    continue;
+
+                if (NumHits < Capacity)
+                {
+                    OutActors[NumHits] = AB.Actor;
+                }
+                ++NumHits;
+            }
+            continue;
+        }
+
+        if (Node.RightChild >= 0)
+            Stack[StackSize++] = Node.RightChild;
+        if (Node.LeftChild >= 0)
+            Stack[StackSize++] = Node.LeftChild;
+    }
 
-    //return CPickingSystem::CheckActorPicking(Actor, Ray, OutDistance);
-    return false;
+    return NumHits;
 }
 
-// AABB와 교차하는 모든 액터 찾기
-void FBVH::IntersectAABB(const FBound& QueryAABB, TArray<AActor*>& OutActors) const
+int32 FBVH::OverlapOBB(const FOrientedBox& Box, std::span<AActor*> OutActors) const
 {
     if (Nodes.Num() == 0)
-        return;
+        return 0;
+
+    // OBB를 감싸는 AABB (ToAABB는 모서리 배열을 할당하므로 축 성분 절댓값으로 직접 계산)
+    const FVector AxisX = Box.GetAxisX();
+    const FVector AxisY = Box.GetAxisY();
+    const FVector AxisZ = Box.GetAxisZ();
+    const FVector& Half = Box.HalfExtents;
+    const FVector Extent(
+        std::abs(AxisX.X) * Half.X + std::abs(AxisY.X) * Half.Y + std::abs(AxisZ.X) * Half.Z,
+        std::abs(AxisX.Y) * Half.X + std::abs(AxisY.Y) * Half.Y + std::abs(AxisZ.Y) * Half.Z,
+        std::abs(AxisX.Z) * Half.X + std::abs(AxisY.Z) * Half.Y + std::abs(AxisZ.Z) * Half.Z);
+    const FBound QueryBounds(Box.Center - Extent, Box.Center + Extent);
+
+    const int32 Capacity = static_cast<int32>(OutActors.size());
+    int32 NumHits = 0;
+
+    int Stack[MaxBVHDepth * 2 + 2];
+    int StackSize = 0;
+    Stack[StackSize++] = 0;
+
+    while (StackSize > 0)
+    {
+        const FBVHNode& Node = Nodes[Stack[--StackSize]];
+        if (!Node.BoundingBox.IsIntersect(QueryBounds))
+            continue;
 
-    // 루트 노드부터 재귀 탐색
-    IntersectAABBNode(0, QueryAABB, OutActors);
+        if (Node.IsLeaf())
+        {
+            for (int i = 0; i < Node.ActorCount; ++i)
+            {
+                const FActorBounds& AB = ActorBounds[ActorIndices[Node.FirstActor + i]];
+                if (!AB.Actor || AB.Actor->GetActorHiddenInGame())
+                    continue;
+                if (!AB.Bounds.IsIntersect(QueryBounds))
+                    continue;
+
+                // 감싸는 AABB끼리만 겹친 경우를 SAT로 걸러냄
+                const FOrientedBox ActorBox(AB.Center, (AB.Bounds.Max - AB.Bounds.Min) * 0.5f, FQuat::Identity());
+                if (!Box.Intersects(ActorBox))
+                    continue;
+
+                if (NumHits < Capacity)
+                {
+                    OutActors[NumHits] = AB.Actor;
+                }
+                ++NumHits;
+            }
+            continue;
+        }
+
+        if (Node.RightChild >= 0)
+            Stack[StackSize++] = Node.RightChild;
+        if (Node.LeftChild >= 0)
+            Stack[StackSize++] = Node.LeftChild;
+    }
+
+    return NumHits;
 }
 
-// AABB 교차 검사용 재귀 함수
-void FBVH::IntersectAABBNode(int NodeIndex, const FBound& QueryAABB, TArray<AActor*>& OutActors) const
+int32 FBVH::SweepSphere(const FVector& Start, const FVector& End, float Radius, std::span<FSpatialHit> OutHits) const
 {
-    if (NodeIndex < 0 || NodeIndex >= Nodes.Num())
-        return;
+    if (Nodes.Num() == 0 || OutHits.empty() || Radius < 0.0f)
+        return 0;
 
-    const FBVHNode& Node = Nodes[NodeIndex];
+    const FVector Delta = End - Start;
+    const float Length = Delta.Size();
+    const bool bHasDirection = Length > KINDA_SMALL_NUMBER;
+    const FOptimizedRay Ray(Start, bHasDirection ? Delta / Length : FVector(1.0f, 0.0f, 0.0f));
 
-    // 노드의 AABB와 Query AABB가 교차하는지 확인
-    if (!Node.BoundingBox.IsIntersect(QueryAABB))
-        return;
+    // 반지름만큼 키운 박스에 대해 이동 선분이 처음 닿는 거리 (시작부터 겹쳐 있으면 0)
+    auto SweepBox = [&](const FBound& Box, float& OutDistance) -> bool
+    {
+        const FBound Expanded = ExpandBox(Box, Radius);
+        if (!bHasDirection)
+        {
+            OutDistance = 0.0f;
+            return DistanceSquaredToBox(Start, Expanded) <= 0.0f;
+        }
 
-    // 리프 노드인 경우 액터들 추가
-    if (Node.IsLeaf())
+        float TNear;
+        if (!Ray.IntersectAABB(Expanded, TNear))
+            return false;
+        OutDistance = FMath::Max(TNear, 0.0f);
+        return OutDistance <= Length;
+    };
+
+    int32 NumHits = 0;
+
+    struct FStackEntry
     {
-        for (int i = 0; i < Node.ActorCount; ++i)
+        int NodeIndex;
+        float Distance;
+    };
+
+    FStackEntry Stack[MaxBVHDepth * 2 + 2];
+    int StackSize = 0;
+
+    float RootDistance;
+    if (!SweepBox(Nodes[0].BoundingBox, RootDistance))
+        return 0;
+    Stack[StackSize++] = { 0, RootDistance };
+
+    while (StackSize > 0)
+    {
+        const FStackEntry Entry = Stack[--StackSize];
+        if (Entry.Distance > GetPruneDistance(OutHits, NumHits, Length))
+            continue;
+
+        const FBVHNode& Node = Nodes[Entry.NodeIndex];
+        if (Node.IsLeaf())
         {
-            int ActorIndex = ActorIndices[Node.FirstActor + i];
-            AActor* Actor = ActorBounds[ActorIndex].Actor;
+            for (int i = 0; i < Node.ActorCount; ++i)
+            {
+                const FActorBounds& AB = ActorBounds[ActorIndices[Node.FirstActor + i]];
+                if (!AB.Actor || AB.Actor->GetActorHiddenInGame())
+                    continue;
 
-            if (Actor && !Actor->GetActorHiddenInGame())
+                float HitDistance;
+                if (SweepBox(AB.Bounds, HitDistance))
+                {
+                    InsertSortedHit(OutHits, NumHits, AB.Actor, HitDistance);
+                }
+            }
+            continue;
+        }
+
+        // 가까운 자식을 먼저 열어 버퍼가 빨리 차고 먼 노드가 가지치기되도록 함
+        FStackEntry Children[2];
+        int NumChildren = 0;
+        for (int ChildIndex : { Node.LeftChild, Node.RightChild })
+        {
+            float ChildDistance;
+            if (ChildIndex >= 0 && SweepBox(Nodes[ChildIndex].BoundingBox, ChildDistance))
             {
-                // 액터의 실제 AABB와 Query AABB가 교차하는지 확인
-                const FBound& ActorAABB = ActorBounds[ActorIndex].Bounds;
-                if (ActorAABB.IsIntersect(QueryAABB))
+                Children[NumChildren++] = { ChildIndex, ChildDistance };
+            }
+        }
+        if (NumChildren == 2 && Children[0].Distance < Children[1].Distance)
+        {
+            std::swap(Children[0], Children[1]);
+        }
+        for (int c = 0; c < NumChildren; ++c)
+        {
+            Stack[StackSize++] = Children[c];
+        }
+    }
+
+    return NumHits;
+}
+
+int32 FBVH::FindNearest(const FVector& Point, std::span<FSpatialHit> OutHits, float MaxDistance) const
+{
+    if (Nodes.Num() == 0 || OutHits.empty() || MaxDistance < 0.0f)
+        return 0;
+
+    // 순회 중에는 거리 제곱으로 비교하고 마지막에 한 번만 제곱근
+    const float MaxDistanceSq = MaxDistance < FLT_MAX ? MaxDistance * MaxDistance : FLT_MAX;
+    int32 NumHits = 0;
+
+    struct FStackEntry
+    {
+        int NodeIndex;
+        float DistanceSq;
+    };
+
+    FStackEntry Stack[MaxBVHDepth * 2 + 2];
+    int StackSize = 0;
+    Stack[StackSize++] = { 0, DistanceSquaredToBox(Point, Nodes[0].BoundingBox) };
+
+    while (StackSize > 0)
+    {
+        const FStackEntry Entry = Stack[--StackSize];
+        if (Entry.DistanceSq > GetPruneDistance(OutHits, NumHits, MaxDistanceSq))
+            continue;
+
+        const FBVHNode& Node = Nodes[Entry.NodeIndex];
+        if (Node.IsLeaf())
+        {
+            for (int i = 0; i < Node.ActorCount; ++i)
+            {
+                const FActorBounds& AB = ActorBounds[ActorIndices[Node.FirstActor + i]];
+                if (!AB.Actor || AB.Actor->GetActorHiddenInGame())
+                    continue;
+
+                const float DistanceSq = DistanceSquaredToBox(Point, AB.Bounds);
+                if (DistanceSq <= MaxDistanceSq)
                 {
-                    OutActors.Add(Actor);
+                    InsertSortedHit(OutHits, NumHits, AB.Actor, DistanceSq);
                 }
             }
+            continue;
+        }
+
+        // 가까운 자식을 나중에 넣어 먼저 꺼냄
+        FStackEntry Children[2];
+        int NumChildren = 0;
+        for (int ChildIndex : { Node.LeftChild, Node.RightChild })
+        {
+            if (ChildIndex >= 0)
+            {
+                Children[NumChildren++] = { ChildIndex, DistanceSquaredToBox(Point, Nodes[ChildIndex].BoundingBox) };
+            }
+        }
+        if (NumChildren == 2 && Children[0].DistanceSq < Children[1].DistanceSq)
+        {
+            std::swap(Children[0], Children[1]);
+        }
+        for (int c = 0; c < NumChildren; ++c)
+        {
+            Stack[StackSize++] = Children[c];
         }
-        return;
     }
 
-    // 내부 노드인 경우 자식 노드들 재귀 탐색
-    if (Node.LeftChild >= 0)
+    for (int32 i = 0; i < NumHits; ++i)
     {
-        IntersectAABBNode(Node.LeftChild, QueryAABB, OutActors);
+        OutHits[i].Distance = std::sqrt(OutHits[i].Distance);
     }
+    return NumHits;
+}
 
-    if (Node.RightChild >= 0)
+std::span<const FComponentBounds> FBVH::GetComponentBounds(AActor* Actor) const
+{
+    const int* BoundsIndex = ActorToBoundsIndex.Find(Actor);
+    if (!BoundsIndex)
+        return {};
+
+    const FActorBounds& AB = ActorBounds[*BoundsIndex];
+    return std::span<const FComponentBounds>(ComponentBounds.data() + AB.FirstComponent, AB.ComponentCount);
+}
+
+void FBVH::MarkActorBoundsDirty(AActor* Actor)
+{
+    const int* BoundsIndex = ActorToBoundsIndex.Find(Actor);
+    if (!BoundsIndex)
+        return; // BVH에 없는 액터 (다음 재빌드 때 반영)
+
+    if (DirtyBoundsFlags[*BoundsIndex])
+        return;
+
+    DirtyBoundsFlags[*BoundsIndex] = 1;
+    DirtyBoundsIndices.Add(*BoundsIndex);
+}
+
+void FBVH::RefitDirtyBounds()
+{
+    for (int BoundsIndex : DirtyBoundsIndices)
     {
-        IntersectAABBNode(Node.RightChild, QueryAABB, OutActors);
+        DirtyBoundsFlags[BoundsIndex] = 0;
+
+        FActorBounds& AB = ActorBounds[BoundsIndex];
+        FBound NewBounds;
+        if (!CalculateActorBounds(AB.Actor, NewBounds))
+        {
+            // 메시가 사라진 경우 다음 재빌드에서 정리되도록 위치만 유지
+            continue;
+        }
+        AB.Bounds = NewBounds;
+        AB.Center = NewBounds.GetCenter();
+        RefreshComponentBounds(AB);
+
+        // 리프부터 루트까지 부모 바운드를 다시 합침
+        int NodeIndex = BoundsLeafNode[BoundsIndex];
+        while (NodeIndex >= 0)
+        {
+            FBVHNode& Node = Nodes[NodeIndex];
+            if (Node.IsLeaf())
+            {
+                Node.BoundingBox = CalculateBounds(Node.FirstActor, Node.ActorCount);
+            }
+            else
+            {
+                Node.BoundingBox = Union(Nodes[Node.LeftChild].BoundingBox, Nodes[Node.RightChild].BoundingBox);
+            }
+            NodeIndex = Node.Parent;
+        }
     }
+
+    DirtyBoundsIndices.Empty();
 }
@@ -3,9 +3,15 @@
 #include "UEContainer.h"
 #include"AABoundingBoxComponent.h"
 #include "Actor.h"
+#include "SpatialQuery.h"
 #include <cmath>
+#include <span>
 
 struct FBound;
+struct FRay;
+struct FOrientedBox;
+class FFrustum;
+class UStaticMeshComponent;
 
 // 최적화된 Ray-AABB 교차 검사를 위한 구조체
 struct alignas(16) FOptimizedRay
@@ -72,10 +78,16 @@ struct FBVHNode
     // 내부 노드용 데이터
     int LeftChild;   // 왼쪽 자식 노드 인덱스
     int RightChild;  // 오른쪽 자식 노드 인덱스
+    int Parent;      // 부모 노드 인덱스 (루트는 -1, Refit용)
+
+    // 서브트리가 덮는 ActorIndices 구간 (내부 노드 포함, 완전 포함 서브트리 일괄 수집용)
+    int RangeFirst;
+    int RangeCount;
 
     // 생성자
     FBVHNode()
-        : FirstActor(-1), ActorCount(-1), LeftChild(-1), RightChild(-1)
+        : FirstActor(-1), ActorCount(-1), LeftChild(-1), RightChild(-1), Parent(-1)
+        , RangeFirst(0), RangeCount(0)
     {
     }
 
@@ -90,6 +102,10 @@ struct FActorBounds
     AActor* Actor;
     FVector Center;
 
+    // 이 액터의 컴포넌트 항목 구간 (ComponentBounds 배열)
+    int FirstComponent = 0;
+    int ComponentCount = 0;
+
     FActorBounds() : Actor(nullptr) {}
     FActorBounds(AActor* InActor, const FBound& InBounds)
         : Actor(InActor), Bounds(InBounds)
@@ -98,6 +114,14 @@ struct FActorBounds
     }
 };
 
+// TLAS 리프가 가리키는 스태틱 메시 컴포넌트 (피킹은 액터가 아니라 컴포넌트 단위로 판정)
+struct FComponentBounds
+{
+    FBound Bounds;                      // 컴포넌트 월드 AABB
+    FMatrix InvWorldMatrix;             // 월드 → 로컬 레이 변환 (Build/Refit 때 캐시)
+    UStaticMeshComponent* Component = nullptr;
+};
+
 // 고성능 BVH 구현
 class FBVH
 {
@@ -109,12 +133,58 @@ public:
     void Build(const TArray<AActor*>& Actors);
     void Clear();
 
-    // 빠른 레이 교차 검사 - 가장 가까운 액터 반환
+    // 빠른 레이 교차 검사 - 가장 가까운 액터 반환 (IntersectComponents 결과의 소유 액터)
     AActor* Intersect(const FVector& RayOrigin, const FVector& RayDirection, float& OutDistance) const;
 
+    // 2단계 레이 교차 검사 - 가장 가까운 스태틱 메시 컴포넌트 반환
+    // - TLAS: 이 BVH (노드 → 액터 → 컴포넌트 AABB), 진입 거리가 가까운 노드부터 방문
+    // - BLAS: 메시가 공유하는 삼각형 BVH를 컴포넌트 로컬 공간에서 탐색 (캐시된 역행렬로 레이 변환)
+    // - InOutDistance보다 먼 노드/컴포넌트는 열지 않으므로 가장 가까운 삼각형을 찾으면 나머지는 바로 가지치기됨
+    UStaticMeshComponent* IntersectComponents(const FRay& Ray, float& InOutDistance) const;
+
     // AABB와 교차하는 모든 액터 찾기 (Broad Phase용)
     void IntersectAABB(const FBound& QueryAABB, TArray<AActor*>& OutActors) const;
 
+    // 여러 AABB를 한 번의 순회로 처리해 (쿼리 인덱스, 액터) 쌍을 수집
+    // - 노드마다 그 노드와 겹치는 쿼리만 자식으로 내려보냄
+    void IntersectAABBBatch(const TArray<FBound>& QueryAABBs, TArray<TPair<int32, AActor*>>& OutPairs) const;
+
+    // 절두체와 교차하거나 내부에 있는 모든 액터 찾기 (계층적 Frustum Culling)
+    // - 평면 마스크: 완전히 안쪽인 평면은 자식 노드에서 다시 검사하지 않음
+    // - 완전히 내부인 서브트리는 액터 단위 검사 없이 구간 전체를 추가
+    void QueryFrustum(const FFrustum& Frustum, TArray<AActor*>& OutActors) const;
+
+    // 같은 계층 쿼리지만 액터 바운드가 절두체 안에 완전히 들어간 액터와 경계에 걸친 액터를 나눠 수집
+    // (마퀴 선택에서 걸친 액터만 삼각형 단위로 다시 검사하기 위함, 두 배열에 같은 배열을 넘겨도 됨)
+    void QueryFrustum(const FFrustum& Frustum, TArray<AActor*>& OutContained, TArray<AActor*>& OutIntersecting) const;
+
+    // ===== 공간 질의 (액터 AABB 기준, 숨김 액터 제외, 호출자 버퍼에 기록하며 할당 없음) =====
+    // 겹침 질의는 전체 결과 수를 반환 (버퍼보다 크면 버퍼 크기까지만 기록됨)
+    int32 OverlapSphere(const FVector& Center, float Radius, std::span<AActor*> OutActors) const;
+    // 노드는 OBB를 감싸는 AABB로 거르고, 액터 AABB는 SAT로 확인
+    int32 OverlapOBB(const FOrientedBox& Box, std::span<AActor*> OutActors) const;
+
+    // 거리순 질의는 버퍼 크기만큼 가장 가까운 결과를 가까운 순으로 기록하고 그 수를 반환
+    // 스윕: 액터 AABB를 반지름만큼 키운 박스와 이동 선분을 검사 (모서리에서 보수적)
+    int32 SweepSphere(const FVector& Start, const FVector& End, float Radius, std::span<FSpatialHit> OutHits) const;
+    // 최근접: Point에서 액터 AABB까지 거리가 MaxDistance 이내인 액터 최대 OutHits.size()개
+    int32 FindNearest(const FVector& Point, std::span<FSpatialHit> OutHits, float MaxDistance = FLT_MAX) const;
+
+    // 액터의 TLAS 컴포넌트 항목 (BVH에 없는 액터면 빈 구간)
+    std::span<const FComponentBounds> GetComponentBounds(AActor* Actor) const;
+
+    // 바운드가 없어(StaticMesh 없음) BVH에 들어가지 못한 액터 (컬링 불가, 항상 렌더 대상)
+    const TArray<AActor*>& GetUnboundedActors() const { return UnboundedActors; }
+    // BVH에 들어갔지만 메시가 아닌 피킹 대상(빌보드/텍스트 등)도 가진 액터 (그 컴포넌트들은 TLAS에 없으므로 따로 검사)
+    const TArray<AActor*>& GetProxyPickActors() const { return ProxyPickActors; }
+
+    // 트랜스폼이 바뀐 액터의 바운드를 다음 Refit에서 갱신하도록 예약
+    void MarkActorBoundsDirty(AActor* Actor);
+    bool HasDirtyBounds() const { return !DirtyBoundsIndices.IsEmpty(); }
+
+    // 예약된 액터들의 리프 바운드를 다시 계산하고 루트까지 부모 바운드를 갱신 (재빌드 없이)
+    void RefitDirtyBounds();
+
     // 통계 정보
     int GetNodeCount() const { return Nodes.Num(); }
     int GetActorCount() const { return ActorBounds.Num(); }
@@ -131,17 +201,33 @@ public:
     // BVH 재빌드 (액터 배열을 다시 받아서 빌드)
     void Rebuild(const TArray<AActor*>& Actors);
 
+    // 새 액터 묶음을 재빌드 없이 추가: 새 액터만으로 서브트리를 만들고 기존 루트와 함께 새 루트 아래에 붙임
+    // (대량 붙여넣기/복제용, 트리 품질은 다음 주기적 재빌드에서 회복)
+    void InsertActors(const TArray<AActor*>& NewActors);
+
     static float SurfaceArea(const FBound& b);
+
+    // 액터의 모든 StaticMeshComponent World AABB를 합친 바운드 (없으면 false)
+    static bool CalculateActorBounds(AActor* Actor, FBound& OutBounds);
 private:
     TArray<FBVHNode> Nodes;
     TArray<FActorBounds> ActorBounds;
+    TArray<FComponentBounds> ComponentBounds;
     TArray<int> ActorIndices; // 정렬된 액터 인덱스
 
+    TArray<AActor*> UnboundedActors;
+    TArray<AActor*> ProxyPickActors;
+    TMap<AActor*, int> ActorToBoundsIndex; // 액터 → ActorBounds 인덱스
+    TArray<int> BoundsLeafNode;             // ActorBounds 인덱스 → 소속 리프 노드
+    TArray<int> DirtyBoundsIndices;         // Refit 대기 중인 ActorBounds 인덱스
+    TArray<uint8> DirtyBoundsFlags;         // 중복 등록 방지
+
     int MaxDepth;
     bool bIsDirty; // BVH가 재빌드되어야 하는지 여부
 
     // 재귀 구축 함수
     int BuildRecursive(int FirstActor, int ActorCount, int Depth = 0);
+    void MakeLeaf(int NodeIndex, int FirstActor, int ActorCount);
 
     // 경계 박스 계산
     FBound CalculateBounds(int FirstActor, int ActorCount) const;
@@ -154,18 +240,17 @@ private:
     // 액터 분할
     int PartitionActors(int FirstActor, int ActorCount, int Axis, float SplitPos);
 
-    bool IntersectNode(int NodeIndex, const FOptimizedRay& Ray, float& InOutDistance, AActor*& OutActor) const;
+    // 액터의 스태틱 메시 컴포넌트 항목을 ComponentBounds 끝에 추가하고 구간을 기록
+    void GatherComponentBounds(FActorBounds& AB);
 
-    // AABB 교차 검사용 재귀 함수
-    void IntersectAABBNode(int NodeIndex, const FBound& QueryAABB, TArray<AActor*>& OutActors) const;
+    // 이동한 액터의 컴포넌트 바운드/역행렬 갱신 (항목 수는 재빌드 때만 바뀜)
+    void RefreshComponentBounds(const FActorBounds& AB);
 
-    //// 재귀 교차 검사 (깊이 제한 추가)
-    //bool IntersectNode(int NodeIndex, const FVector& RayOrigin, const FVector& RayDirection,
-    //                   float& InOutDistance, AActor*& OutActor, int RecursionDepth = 0) const;
+    // BLAS: 컴포넌트 메시의 삼각형 BVH와 교차 (월드 거리 기준으로 InOutDistance 갱신)
+    static bool IntersectComponent(const FComponentBounds& Entry, const FRay& Ray, float& InOutDistance);
 
-    // 액터와의 교차 검사
-    bool IntersectActor(const AActor* Actor, const FVector& RayOrigin, const FVector& RayDirection,
-                        float& OutDistance) const;
+    // AABB 교차 검사용 재귀 함수
+    void IntersectAABBNode(int NodeIndex, const FBound& QueryAABB, TArray<AActor*>& OutActors) const;
 
     // 상수
     static const int MaxActorsPerLeaf = 8;  // 리프당 최대 액터 수 (마이크로 BVH용)
@@ -0,0 +1,65 @@
+﻿#pragma once
+#include <cstdarg>
+#include <cstdio>
+#include "PickingTimer.h"
+
+// GlobalConsole.cpp (헤드리스 실행 파일은 자체 구현)
+extern "C" void ConsoleLogV(const char* fmt, va_list args);
+
+/**
+ * FBenchmark
+ * - 콘솔 BENCH 명령들이 공유하는 측정/출력 도우미
+ * - 시간은 FScopeCycleCounter로 재고, 결과는 "BENCH <이름> <항목> <시간> ms  <추가 정보>" 형식의 한 줄로 출력
+ * - UE_LOG 대신 ConsoleLogV로 출력하므로 pch 없이 컴파일하는 파일에서도 사용 가능
+ */
+class FBenchmark
+{
+public:
+    explicit FBenchmark(const char* InName) : Name(InName) {}
+
+    // Body를 한 번 실행하는 데 걸린 시간(ms)
+    template<typename TBody>
+    static double MeasureMs(TBody&& Body)
+    {
+        TStatId BenchmarkStatId;
+        FScopeCycleCounter BenchmarkTimer(BenchmarkStatId);
+        Body();
+        return FPlatformTime::ToMilliseconds(BenchmarkTimer.Finish());
+    }
+
+    // "BENCH <이름>: ..." (입력 크기, 검사 결과 등)
+    void LogInfo(const char* Format, ...) const
+    {
+        char Message[512];
+        va_list Args;
+        va_start(Args, Format);
+        vsnprintf(Message, sizeof(Message), Format, Args);
+        va_end(Args);
+        Print("BENCH %s: %s", Name, Message);
+    }
+
+    // "BENCH <이름> <항목> <시간> ms  <추가 정보>" (Format이 nullptr이면 시간만)
+    void LogResult(const char* Label, double Milliseconds, const char* Format = nullptr, ...) const
+    {
+        char Extra[512] = "";
+        if (Format)
+        {
+            va_list Args;
+            va_start(Args, Format);
+            vsnprintf(Extra, sizeof(Extra), Format, Args);
+            va_end(Args);
+        }
+        Print("BENCH %s %-24s %9.3f ms  %s", Name, Label, Milliseconds, Extra);
+    }
+
+private:
+    static void Print(const char* Format, ...)
+    {
+        va_list Args;
+        va_start(Args, Format);
+        ConsoleLogV(Format, Args);
+        va_end(Args);
+    }
+
+    const char* Name;
+};
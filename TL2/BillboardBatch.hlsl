@@ -0,0 +1,39 @@
+// 빌보드 배치: 정점은 CPU(FBillboardBatcher)에서 카메라를 향하도록 펼친 월드 좌표, UV도 코너별로 계산되어 들어옴
+cbuffer ViewProjBuffer : register(b1)
+{
+    row_major float4x4 ViewMatrix;
+    row_major float4x4 ProjectionMatrix;
+}
+
+struct VS_INPUT
+{
+    float3 WorldPos : WORLDPOSITION;
+    float2 Size : SIZE;
+    float4 UVRect : UVRECT; // xy: 이 코너의 UV, zw: 영역 크기 (미사용)
+};
+
+struct PS_INPUT
+{
+    float4 PosScreenspace : SV_POSITION;
+    float2 Tex : TEXCOORD0;
+};
+
+Texture2D SpriteTexture : register(t0);
+SamplerState LinearSampler : register(s0);
+
+PS_INPUT mainVS(VS_INPUT Input)
+{
+    PS_INPUT Output;
+    Output.PosScreenspace = mul(mul(float4(Input.WorldPos, 1.0f), ViewMatrix), ProjectionMatrix);
+    Output.Tex = Input.UVRect.xy;
+    return Output;
+}
+
+float4 mainPS(PS_INPUT Input) : SV_Target
+{
+    float4 Color = SpriteTexture.Sample(LinearSampler, Input.Tex);
+
+    clip(Color.a - 0.5f); // alpha - 0.5f < 0 이면 해당픽셀 렌더링 중단
+
+    return Color;
+}
@@ -0,0 +1,225 @@
+﻿#include "pch.h"
+#include "BillboardBatcher.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "Frustum.h"
+#include "AABoundingBoxComponent.h"
+#include "RenderingStats.h"
+
+void FBillboardBatcher::Release()
+{
+	VertexRing.Release();
+	if (QuadIndexBuffer)
+	{
+		QuadIndexBuffer->Release();
+		QuadIndexBuffer = nullptr;
+	}
+	Shader = nullptr;
+	Sprites.clear();
+	Prepared.clear();
+}
+
+void FBillboardBatcher::Add(const FBillboardSprite& Sprite)
+{
+	if (Sprite.Texture && Sprite.Texture->GetShaderResourceView())
+	{
+		Sprites.Add(Sprite);
+	}
+}
+
+bool FBillboardBatcher::EnsureResources(ID3D11Device* Device)
+{
+	if (!Shader)
+	{
+		Shader = UResourceManager::GetInstance().Load<UShader>("BillboardBatch.hlsl");
+		if (!Shader)
+		{
+			return false;
+		}
+	}
+
+	if (!QuadIndexBuffer)
+	{
+		TArray<uint32> Indices;
+		Indices.Reserve(static_cast<int32>(MaxQuadsPerDraw * 6));
+		for (uint32 i = 0; i < MaxQuadsPerDraw; i++)
+		{
+			Indices.push_back(i * 4 + 0);
+			Indices.push_back(i * 4 + 1);
+			Indices.push_back(i * 4 + 2);
+
+			Indices.push_back(i * 4 + 2);
+			Indices.push_back(i * 4 + 1);
+			Indices.push_back(i * 4 + 3);
+		}
+
+		D3D11_BUFFER_DESC Desc = {};
+		Desc.ByteWidth = static_cast<UINT>(sizeof(uint32) * Indices.size());
+		Desc.Usage = D3D11_USAGE_IMMUTABLE;
+		Desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+
+		D3D11_SUBRESOURCE_DATA InitData = {};
+		InitData.pSysMem = Indices.data();
+
+		if (FAILED(Device->CreateBuffer(&Desc, &InitData, &QuadIndexBuffer)))
+		{
+			UE_LOG("FBillboardBatcher: 인덱스 버퍼 생성 실패");
+			QuadIndexBuffer = nullptr;
+			return false;
+		}
+	}
+
+	// 한 드로우 분량의 두 배: 같은 프레임의 이전 드로우가 읽는 영역을 덮기 전에 한 바퀴 돌도록
+	const uint32 RingBytes = MaxQuadsPerDraw * 4 * sizeof(FBillboardVertexInfo_GPU) * 2;
+	return VertexRing.IsInitialized() || VertexRing.Initialize(Device, RingBytes, D3D11_BIND_VERTEX_BUFFER);
+}
+
+void FBillboardBatcher::Flush(URenderer* Renderer, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix)
+{
+	if (Sprites.IsEmpty())
+	{
+		return;
+	}
+
+	URHIDevice* RHIDevice = Renderer->GetRHIDevice();
+	if (!EnsureResources(RHIDevice->GetDevice()))
+	{
+		Sprites.clear();
+		return;
+	}
+	ID3D11DeviceContext* Context = RHIDevice->GetDeviceContext();
+
+	const FMatrix ViewProj = ViewMatrix * ProjMatrix;
+	FFrustum Frustum;
+	Frustum.Update(ViewProj);
+
+	// 화면 크기 스케일에 쓰는 줌 (UE와 동일하게 투영 행렬 대각 성분 중 작은 쪽)
+	const float Zoom = std::min(ProjMatrix.M[0][0], ProjMatrix.M[1][1]);
+
+	// 1. 화면 크기 스케일 적용 + 절두체 컬링
+	Prepared.clear();
+	Prepared.Reserve(Sprites.Num());
+	for (const FBillboardSprite& Sprite : Sprites)
+	{
+		float Scale = 1.0f;
+		if (Sprite.ScreenSize > 0.0f && Zoom > 0.0f && Sprite.Height > 0.0f)
+		{
+			const FVector& P = Sprite.Position;
+			const float ClipW = P.X * ViewProj.M[0][3] + P.Y * ViewProj.M[1][3] + P.Z * ViewProj.M[2][3] + ViewProj.M[3][3];
+			const float PixelHeight = static_cast<float>(Sprite.Texture->GetHeight()) * Sprite.VL;
+			if (ClipW > 0.0f && PixelHeight > 0.0f)
+			{
+				// 가까울 때는 화면 크기 고정, 멀어져 월드 크기보다 작아지면 원래 월드 크기 사용
+				Scale = std::min(1.0f, ClipW * Sprite.ScreenSize * PixelHeight / (Zoom * Sprite.Height));
+			}
+		}
+
+		const float HalfWidth = Sprite.Width * Scale * 0.5f;
+		const float HalfHeight = Sprite.Height * Scale * 0.5f;
+
+		// 카메라를 향해 어느 방향으로 돌아도 쿼드를 감싸는 박스
+		const float Radius = std::sqrt(HalfWidth * HalfWidth + HalfHeight * HalfHeight);
+		const FVector Extent(Radius, Radius, Radius);
+		FBound Box(Sprite.Position - Extent, Sprite.Position + Extent);
+		if (!Frustum.IsVisible(Box))
+		{
+			continue;
+		}
+
+		Prepared.Add({ Sprite.Position, HalfWidth, HalfHeight, Sprite.U, Sprite.V, Sprite.UL, Sprite.VL, Sprite.Texture });
+	}
+	Sprites.clear();
+
+	if (Prepared.IsEmpty())
+	{
+		return;
+	}
+
+	// 카메라 오른쪽/위 축 (뷰 역행렬의 0, 1행 = 기존 Billboard.hlsl의 viewInverse 회전)
+	const FMatrix InvView = ViewMatrix.InverseAffine();
+	const __m128 CamRight = _mm_setr_ps(InvView.M[0][0], InvView.M[0][1], InvView.M[0][2], 0.0f);
+	const __m128 CamUp = _mm_setr_ps(InvView.M[1][0], InvView.M[1][1], InvView.M[1][2], 0.0f);
+
+	Renderer->UpdateConstantBuffer(FMatrix::Identity(), ViewMatrix, ProjMatrix);
+	Renderer->PrepareShader(Shader);
+	Renderer->RSSetState(EViewModeIndex::VMI_Unlit);
+
+	const UINT Stride = sizeof(FBillboardVertexInfo_GPU);
+	ID3D11Buffer* VertexBuffer = VertexRing.GetBuffer();
+	UINT Offset = 0;
+	Context->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
+	Context->IASetIndexBuffer(QuadIndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+	Context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	RHIDevice->PSSetDefaultSampler(0);
+
+	URenderingStatsCollector& StatsCollector = URenderingStatsCollector::GetInstance();
+
+	// 2. 같은 텍스처가 이어지는 구간마다 MaxQuadsPerDraw 단위로 쿼드를 링에 펼쳐 쓰고 드로우
+	for (int32 Begin = 0; Begin < Prepared.Num();)
+	{
+		UTexture* Texture = Prepared[Begin].Texture;
+		int32 End = Begin + 1;
+		while (End < Prepared.Num() && Prepared[End].Texture == Texture)
+		{
+			++End;
+		}
+
+		ID3D11ShaderResourceView* TextureSRV = Texture->GetShaderResourceView();
+		Context->PSSetShaderResources(0, 1, &TextureSRV);
+		StatsCollector.IncrementTextureChanges();
+
+		while (Begin < End)
+		{
+			const uint32 NumQuads = std::min(static_cast<uint32>(End - Begin), MaxQuadsPerDraw);
+			uint32 ByteOffset = 0;
+			uint8* Dest = VertexRing.BeginWrite(Context, NumQuads * 4 * Stride, Stride, ByteOffset);
+			if (!Dest)
+			{
+				Begin = End;
+				break;
+			}
+
+			for (uint32 i = 0; i < NumQuads; ++i)
+			{
+				const FPreparedSprite& Sprite = Prepared[Begin + i];
+
+				const __m128 Center = _mm_setr_ps(Sprite.Position.X, Sprite.Position.Y, Sprite.Position.Z, 0.0f);
+				const __m128 HalfRight = _mm_mul_ps(CamRight, _mm_set1_ps(Sprite.HalfWidth));
+				const __m128 HalfUp = _mm_mul_ps(CamUp, _mm_set1_ps(Sprite.HalfHeight));
+				const __m128 Top = _mm_add_ps(Center, HalfUp);
+				const __m128 Bottom = _mm_sub_ps(Center, HalfUp);
+
+				// 0=좌상단, 1=우상단, 2=좌하단, 3=우하단 (인덱스 패턴 0,1,2, 2,1,3)
+				alignas(16) float Corners[4][4];
+				_mm_store_ps(Corners[0], _mm_sub_ps(Top, HalfRight));
+				_mm_store_ps(Corners[1], _mm_add_ps(Top, HalfRight));
+				_mm_store_ps(Corners[2], _mm_sub_ps(Bottom, HalfRight));
+				_mm_store_ps(Corners[3], _mm_add_ps(Bottom, HalfRight));
+
+				FBillboardVertexInfo_GPU Quad[4];
+				for (int32 c = 0; c < 4; ++c)
+				{
+					Quad[c].Position[0] = Corners[c][0];
+					Quad[c].Position[1] = Corners[c][1];
+					Quad[c].Position[2] = Corners[c][2];
+					Quad[c].CharSize[0] = Sprite.HalfWidth * 2.0f;
+					Quad[c].CharSize[1] = Sprite.HalfHeight * 2.0f;
+					Quad[c].UVRect[0] = Sprite.U + ((c & 1) ? Sprite.UL : 0.0f);
+					Quad[c].UVRect[1] = Sprite.V + ((c & 2) ? Sprite.VL : 0.0f);
+					Quad[c].UVRect[2] = Sprite.UL;
+					Quad[c].UVRect[3] = Sprite.VL;
+				}
+
+				// 매핑된 메모리에는 쿼드 단위로 순차 기록
+				std::memcpy(Dest + i * sizeof(Quad), Quad, sizeof(Quad));
+			}
+			VertexRing.EndWrite(Context, NumQuads * 4 * Stride);
+
+			Context->DrawIndexed(NumQuads * 6, 0, static_cast<INT>(ByteOffset / Stride));
+			StatsCollector.IncrementDrawCalls();
+			Begin += NumQuads;
+		}
+	}
+
+	Prepared.clear();
+}
@@ -0,0 +1,74 @@
+﻿#pragma once
+#include "DynamicRingBuffer.h"
+#include "VertexData.h"
+
+class URenderer;
+class UTexture;
+class UShader;
+
+// 배처에 넣는 스프라이트 한 장 (월드 위치 중심, 카메라를 향하는 쿼드)
+struct FBillboardSprite
+{
+	FVector Position;
+	float Width = 1.0f;
+	float Height = 1.0f;
+
+	// 텍스처 내 영역 (U, V: 시작, UL, VL: 길이)
+	float U = 0.0f;
+	float V = 0.0f;
+	float UL = 1.0f;
+	float VL = 1.0f;
+
+	// 0보다 크면 화면 크기 기준 스케일 (UE 규약: 텍스처 영역 픽셀 수 * ScreenSize 만큼의 NDC 반폭, 월드 크기보다 커지지는 않음)
+	float ScreenSize = 0.0f;
+
+	UTexture* Texture = nullptr;
+};
+
+/**
+ * FBillboardBatcher
+ * - FTranslucentQueue가 뒤→앞으로 정렬해 넘긴 빌보드(빌보드 컴포넌트, 데칼/포그 에디터 아이콘)를
+ *   카메라를 향하는 쿼드로 SSE로 펼쳐 동적 버텍스 링 하나에 기록하고, 같은 텍스처가 이어지는 구간마다 드로우 1회로 그림
+ * - 순서를 바꾸지 않으며 블렌드 상태는 호출자가 설정
+ * - 정점은 월드 공간이므로 셰이더(BillboardBatch.hlsl)는 View/Projection만 사용
+ */
+class FBillboardBatcher
+{
+public:
+	FBillboardBatcher() = default;
+	~FBillboardBatcher() { Release(); }
+
+	FBillboardBatcher(const FBillboardBatcher&) = delete;
+	FBillboardBatcher& operator=(const FBillboardBatcher&) = delete;
+
+	void Release();
+
+	void Add(const FBillboardSprite& Sprite);
+	bool IsEmpty() const { return Sprites.IsEmpty(); }
+
+	// 절두체 밖 스프라이트를 버리고 Add 순서대로 드로우 (연속된 같은 텍스처는 한 드로우)
+	void Flush(URenderer* Renderer, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix);
+
+	// 한 드로우에 담는 최대 쿼드 수 (공유 인덱스 버퍼 크기)
+	static const uint32 MaxQuadsPerDraw = 16384;
+
+private:
+	// 화면 크기 스케일과 컬링을 마친 스프라이트
+	struct FPreparedSprite
+	{
+		FVector Position;
+		float HalfWidth;
+		float HalfHeight;
+		float U, V, UL, VL;
+		UTexture* Texture;
+	};
+
+	bool EnsureResources(ID3D11Device* Device);
+
+	TArray<FBillboardSprite> Sprites;
+	TArray<FPreparedSprite> Prepared;	// Flush 중 재사용
+
+	UShader* Shader = nullptr;
+	FDynamicRingBuffer VertexRing;
+	ID3D11Buffer* QuadIndexBuffer = nullptr;
+};
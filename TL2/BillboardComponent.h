@@ -11,6 +11,7 @@ protected:
     ~UBillboardComponent() override;
 
 public:
+    // 스프라이트를 렌더러의 FBillboardBatcher에 추가 (실제 드로우는 월드 패스의 Flush에서 텍스처별로 1회)
     void Render(URenderer* Renderer, const FMatrix& View, const FMatrix& Proj, FViewport* Viewport) override;
     
     // Size settings
@@ -35,19 +36,14 @@ public:
     void SetScreenSize(float Size) { ScreenSize = Size; }
     float GetScreenSize() const { return ScreenSize; }
 
-    UTextQuad* GetStaticMesh() const { return BillboardQuad; }
-
     UObject* Duplicate() override;
     UObject* Duplicate(FObjectDuplicationParameters Parameters) override;
     void DuplicateSubObjects() override;
 
 private:
-    void CreateBillboardVertices();
+    // TexturePath로 로드한 텍스처 캐시 (SetTexture 시 무효화)
+    UTexture* Texture = nullptr;
 
-private:
-    // [PIE] 주소 복사
-    UTextQuad* BillboardQuad = nullptr;
-    
     // Size properties
     // [PIE] 값 복사
     float BillboardWidth = 1.0f;
@@ -0,0 +1,430 @@
+﻿#include "pch.h"
+#include "ClusteredLightCulling.h"
+#include "TaskSystem.h"
+#include "Benchmark.h"
+#include <immintrin.h>
+#include <bit>
+#include <random>
+
+namespace
+{
+	// 라이트 전처리를 워커에 나눠 줄 때의 묶음 크기
+	constexpr int32 LightsPerTask = 1024;
+	// 타일 경계에 걸친 라이트가 부동소수 오차로 빠지지 않도록 NDC 범위를 살짝 넓힘
+	constexpr float TileEdgeEpsilon = 1e-4f;
+}
+
+FClusteredLightCulling::FClusteredLightCulling(uint32 InTilesX, uint32 InTilesY, uint32 InSlices)
+	: TilesX(InTilesX)
+	, TilesY(InTilesY)
+	, Slices(InSlices)
+	, NumTiles(InTilesX * InTilesY)
+	, RowStride((InTilesX + 3) & ~3u)
+{
+	Constants.TilesX = TilesX;
+	Constants.TilesY = TilesY;
+	Constants.Slices = Slices;
+
+	SliceBounds.resize(Slices);
+	for (FSliceBounds& Bounds : SliceBounds)
+	{
+		// 패딩 레인은 어떤 구와도 겹치지 않도록 뒤집힌 범위로 채움
+		const size_t NumPadded = static_cast<size_t>(RowStride) * TilesY;
+		Bounds.MinX.assign(NumPadded, FLT_MAX);
+		Bounds.MaxX.assign(NumPadded, -FLT_MAX);
+		Bounds.MinY.assign(NumPadded, FLT_MAX);
+		Bounds.MaxY.assign(NumPadded, -FLT_MAX);
+	}
+	SliceResults.resize(Slices);
+}
+
+void FClusteredLightCulling::Build(const TArray<FLightInfo>& Lights, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix, const FVector4& ViewportRect)
+{
+	UpdateClusterBounds(ProjMatrix);
+	Constants.ViewportRect = ViewportRect;
+
+	BinLights(Lights, ViewMatrix);
+
+	// 깊이 슬라이스마다 독립적으로 배정 (출력 버퍼를 공유하지 않으므로 잠금 없음)
+	FTaskSystem::GetInstance().ParallelFor(static_cast<int32>(Slices), [this](int32 Slice)
+	{
+		CullSlice(static_cast<uint32>(Slice));
+	});
+
+	// 슬라이스 결과를 하나의 인덱스 목록으로 이어 붙임
+	ClusterRanges.resize(static_cast<size_t>(NumTiles) * Slices);
+	size_t TotalIndices = 0;
+	for (const FSliceResult& Result : SliceResults)
+	{
+		TotalIndices += Result.Indices.size();
+	}
+	LightIndices.resize(TotalIndices);
+
+	uint32 SliceBase = 0;
+	NumOverflowClusters = 0;
+	for (uint32 Slice = 0; Slice < Slices; ++Slice)
+	{
+		const FSliceResult& Result = SliceResults[Slice];
+		FLightClusterRange* Ranges = ClusterRanges.data() + static_cast<size_t>(Slice) * NumTiles;
+		for (uint32 Tile = 0; Tile < NumTiles; ++Tile)
+		{
+			Ranges[Tile].Offset = SliceBase + Result.Offsets[Tile];
+			Ranges[Tile].Count = Result.Offsets[Tile + 1] - Result.Offsets[Tile];
+		}
+
+		if (!Result.Indices.empty())
+		{
+			std::memcpy(LightIndices.data() + SliceBase, Result.Indices.data(), Result.Indices.size() * sizeof(uint32));
+		}
+		SliceBase += static_cast<uint32>(Result.Indices.size());
+		NumOverflowClusters += Result.NumOverflow;
+	}
+}
+
+void FClusteredLightCulling::UpdateClusterBounds(const FMatrix& ProjMatrix)
+{
+	if (bBoundsValid && std::memcmp(&CachedProj, &ProjMatrix, sizeof(FMatrix)) == 0)
+	{
+		return;
+	}
+	CachedProj = ProjMatrix;
+	bBoundsValid = true;
+
+	const auto& P = ProjMatrix.M;
+	const bool bPerspective = std::fabs(P[2][3]) > 1e-6f;
+	Constants.bPerspective = bPerspective ? 1u : 0u;
+
+	// 행벡터 LH 투영에서 near/far 복원 (PerspectiveFovLH / OrthoLH 규약)
+	const float M22 = P[2][2];
+	const float M32 = P[3][2];
+	float NearZ = std::fabs(M22) > 1e-12f ? -M32 / M22 : 0.1f;
+	float FarZ = bPerspective
+		? (std::fabs(1.0f - M22) > 1e-12f ? M32 / (1.0f - M22) : NearZ * 1000.0f)
+		: (std::fabs(M22) > 1e-12f ? NearZ + 1.0f / M22 : NearZ + 1000.0f);
+
+	if (bPerspective)
+	{
+		NearZ = std::max(NearZ, 1e-3f);
+	}
+	FarZ = std::max(FarZ, NearZ + 1e-3f);
+
+	Constants.NearZ = NearZ;
+	Constants.FarZ = FarZ;
+	if (bPerspective)
+	{
+		// 원근: 지수 분할 (가까운 곳의 슬라이스를 얇게)
+		Constants.DepthScale = static_cast<float>(Slices) / std::log(FarZ / NearZ);
+		Constants.DepthBias = std::log(NearZ) * Constants.DepthScale;
+	}
+	else
+	{
+		Constants.DepthScale = static_cast<float>(Slices) / (FarZ - NearZ);
+		Constants.DepthBias = NearZ * Constants.DepthScale;
+	}
+
+	// NDC 타일 경계를 슬라이스 앞/뒤 깊이에서 뷰 공간으로 되돌려 AABB 구성
+	auto NdcToViewX = [&P](float NdcX, float Z) { return (NdcX * (Z * P[2][3] + P[3][3]) - Z * P[2][0] - P[3][0]) / P[0][0]; };
+	auto NdcToViewY = [&P](float NdcY, float Z) { return (NdcY * (Z * P[2][3] + P[3][3]) - Z * P[2][1] - P[3][1]) / P[1][1]; };
+
+	for (uint32 Slice = 0; Slice < Slices; ++Slice)
+	{
+		FSliceBounds& Bounds = SliceBounds[Slice];
+		const float Z0 = SliceDepth(Slice);
+		const float Z1 = SliceDepth(Slice + 1);
+		Bounds.MinZ = Z0;
+		Bounds.MaxZ = Z1;
+
+		for (uint32 TileY = 0; TileY < TilesY; ++TileY)
+		{
+			// 타일 행 0이 화면 위쪽 (NDC y = +1)
+			const float NdcTop = 1.0f - 2.0f * TileY / TilesY;
+			const float NdcBottom = 1.0f - 2.0f * (TileY + 1) / TilesY;
+			const float Ys[4] = { NdcToViewY(NdcTop, Z0), NdcToViewY(NdcTop, Z1), NdcToViewY(NdcBottom, Z0), NdcToViewY(NdcBottom, Z1) };
+			const float MinY = std::min(std::min(Ys[0], Ys[1]), std::min(Ys[2], Ys[3]));
+			const float MaxY = std::max(std::max(Ys[0], Ys[1]), std::max(Ys[2], Ys[3]));
+
+			for (uint32 TileX = 0; TileX < TilesX; ++TileX)
+			{
+				const float NdcLeft = -1.0f + 2.0f * TileX / TilesX;
+				const float NdcRight = -1.0f + 2.0f * (TileX + 1) / TilesX;
+				const float Xs[4] = { NdcToViewX(NdcLeft, Z0), NdcToViewX(NdcLeft, Z1), NdcToViewX(NdcRight, Z0), NdcToViewX(NdcRight, Z1) };
+
+				const size_t Index = static_cast<size_t>(TileY) * RowStride + TileX;
+				Bounds.MinX[Index] = std::min(std::min(Xs[0], Xs[1]), std::min(Xs[2], Xs[3]));
+				Bounds.MaxX[Index] = std::max(std::max(Xs[0], Xs[1]), std::max(Xs[2], Xs[3]));
+				Bounds.MinY[Index] = MinY;
+				Bounds.MaxY[Index] = MaxY;
+			}
+		}
+	}
+}
+
+float FClusteredLightCulling::SliceDepth(uint32 Slice) const
+{
+	const float T = static_cast<float>(Slice) / static_cast<float>(Slices);
+	if (Constants.bPerspective)
+	{
+		return Constants.NearZ * std::pow(Constants.FarZ / Constants.NearZ, T);
+	}
+	return Constants.NearZ + (Constants.FarZ - Constants.NearZ) * T;
+}
+
+int32 FClusteredLightCulling::DepthToSlice(float ViewZ) const
+{
+	const float Depth = Constants.bPerspective ? std::log(std::max(ViewZ, Constants.NearZ)) : ViewZ;
+	const int32 Slice = static_cast<int32>(std::floor(Depth * Constants.DepthScale - Constants.DepthBias));
+	return std::clamp(Slice, 0, static_cast<int32>(Slices) - 1);
+}
+
+bool FClusteredLightCulling::ViewToNdc(float X, float Y, float Z, float& OutNdcX, float& OutNdcY) const
+{
+	const auto& P = CachedProj.M;
+	const float W = X * P[0][3] + Y * P[1][3] + Z * P[2][3] + P[3][3];
+	if (W <= 1e-6f)
+	{
+		return false;
+	}
+	const float InvW = 1.0f / W;
+	OutNdcX = (X * P[0][0] + Y * P[1][0] + Z * P[2][0] + P[3][0]) * InvW;
+	OutNdcY = (X * P[0][1] + Y * P[1][1] + Z * P[2][1] + P[3][1]) * InvW;
+	return true;
+}
+
+void FClusteredLightCulling::BinLights(const TArray<FLightInfo>& Lights, const FMatrix& ViewMatrix)
+{
+	const int32 NumLights = static_cast<int32>(Lights.size());
+	CandidateBins.resize(NumLights);
+
+	const float NearZ = Constants.NearZ;
+	const float FarZ = Constants.FarZ;
+	const float FTilesX = static_cast<float>(TilesX);
+	const float FTilesY = static_cast<float>(TilesY);
+
+	const int32 NumTasks = (NumLights + LightsPerTask - 1) / LightsPerTask;
+	FTaskSystem::GetInstance().ParallelFor(NumTasks, [&](int32 Task)
+	{
+		const int32 Begin = Task * LightsPerTask;
+		const int32 End = std::min(Begin + LightsPerTask, NumLights);
+		for (int32 LightIndex = Begin; LightIndex < End; ++LightIndex)
+		{
+			const FLightInfo& Light = Lights[LightIndex];
+			FLightBin& Bin = CandidateBins[LightIndex];
+			Bin.Slice0 = 1;
+			Bin.Slice1 = 0;	// 기본은 화면 밖
+
+			const float Radius = Light.Radius;
+			const FVector Center = ViewMatrix.TransformPosition(Light.LightPos);
+			if (Radius <= 0.0f || Center.Z + Radius < NearZ || Center.Z - Radius > FarZ)
+			{
+				continue;
+			}
+
+			const float ZMin = std::max(Center.Z - Radius, NearZ);
+			const float ZMax = std::min(Center.Z + Radius, FarZ);
+
+			// 구를 감싸는 뷰 공간 박스의 모서리를 투영해 보수적인 화면 범위를 구함
+			float NdcMinX = FLT_MAX, NdcMaxX = -FLT_MAX, NdcMinY = FLT_MAX, NdcMaxY = -FLT_MAX;
+			for (int32 Corner = 0; Corner < 8; ++Corner)
+			{
+				const float X = (Corner & 1) ? Center.X + Radius : Center.X - Radius;
+				const float Y = (Corner & 2) ? Center.Y + Radius : Center.Y - Radius;
+				const float Z = (Corner & 4) ? ZMax : ZMin;
+				float NdcX, NdcY;
+				if (!ViewToNdc(X, Y, Z, NdcX, NdcY))
+				{
+					NdcMinX = NdcMinY = -1.0f;
+					NdcMaxX = NdcMaxY = 1.0f;
+					break;
+				}
+				NdcMinX = std::min(NdcMinX, NdcX);
+				NdcMaxX = std::max(NdcMaxX, NdcX);
+				NdcMinY = std::min(NdcMinY, NdcY);
+				NdcMaxY = std::max(NdcMaxY, NdcY);
+			}
+
+			if (NdcMaxX < -1.0f || NdcMinX > 1.0f || NdcMaxY < -1.0f || NdcMinY > 1.0f)
+			{
+				continue;
+			}
+
+			auto ToTile = [](float Value, float NumTilesOnAxis) -> uint16
+			{
+				const int32 Tile = static_cast<int32>(std::floor(Value * NumTilesOnAxis));
+				return static_cast<uint16>(std::clamp(Tile, 0, static_cast<int32>(NumTilesOnAxis) - 1));
+			};
+
+			Bin.CenterX = Center.X;
+			Bin.CenterY = Center.Y;
+			Bin.CenterZ = Center.Z;
+			Bin.RadiusSq = Radius * Radius;
+			Bin.LightIndex = static_cast<uint32>(LightIndex);
+			Bin.TileX0 = ToTile((NdcMinX + 1.0f) * 0.5f - TileEdgeEpsilon, FTilesX);
+			Bin.TileX1 = ToTile((NdcMaxX + 1.0f) * 0.5f + TileEdgeEpsilon, FTilesX);
+			Bin.TileY0 = ToTile((1.0f - NdcMaxY) * 0.5f - TileEdgeEpsilon, FTilesY);
+			Bin.TileY1 = ToTile((1.0f - NdcMinY) * 0.5f + TileEdgeEpsilon, FTilesY);
+			Bin.Slice0 = static_cast<uint16>(DepthToSlice(ZMin));
+			Bin.Slice1 = static_cast<uint16>(DepthToSlice(ZMax));
+		}
+	});
+
+	// 화면에 닿는 라이트만 남기고 인덱스를 업로드할 라이트 목록 기준으로 바꿈
+	Bins.clear();
+	VisibleLights.clear();
+	for (const FLightBin& Candidate : CandidateBins)
+	{
+		if (Candidate.Slice0 > Candidate.Slice1)
+		{
+			continue;
+		}
+		FLightBin& Bin = Bins.emplace_back(Candidate);
+		Bin.LightIndex = static_cast<uint32>(VisibleLights.size());
+		VisibleLights.push_back(Lights[Candidate.LightIndex]);
+	}
+}
+
+void FClusteredLightCulling::CullSlice(uint32 Slice)
+{
+	const FSliceBounds& Bounds = SliceBounds[Slice];
+	FSliceResult& Result = SliceResults[Slice];
+	Result.Hits.clear();
+	Result.NumOverflow = 0;
+
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128i LaneIndex = _mm_setr_epi32(0, 1, 2, 3);
+
+	for (const FLightBin& Bin : Bins)
+	{
+		if (Slice < Bin.Slice0 || Slice > Bin.Slice1)
+		{
+			continue;
+		}
+
+		// 슬라이스 깊이 방향 거리는 타일과 무관하므로 한 번만 계산
+		const float DistZ = std::max(std::max(Bounds.MinZ - Bin.CenterZ, Bin.CenterZ - Bounds.MaxZ), 0.0f);
+		const float Remaining = Bin.RadiusSq - DistZ * DistZ;
+		if (Remaining < 0.0f)
+		{
+			continue;
+		}
+
+		const __m128 CenterX = _mm_set1_ps(Bin.CenterX);
+		const __m128 CenterY = _mm_set1_ps(Bin.CenterY);
+		const __m128 RemainingSq = _mm_set1_ps(Remaining);
+		const __m128i FirstTile = _mm_set1_epi32(Bin.TileX0);
+		const __m128i LastTile = _mm_set1_epi32(Bin.TileX1);
+
+		for (uint32 TileY = Bin.TileY0; TileY <= Bin.TileY1; ++TileY)
+		{
+			const size_t Row = static_cast<size_t>(TileY) * RowStride;
+			for (uint32 TileX = Bin.TileX0 & ~3u; TileX <= Bin.TileX1; TileX += 4)
+			{
+				// 구-AABB 거리: 축마다 max(Min - C, C - Max, 0)의 제곱합을 4개 클러스터에 대해 한 번에
+				const __m128 DX = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&Bounds.MinX[Row + TileX]), CenterX),
+					_mm_sub_ps(CenterX, _mm_loadu_ps(&Bounds.MaxX[Row + TileX]))), Zero);
+				const __m128 DY = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&Bounds.MinY[Row + TileX]), CenterY),
+					_mm_sub_ps(CenterY, _mm_loadu_ps(&Bounds.MaxY[Row + TileX]))), Zero);
+				const __m128 DistSq = _mm_add_ps(_mm_mul_ps(DX, DX), _mm_mul_ps(DY, DY));
+
+				// 라이트의 타일 범위 밖 레인은 제외
+				const __m128i Lane = _mm_add_epi32(_mm_set1_epi32(static_cast<int32>(TileX)), LaneIndex);
+				const __m128i InRange = _mm_andnot_si128(
+					_mm_or_si128(_mm_cmplt_epi32(Lane, FirstTile), _mm_cmpgt_epi32(Lane, LastTile)),
+					_mm_set1_epi32(-1));
+
+				int32 Mask = _mm_movemask_ps(_mm_and_ps(_mm_cmple_ps(DistSq, RemainingSq), _mm_castsi128_ps(InRange)));
+				while (Mask)
+				{
+					const uint32 LaneBit = static_cast<uint32>(std::countr_zero(static_cast<uint32>(Mask)));
+					Mask &= Mask - 1;
+					const uint64 Tile = static_cast<uint64>(TileY) * TilesX + TileX + LaneBit;
+					Result.Hits.push_back((Tile << 32) | Bin.LightIndex);
+				}
+			}
+		}
+	}
+
+	// 타일별 카운팅 정렬 (라이트 순서대로 들어왔으므로 타일 안에서는 인덱스 오름차순 유지)
+	Result.Counts.assign(NumTiles, 0);
+	for (uint64 Hit : Result.Hits)
+	{
+		++Result.Counts[static_cast<uint32>(Hit >> 32)];
+	}
+
+	Result.Offsets.resize(NumTiles + 1);
+	uint32 Total = 0;
+	for (uint32 Tile = 0; Tile < NumTiles; ++Tile)
+	{
+		Result.Offsets[Tile] = Total;
+		if (Result.Counts[Tile] > MaxLightsPerCluster)
+		{
+			++Result.NumOverflow;
+		}
+		Total += std::min(Result.Counts[Tile], MaxLightsPerCluster);
+	}
+	Result.Offsets[NumTiles] = Total;
+
+	// 카운트 배열을 기록 커서로 재사용 (상한을 넘는 라이트는 버림)
+	Result.Indices.resize(Total);
+	std::fill(Result.Counts.begin(), Result.Counts.end(), 0u);
+	for (uint64 Hit : Result.Hits)
+	{
+		const uint32 Tile = static_cast<uint32>(Hit >> 32);
+		uint32& Cursor = Result.Counts[Tile];
+		if (Cursor < MaxLightsPerCluster)
+		{
+			Result.Indices[Result.Offsets[Tile] + Cursor++] = static_cast<uint32>(Hit);
+		}
+	}
+}
+
+void FClusteredLightCullingBenchmark::Run(int32 NumIterations)
+{
+	if (NumIterations <= 0)
+		return;
+
+	const FMatrix ViewMatrix = FMatrix::Identity();
+	const FMatrix ProjMatrix = FMatrix::PerspectiveFovLH(60.0f * (PI / 180.0f), 1920.0f / 1080.0f, 0.1f, 1000.0f);
+	const FVector4 ViewportRect(0.0f, 0.0f, 1920.0f, 1080.0f);
+	const FBenchmark Bench("LIGHTS");
+
+	// 크기마다 새 인스턴스를 써서 이전 크기의 버퍼 용량이 결과에 섞이지 않도록 함
+	for (int32 NumLights : { 1000, 10000, 50000 })
+	{
+		// 화면 폭보다 넓게, 카메라 뒤까지 흩어 놓아 화면 밖 라이트 제거 경로도 포함
+		std::mt19937 Random(12345);
+		std::uniform_real_distribution<float> PositionX(-600.0f, 600.0f);
+		std::uniform_real_distribution<float> PositionY(-300.0f, 300.0f);
+		std::uniform_real_distribution<float> PositionZ(-50.0f, 950.0f);
+		std::uniform_real_distribution<float> LightRadius(1.0f, 30.0f);
+
+		TArray<FLightInfo> Lights(NumLights);
+		for (FLightInfo& Light : Lights)
+		{
+			Light = FLightInfo{};
+			Light.Type = ELighType::Point;
+			Light.LightPos = FVector(PositionX(Random), PositionY(Random), PositionZ(Random));
+			Light.Radius = LightRadius(Random);
+			Light.Intensity = 1.0f;
+		}
+
+		// 첫 Build는 클러스터 AABB 계산과 버퍼 할당을 포함하므로 따로 측정
+		FClusteredLightCulling Culling;
+		const double FirstBuildMs = FBenchmark::MeasureMs([&]()
+		{
+			Culling.Build(Lights, ViewMatrix, ProjMatrix, ViewportRect);
+		});
+		const double TotalMs = FBenchmark::MeasureMs([&]()
+		{
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				Culling.Build(Lights, ViewMatrix, ProjMatrix, ViewportRect);
+			}
+		});
+
+		char Label[32];
+		snprintf(Label, sizeof(Label), "%d lights", NumLights);
+		Bench.LogResult(Label, TotalMs / NumIterations, "per build (first %8.3f ms)  %6d visible  %8d indices  %4u overflow clusters",
+			FirstBuildMs, static_cast<int32>(Culling.GetVisibleLights().size()), static_cast<int32>(Culling.GetLightIndices().size()),
+			Culling.GetNumOverflowClusters());
+	}
+}
@@ -0,0 +1,120 @@
+﻿#pragma once
+
+// 클러스터 하나가 참조하는 라이트 인덱스 구간 (HLSL Buffer<uint2> ClusterRanges와 같은 배치)
+struct FLightClusterRange
+{
+	uint32 Offset = 0;
+	uint32 Count = 0;
+};
+
+// HLSL LightClusterBuffer(b9)와 같은 배치
+struct FLightClusterConstants
+{
+	uint32 TilesX = 0;
+	uint32 TilesY = 0;
+	uint32 Slices = 0;
+	uint32 bPerspective = 1;
+
+	FVector4 ViewportRect;		// x, y, 너비, 높이 (렌더 타깃 픽셀)
+
+	float DepthScale = 0.0f;	// 슬라이스 = floor(f(ViewZ) * DepthScale - DepthBias), f = 원근이면 log, 직교면 선형
+	float DepthBias = 0.0f;
+	float NearZ = 0.0f;
+	float FarZ = 0.0f;
+};
+static_assert(sizeof(FLightClusterConstants) % 16 == 0, "LightClusterBuffer size mismatch!");
+
+/**
+ * FClusteredLightCulling
+ * - 뷰 프러스텀을 화면 타일 x 깊이 슬라이스(froxel)로 나누고 포인트 라이트를 클러스터에 배정
+ * - 라이트별 뷰 공간 구/타일 범위 계산 → 깊이 슬라이스마다 워커 스레드에서 SSE로 구-클러스터 AABB 4개씩 판정
+ * - 결과는 클러스터별 [Offset, Count]와 이를 이어 붙인 라이트 인덱스 목록 (픽셀 셰이더가 자기 클러스터만 순회)
+ * - 클러스터 AABB는 투영 행렬/해상도가 바뀔 때만 다시 계산
+ */
+class FClusteredLightCulling
+{
+public:
+	static constexpr uint32 DefaultTilesX = 16;
+	static constexpr uint32 DefaultTilesY = 9;
+	static constexpr uint32 DefaultSlices = 24;
+	// 클러스터 하나에 담을 최대 라이트 수 (넘치는 라이트는 인덱스 순으로 잘림)
+	static constexpr uint32 MaxLightsPerCluster = 128;
+
+	FClusteredLightCulling(uint32 InTilesX = DefaultTilesX, uint32 InTilesY = DefaultTilesY, uint32 InSlices = DefaultSlices);
+
+	void Build(const TArray<FLightInfo>& Lights, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix, const FVector4& ViewportRect);
+
+	// 화면에 닿는 라이트만 모은 목록 (LightIndices는 이 배열의 인덱스)
+	const TArray<FLightInfo>& GetVisibleLights() const { return VisibleLights; }
+	const TArray<FLightClusterRange>& GetClusterRanges() const { return ClusterRanges; }
+	const TArray<uint32>& GetLightIndices() const { return LightIndices; }
+	const FLightClusterConstants& GetConstants() const { return Constants; }
+
+	uint32 GetNumClusters() const { return NumTiles * Slices; }
+	uint32 GetNumOverflowClusters() const { return NumOverflowClusters; }
+
+private:
+	// 라이트 하나의 뷰 공간 구와 겹칠 수 있는 타일/슬라이스 범위
+	struct FLightBin
+	{
+		float CenterX, CenterY, CenterZ, RadiusSq;
+		uint32 LightIndex;
+		uint16 TileX0, TileX1, TileY0, TileY1;
+		uint16 Slice0, Slice1;
+	};
+
+	// 슬라이스 하나의 클러스터 AABB (타일 순서 SoA, 4개씩 SSE로 읽음)
+	struct FSliceBounds
+	{
+		TArray<float> MinX, MaxX, MinY, MaxY;
+		float MinZ = 0.0f;
+		float MaxZ = 0.0f;
+	};
+
+	// 슬라이스별 워커 출력 (다른 슬라이스와 공유하지 않음)
+	struct FSliceResult
+	{
+		TArray<uint64> Hits;		// (타일 << 32) | 라이트 인덱스
+		TArray<uint32> Counts;		// 타일별 라이트 수 (정렬 중에는 기록 커서)
+		TArray<uint32> Offsets;		// 타일별 Indices 시작 위치 (NumTiles + 1개)
+		TArray<uint32> Indices;		// 타일 순으로 정렬된 라이트 인덱스
+		uint32 NumOverflow = 0;
+	};
+
+	void UpdateClusterBounds(const FMatrix& ProjMatrix);
+	float SliceDepth(uint32 Slice) const;
+	int32 DepthToSlice(float ViewZ) const;
+	bool ViewToNdc(float X, float Y, float Z, float& OutNdcX, float& OutNdcY) const;
+	void BinLights(const TArray<FLightInfo>& Lights, const FMatrix& ViewMatrix);
+	void CullSlice(uint32 Slice);
+
+	uint32 TilesX;
+	uint32 TilesY;
+	uint32 Slices;
+	uint32 NumTiles;
+
+	FMatrix CachedProj;
+	bool bBoundsValid = false;
+	uint32 RowStride;			// 타일 행 하나의 SoA 폭 (TilesX를 4의 배수로 올림)
+
+	FLightClusterConstants Constants;
+	TArray<FSliceBounds> SliceBounds;
+	TArray<FLightBin> CandidateBins;	// 라이트 순서 그대로 (화면 밖이면 Slice0 > Slice1)
+	TArray<FLightBin> Bins;				// 화면에 닿는 라이트만
+	TArray<FSliceResult> SliceResults;
+
+	TArray<FLightInfo> VisibleLights;
+	TArray<FLightClusterRange> ClusterRanges;
+	TArray<uint32> LightIndices;
+	uint32 NumOverflowClusters = 0;
+};
+
+/**
+ * FClusteredLightCullingBenchmark
+ * - 고정 시드로 만든 포인트 라이트 1k/10k/50k개에 대해 Build 시간을 측정 (콘솔 BENCH LIGHTS)
+ * - 카메라는 원점에서 +Z를 보는 1920x1080 원근 뷰, 라이트 일부는 일부러 뷰 밖에 둠
+ */
+struct FClusteredLightCullingBenchmark
+{
+	static void Run(int32 NumIterations = 10);
+};
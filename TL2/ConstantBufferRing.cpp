@@ -0,0 +1,160 @@
+﻿#include "pch.h"
+#include "ConstantBufferRing.h"
+
+bool FConstantBufferRing::Initialize(ID3D11Device* Device, ID3D11DeviceContext* InDeviceContext, uint32 InCapacity)
+{
+	Release();
+
+	// 큰 상수 버퍼의 일부만 바인딩하고(ConstantBufferOffsetting) NO_OVERWRITE로 이어 쓰려면 둘 다 필요
+	D3D11_FEATURE_DATA_D3D11_OPTIONS Options = {};
+	if (FAILED(Device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &Options, sizeof(Options))) ||
+		!Options.ConstantBufferOffsetting || !Options.MapNoOverwriteOnDynamicConstantBuffer)
+	{
+		UE_LOG("FConstantBufferRing: constant buffer offsetting not supported, using per-buffer updates");
+		return false;
+	}
+
+	if (FAILED(InDeviceContext->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&DeviceContext1))))
+	{
+		DeviceContext1 = nullptr;
+		return false;
+	}
+
+	if (!Ring.Initialize(Device, AlignSize(InCapacity), D3D11_BIND_CONSTANT_BUFFER))
+	{
+		DeviceContext1->Release();
+		DeviceContext1 = nullptr;
+		return false;
+	}
+
+	DeviceContext = InDeviceContext;
+	FrameBytes = 0;
+	return true;
+}
+
+void FConstantBufferRing::Release()
+{
+	if (BatchData)
+	{
+		EndBatch();
+	}
+	Ring.Release();
+	if (DeviceContext1)
+	{
+		DeviceContext1->Release();
+		DeviceContext1 = nullptr;
+	}
+	DeviceContext = nullptr;
+	FrameBytes = 0;
+}
+
+void FConstantBufferRing::BeginFrame()
+{
+	if (BatchData)
+	{
+		EndBatch();
+	}
+	Ring.Rewind();
+	FrameBytes = 0;
+}
+
+bool FConstantBufferRing::BeginBatch(uint32 MaxBytes)
+{
+	if (!IsSupported() || BatchData || MaxBytes == 0)
+	{
+		return false;
+	}
+
+	MaxBytes = AlignSize(MaxBytes);
+	if (FrameBytes + MaxBytes > Ring.GetCapacity())
+	{
+		return false;
+	}
+
+	BatchData = Ring.BeginWrite(DeviceContext, MaxBytes, SliceAlignment, BatchOffset);
+	if (!BatchData)
+	{
+		return false;
+	}
+
+	BatchSize = MaxBytes;
+	BatchUsed = 0;
+	return true;
+}
+
+void FConstantBufferRing::EndBatch()
+{
+	if (!BatchData)
+	{
+		return;
+	}
+
+	Ring.EndWrite(DeviceContext, BatchUsed);
+	FrameBytes += BatchUsed;
+	BatchData = nullptr;
+	BatchSize = 0;
+	BatchUsed = 0;
+}
+
+bool FConstantBufferRing::Allocate(const void* Data, uint32 Size, FConstantSlice& OutSlice)
+{
+	if (!IsSupported() || Size == 0)
+	{
+		return false;
+	}
+
+	const uint32 AlignedSize = AlignSize(Size);
+	uint32 Offset = 0;
+
+	if (BatchData)
+	{
+		if (BatchUsed + AlignedSize > BatchSize)
+		{
+			return false;
+		}
+		std::memcpy(BatchData + BatchUsed, Data, Size);
+		Offset = BatchOffset + BatchUsed;
+		BatchUsed += AlignedSize;
+	}
+	else
+	{
+		if (FrameBytes + AlignedSize > Ring.GetCapacity())
+		{
+			return false;
+		}
+
+		uint8* Dest = Ring.BeginWrite(DeviceContext, AlignedSize, SliceAlignment, Offset);
+		if (!Dest)
+		{
+			return false;
+		}
+		std::memcpy(Dest, Data, Size);
+		Ring.EndWrite(DeviceContext, AlignedSize);
+		FrameBytes += AlignedSize;
+	}
+
+	OutSlice.FirstConstant = Offset / 16;
+	OutSlice.NumConstants = AlignedSize / 16;
+	return true;
+}
+
+void FConstantBufferRing::BindVS(uint32 Slot, const FConstantSlice& Slice)
+{
+	ID3D11Buffer* Buffer = Ring.GetBuffer();
+	DeviceContext1->VSSetConstantBuffers1(Slot, 1, &Buffer, &Slice.FirstConstant, &Slice.NumConstants);
+}
+
+void FConstantBufferRing::BindPS(uint32 Slot, const FConstantSlice& Slice)
+{
+	ID3D11Buffer* Buffer = Ring.GetBuffer();
+	DeviceContext1->PSSetConstantBuffers1(Slot, 1, &Buffer, &Slice.FirstConstant, &Slice.NumConstants);
+}
+
+FConstantUploadStats FConstantBufferRing::GetStats() const
+{
+	FConstantUploadStats Stats;
+	Stats.NumMaps = Ring.GetNumMaps();
+	Stats.NumUnmaps = Ring.GetNumMaps();	// Map마다 정확히 한 번 Unmap
+	Stats.BytesUploaded = Ring.GetBytesUploaded();
+	return Stats;
+}
@@ -0,0 +1,76 @@
+﻿#pragma once
+#include <d3d11_1.h>
+#include "DynamicRingBuffer.h"
+
+// 링 안의 상수 영역 (VSSetConstantBuffers1에 그대로 넘기는 상수(16바이트) 단위 오프셋/개수)
+struct FConstantSlice
+{
+	uint32 FirstConstant = 0;
+	uint32 NumConstants = 0;
+};
+
+// 프레임 동안 상수 버퍼 갱신에 든 Map/Unmap 횟수와 업로드 바이트
+struct FConstantUploadStats
+{
+	uint32 NumMaps = 0;
+	uint32 NumUnmaps = 0;
+	uint64 BytesUploaded = 0;
+};
+
+/**
+ * FConstantBufferRing
+ * - 프레임 단위로 선형 하위 할당하는 큰 동적 상수 버퍼 (256바이트 슬라이스, D3D11.1 오프셋 바인딩)
+ * - 드로우마다 작은 상수 버퍼를 DISCARD로 갱신하는 대신 슬라이스를 이어 쓰고 오프셋만 바인딩
+ * - BeginBatch/EndBatch 사이의 Allocate는 Map 한 번에 모아 기록됨
+ * - 프레임 안에서는 되감지 않음 (이미 바인딩된 슬라이스를 덮어쓰지 않도록). 용량이 부족하면 Allocate가 실패하고
+ *   호출자는 기존 개별 상수 버퍼 경로를 사용
+ */
+class FConstantBufferRing
+{
+public:
+	// VSSetConstantBuffers1의 오프셋/개수는 16상수(256바이트) 배수여야 함
+	static constexpr uint32 SliceAlignment = 256;
+
+	FConstantBufferRing() = default;
+	~FConstantBufferRing() { Release(); }
+
+	FConstantBufferRing(const FConstantBufferRing&) = delete;
+	FConstantBufferRing& operator=(const FConstantBufferRing&) = delete;
+
+	// 런타임/드라이버가 상수 버퍼 오프셋 바인딩을 지원하지 않으면 false (IsSupported도 false)
+	bool Initialize(ID3D11Device* Device, ID3D11DeviceContext* InDeviceContext, uint32 InCapacity);
+	void Release();
+
+	bool IsSupported() const { return DeviceContext1 != nullptr && Ring.IsInitialized(); }
+
+	// 프레임 시작: 다음 기록부터 버퍼를 DISCARD하고 처음부터 다시 채움
+	void BeginFrame();
+
+	// MaxBytes까지 한 번의 Map으로 기록 시작 (남은 용량이 부족하면 false)
+	bool BeginBatch(uint32 MaxBytes);
+	void EndBatch();
+	bool IsBatching() const { return BatchData != nullptr; }
+
+	// Data를 슬라이스 하나에 기록 (배치 중이면 매핑된 영역에, 아니면 단건 Map/Unmap)
+	bool Allocate(const void* Data, uint32 Size, FConstantSlice& OutSlice);
+
+	void BindVS(uint32 Slot, const FConstantSlice& Slice);
+	void BindPS(uint32 Slot, const FConstantSlice& Slice);
+
+	static uint32 AlignSize(uint32 Size) { return (Size + (SliceAlignment - 1)) & ~(SliceAlignment - 1); }
+
+	FConstantUploadStats GetStats() const;
+	void ResetStats() { Ring.ResetStats(); }
+
+private:
+	FDynamicRingBuffer Ring;
+	ID3D11DeviceContext* DeviceContext = nullptr;
+	ID3D11DeviceContext1* DeviceContext1 = nullptr;
+
+	uint32 FrameBytes = 0;		// 이번 프레임에 사용한 바이트 (Capacity를 넘기면 실패)
+
+	uint8* BatchData = nullptr;
+	uint32 BatchOffset = 0;
+	uint32 BatchSize = 0;
+	uint32 BatchUsed = 0;
+};
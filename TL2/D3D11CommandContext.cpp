@@ -0,0 +1,157 @@
+﻿#include "pch.h"
+#include "D3D11CommandContext.h"
+#include "Shader.h"
+
+namespace
+{
+	D3D11_PRIMITIVE_TOPOLOGY ToD3D11Topology(ERHIPrimitiveTopology Topology)
+	{
+		switch (Topology)
+		{
+		case ERHIPrimitiveTopology::TriangleList:
+			return D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+		case ERHIPrimitiveTopology::TriangleStrip:
+			return D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
+		case ERHIPrimitiveTopology::LineList:
+			return D3D11_PRIMITIVE_TOPOLOGY_LINELIST;
+		case ERHIPrimitiveTopology::LineStrip:
+			return D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP;
+		case ERHIPrimitiveTopology::PointList:
+			return D3D11_PRIMITIVE_TOPOLOGY_POINTLIST;
+		default:
+			return D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+		}
+	}
+}
+
+void FD3D11CommandContext::SetShader(FRHIShaderHandle ShaderHandle)
+{
+	UShader* Shader = static_cast<UShader*>(ShaderHandle.Resource);
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	DeviceContext->VSSetShader(Shader->GetVertexShader(), nullptr, 0);
+	DeviceContext->PSSetShader(Shader->GetPixelShader(), nullptr, 0);
+	DeviceContext->IASetInputLayout(Shader->GetInputLayout());
+}
+
+void FD3D11CommandContext::SetVertexIndexBuffers(FRHIBufferHandle VertexBufferHandle, FRHIBufferHandle IndexBufferHandle, uint32 Stride)
+{
+	ID3D11Buffer* VertexBuffer = static_cast<ID3D11Buffer*>(VertexBufferHandle.Resource);
+	ID3D11Buffer* IndexBuffer = static_cast<ID3D11Buffer*>(IndexBufferHandle.Resource);
+	UINT Offset = 0;
+	RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
+	RHIDevice->GetDeviceContext()->IASetIndexBuffer(IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+}
+
+void FD3D11CommandContext::SetPrimitiveTopology(ERHIPrimitiveTopology Topology)
+{
+	RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(ToD3D11Topology(Topology));
+}
+
+void FD3D11CommandContext::SetDefaultSampler(uint32 Slot)
+{
+	RHIDevice->PSSetDefaultSampler(Slot);
+}
+
+void FD3D11CommandContext::SetShaderResource(uint32 Slot, FRHITextureHandle Texture)
+{
+	ID3D11ShaderResourceView* ShaderResourceView = static_cast<ID3D11ShaderResourceView*>(Texture.Resource);
+	RHIDevice->GetDeviceContext()->PSSetShaderResources(Slot, 1, &ShaderResourceView);
+}
+
+void FD3D11CommandContext::SetPixelConstants(const FObjMaterialInfo* MaterialInfo, bool bHasTexture)
+{
+	static const FObjMaterialInfo DefaultMaterialInfo;
+	RHIDevice->UpdatePixelConstantBuffers(MaterialInfo ? *MaterialInfo : DefaultMaterialInfo, MaterialInfo != nullptr, bHasTexture); // PSSet도 해줌
+}
+
+void FD3D11CommandContext::StageObjectConstants(std::span<const FMatrix> WorldMatrices, std::span<const FRHIHighlightConstants> Highlights)
+{
+	bObjectConstantsStaged = false;
+
+	D3D11RHI* D3D11Device = static_cast<D3D11RHI*>(RHIDevice);
+	const uint32 NumSlices = static_cast<uint32>(WorldMatrices.size() + Highlights.size());
+	if (NumSlices == 0 || !D3D11Device->IsConstantRingEnabled())
+	{
+		return;
+	}
+
+	// 리스트 전체의 오브젝트 상수를 Map 한 번으로 기록 (드로우 중에는 오프셋만 바인딩)
+	if (!D3D11Device->BeginConstantBatch(NumSlices * FConstantBufferRing::SliceAlignment))
+	{
+		return;
+	}
+
+	WorldSlices.SetNum(static_cast<int32>(WorldMatrices.size()));
+	HighlightSlices.SetNum(static_cast<int32>(Highlights.size()));
+
+	bool bSucceeded = true;
+	for (size_t Index = 0; Index < WorldMatrices.size() && bSucceeded; ++Index)
+	{
+		bSucceeded = D3D11Device->AllocateModelConstants(WorldMatrices[Index], WorldSlices[Index]);
+	}
+	for (size_t Index = 0; Index < Highlights.size() && bSucceeded; ++Index)
+	{
+		const FRHIHighlightConstants& Highlight = Highlights[Index];
+		bSucceeded = D3D11Device->AllocateHighLightConstants(Highlight.Picked, Highlight.Color, Highlight.X, Highlight.Y, Highlight.Z, Highlight.Gizmo, HighlightSlices[Index]);
+	}
+
+	D3D11Device->EndConstantBatch();
+	bObjectConstantsStaged = bSucceeded;
+}
+
+void FD3D11CommandContext::SetObjectConstants(uint32 ConstantIndex, const FMatrix& WorldMatrix, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix)
+{
+	if (bObjectConstantsStaged)
+	{
+		D3D11RHI* D3D11Device = static_cast<D3D11RHI*>(RHIDevice);
+		D3D11Device->UpdateViewConstantBuffers(ViewMatrix, ProjMatrix); // 뷰/투영이 바뀔 때만 갱신됨
+		D3D11Device->BindModelConstants(WorldSlices[ConstantIndex]);
+		return;
+	}
+	RHIDevice->UpdateConstantBuffers(WorldMatrix, ViewMatrix, ProjMatrix);
+}
+
+void FD3D11CommandContext::SetHighlightConstants(uint32 ConstantIndex, const FRHIHighlightConstants& Constants)
+{
+	if (bObjectConstantsStaged)
+	{
+		static_cast<D3D11RHI*>(RHIDevice)->BindHighLightConstants(HighlightSlices[ConstantIndex]);
+		return;
+	}
+	RHIDevice->UpdateHighLightConstantBuffers(Constants.Picked, Constants.Color, Constants.X, Constants.Y, Constants.Z, Constants.Gizmo);
+}
+
+void FD3D11CommandContext::SetInstanceData(const FMatrix* WorldMatrices, uint32 NumInstances)
+{
+	if (!InstanceBuffer.IsInitialized())
+	{
+		InstanceBuffer.Initialize(RHIDevice->GetDevice(), InstanceBufferCapacity * sizeof(FMatrix), D3D11_BIND_VERTEX_BUFFER);
+	}
+
+	uint32 Offset = 0;
+	bInstanceDataValid = InstanceBuffer.Upload(RHIDevice->GetDeviceContext(), WorldMatrices, NumInstances * sizeof(FMatrix), sizeof(FMatrix), Offset);
+	if (!bInstanceDataValid)
+	{
+		return;
+	}
+
+	ID3D11Buffer* Buffer = InstanceBuffer.GetBuffer();
+	UINT Stride = sizeof(FMatrix);
+	UINT BufferOffset = Offset;
+	RHIDevice->GetDeviceContext()->IASetVertexBuffers(1, 1, &Buffer, &Stride, &BufferOffset);
+}
+
+void FD3D11CommandContext::DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex)
+{
+	RHIDevice->GetDeviceContext()->DrawIndexed(IndexCount, StartIndex, BaseVertex);
+}
+
+void FD3D11CommandContext::DrawIndexedInstanced(uint32 IndexCount, uint32 StartIndex, uint32 NumInstances)
+{
+	// 인스턴스 데이터 업로드에 실패했다면 잘못된 행렬로 그리지 않음
+	if (!bInstanceDataValid)
+	{
+		return;
+	}
+	RHIDevice->GetDeviceContext()->DrawIndexedInstanced(IndexCount, NumInstances, StartIndex, 0, 0);
+}
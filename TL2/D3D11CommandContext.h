@@ -0,0 +1,46 @@
+﻿#pragma once
+#include "RHICommandList.h"
+#include "DynamicRingBuffer.h"
+#include "ConstantBufferRing.h"
+
+class URHIDevice;
+class UShader;
+
+// 기록된 RHI 커맨드를 D3D11 디바이스 컨텍스트에 실행
+// - 핸들에는 UShader*/ID3D11Buffer*/ID3D11ShaderResourceView*가 담기며, 만들고 푸는 일은 이 클래스만 한다
+class FD3D11CommandContext : public IRHICommandContext
+{
+public:
+	explicit FD3D11CommandContext(URHIDevice* InRHIDevice) : RHIDevice(InRHIDevice) {}
+
+	static FRHIShaderHandle MakeShaderHandle(UShader* Shader) { return FRHIShaderHandle(Shader); }
+	static UShader* GetShader(FRHIShaderHandle Shader) { return static_cast<UShader*>(Shader.Resource); }
+	static FRHIBufferHandle MakeBufferHandle(ID3D11Buffer* Buffer) { return FRHIBufferHandle(Buffer); }
+	static FRHITextureHandle MakeTextureHandle(ID3D11ShaderResourceView* ShaderResourceView) { return FRHITextureHandle(ShaderResourceView); }
+
+	void SetShader(FRHIShaderHandle Shader) override;
+	void SetVertexIndexBuffers(FRHIBufferHandle VertexBuffer, FRHIBufferHandle IndexBuffer, uint32 Stride) override;
+	void SetPrimitiveTopology(ERHIPrimitiveTopology Topology) override;
+	void SetDefaultSampler(uint32 Slot) override;
+	void SetShaderResource(uint32 Slot, FRHITextureHandle Texture) override;
+	void SetPixelConstants(const FObjMaterialInfo* MaterialInfo, bool bHasTexture) override;
+	void StageObjectConstants(std::span<const FMatrix> WorldMatrices, std::span<const FRHIHighlightConstants> Highlights) override;
+	void SetObjectConstants(uint32 ConstantIndex, const FMatrix& WorldMatrix, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix) override;
+	void SetHighlightConstants(uint32 ConstantIndex, const FRHIHighlightConstants& Constants) override;
+	void SetInstanceData(const FMatrix* WorldMatrices, uint32 NumInstances) override;
+	void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) override;
+	void DrawIndexedInstanced(uint32 IndexCount, uint32 StartIndex, uint32 NumInstances) override;
+
+	// 인스턴스 버퍼 한 번에 담을 수 있는 최대 인스턴스 수
+	static constexpr uint32 InstanceBufferCapacity = 64 * 1024;
+
+private:
+	URHIDevice* RHIDevice;
+	FDynamicRingBuffer InstanceBuffer;	// 프레임마다 인스턴스 월드 행렬을 이어 쓰는 링 (슬롯 1)
+	bool bInstanceDataValid = false;
+
+	// StageObjectConstants로 상수 링에 올린 슬라이스 (실패 시 개별 상수 버퍼 갱신으로 폴백)
+	TArray<FConstantSlice> WorldSlices;
+	TArray<FConstantSlice> HighlightSlices;
+	bool bObjectConstantsStaged = false;
+};
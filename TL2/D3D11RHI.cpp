@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "UI/StatsOverlayD2D.h"
+#include "ClusteredLightCulling.h"
 
 struct FConstants
 {
@@ -91,6 +92,7 @@ void D3D11RHI::Initialize(HWND hWindow)
     CreateRasterizerState();
     CreateBlendState();
     CreateConstantBuffer();
+    ConstantRing.Initialize(Device, DeviceContext, ConstantRingCapacity);
 	CreateDepthStencilState();
 	CreateSamplerState();
     CreateMirrorSamplerState();
@@ -120,19 +122,23 @@ void D3D11RHI::Release()
     ReleaseSamplerState();
 
     // 상수버퍼
+    ConstantRing.Release();
     if (HighLightCB) { HighLightCB->Release(); HighLightCB = nullptr; }
     if (ModelCB) { ModelCB->Release(); ModelCB = nullptr; }
     if (ColorCB) { ColorCB->Release(); ColorCB = nullptr; }
     if (ViewProjCB) { ViewProjCB->Release(); ViewProjCB = nullptr; }
     if (BillboardCB) { BillboardCB->Release(); BillboardCB = nullptr; }
     if (PixelConstCB) { PixelConstCB->Release(); PixelConstCB = nullptr; }
-    if (LightCB) { LightCB->Release(); LightCB = nullptr; }
     if (UVScrollCB) { UVScrollCB->Release(); UVScrollCB = nullptr; }
     if (InvWorldCB) { InvWorldCB->Release(); InvWorldCB = nullptr; }
     if (ViewportCB) { ViewportCB->Release(); ViewportCB = nullptr; }
     if (ConstantBuffer) { ConstantBuffer->Release(); ConstantBuffer = nullptr; }
     if (FXAACB) { FXAACB->Release(); FXAACB = nullptr; }
     if (HeatCB) { HeatCB->Release(); HeatCB = nullptr; }
+    if (LightClusterCB) { LightClusterCB->Release(); LightClusterCB = nullptr; }
+    ClusterLightBuffer.Release();
+    ClusterRangeBuffer.Release();
+    ClusterIndexBuffer.Release();
     if (DepthVisualizationCB) { DepthVisualizationCB->Release(); DepthVisualizationCB = nullptr; }
 	if (CameraNearFarCB) { CameraNearFarCB->Release(); CameraNearFarCB = nullptr; }
 	if (FogParameterCB) { FogParameterCB->Release(); FogParameterCB = nullptr; }
@@ -323,6 +329,7 @@ void D3D11RHI::UpdateViewConstantBuffers(const FMatrix& ViewMatrix, const FMatri
         dataPtr->Proj = ProjMatrix;
 
         DeviceContext->Unmap(ViewProjCB, 0);
+        CountConstantUpload(sizeof(ViewProjBufferType));
         DeviceContext->VSSetConstantBuffers(1, 1, &ViewProjCB); // b1 슬롯
        
     }
@@ -330,17 +337,18 @@ void D3D11RHI::UpdateViewConstantBuffers(const FMatrix& ViewMatrix, const FMatri
 
 void D3D11RHI::UpdateModelConstantBuffers(const FMatrix& ModelMatrix)
 {
-    // b0 : 모델 행렬
+    // b0 : 모델 행렬 (상수 링 슬라이스, 링을 못 쓰면 개별 버퍼)
+    FConstantSlice Slice;
+    if (AllocateModelConstants(ModelMatrix, Slice))
     {
+        BindModelConstants(Slice);
+        return;
+    }
 
-        D3D11_MAPPED_SUBRESOURCE mapped;
-        DeviceContext->Map(ModelCB, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
-        auto* dataPtr = reinterpret_cast<ModelBufferType*>(mapped.pData);
-
-        // HLSL 기본 row-major와 맞추기 위해 전치
-        dataPtr->Model = ModelMatrix;
-
-        DeviceContext->Unmap(ModelCB, 0);
+    ModelBufferType Data;
+    Data.Model = ModelMatrix;
+    if (WriteConstantBuffer(ModelCB, &Data, sizeof(Data)))
+    {
         DeviceContext->VSSetConstantBuffers(0, 1, &ModelCB); // b0 슬롯
     }
 }
@@ -378,24 +386,29 @@ void D3D11RHI::UpdatePixelConstantBuffers(const FObjMaterialInfo& InMaterialInfo
     dataPtr->Material.AmbientColor = InMaterialInfo.AmbientColor;
 
     DeviceContext->Unmap(PixelConstCB, 0);
+    CountConstantUpload(sizeof(FPixelConstBufferType));
     DeviceContext->PSSetConstantBuffers(4, 1, &PixelConstCB); // b4 슬롯
 }
 
 void D3D11RHI::UpdateHighLightConstantBuffers(const uint32 InPicked, const FVector& InColor, const uint32 X, const uint32 Y, const uint32 Z, const uint32 Gizmo)
 {
     // b2 : 색 강조
+    FConstantSlice Slice;
+    if (AllocateHighLightConstants(InPicked, InColor, X, Y, Z, Gizmo, Slice))
+    {
+        BindHighLightConstants(Slice);
+        return;
+    }
+
+    HighLightBufferType Data;
+    Data.Picked = InPicked;
+    Data.Color = InColor;
+    Data.X = X;
+    Data.Y = Y;
+    Data.Z = Z;
+    Data.Gizmo = Gizmo;
+    if (WriteConstantBuffer(HighLightCB, &Data, sizeof(Data)))
     {
-        D3D11_MAPPED_SUBRESOURCE mapped;
-        DeviceContext->Map(HighLightCB, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
-        auto* dataPtr = reinterpret_cast<HighLightBufferType*>(mapped.pData);
-
-        dataPtr->Picked = InPicked;
-        dataPtr->Color = InColor;
-        dataPtr->X = X;
-        dataPtr->Y = Y;
-        dataPtr->Z = Z;
-        dataPtr->Gizmo = Gizmo;
-        DeviceContext->Unmap(HighLightCB, 0);
         DeviceContext->VSSetConstantBuffers(2, 1, &HighLightCB); // b2 슬롯
         DeviceContext->PSSetConstantBuffers(2, 1, &HighLightCB); // b2 슬롯 (Pixel Shader에도 바인딩)
     }
@@ -404,18 +417,100 @@ void D3D11RHI::UpdateHighLightConstantBuffers(const uint32 InPicked, const FVect
 void D3D11RHI::UpdateColorConstantBuffers(const FVector4& InColor)
 {
     // b3 : 색 설정
+    ColorBufferType Data;
+    Data.Color = InColor;
+
+    FConstantSlice Slice;
+    if (ConstantRing.Allocate(&Data, sizeof(Data), Slice))
+    {
+        ConstantRing.BindPS(3, Slice);
+        return;
+    }
+
+    if (WriteConstantBuffer(ColorCB, &Data, sizeof(Data)))
     {
-        D3D11_MAPPED_SUBRESOURCE mapped;
-        DeviceContext->Map(ColorCB, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
-        auto* dataPtr = reinterpret_cast<ColorBufferType*>(mapped.pData);
-        {
-            dataPtr->Color = InColor;
-        }
-        DeviceContext->Unmap(ColorCB, 0);
         DeviceContext->PSSetConstantBuffers(3, 1, &ColorCB); // b3 슬롯
     }
 }
 
+void D3D11RHI::BeginConstantFrame()
+{
+    ConstantRing.BeginFrame();
+    ConstantRing.ResetStats();
+    ConstantStats = FConstantUploadStats();
+
+    // 링이 DISCARD되므로 이전 프레임 슬라이스를 가리키던 슬롯은 개별 버퍼로 되돌림
+    // (모델/InvWorld는 드로우 직전에, 색/하이라이트는 뷰포트·액터마다 다시 갱신됨)
+    DeviceContext->VSSetConstantBuffers(0, 1, &ModelCB);
+    DeviceContext->VSSetConstantBuffers(2, 1, &HighLightCB);
+    DeviceContext->PSSetConstantBuffers(2, 1, &HighLightCB);
+    DeviceContext->PSSetConstantBuffers(3, 1, &ColorCB);
+}
+
+bool D3D11RHI::AllocateModelConstants(const FMatrix& ModelMatrix, FConstantSlice& OutSlice)
+{
+    ModelBufferType Data;
+    Data.Model = ModelMatrix;
+    return ConstantRing.Allocate(&Data, sizeof(Data), OutSlice);
+}
+
+bool D3D11RHI::AllocateHighLightConstants(const uint32 InPicked, const FVector& InColor, const uint32 X, const uint32 Y, const uint32 Z, const uint32 Gizmo, FConstantSlice& OutSlice)
+{
+    HighLightBufferType Data;
+    Data.Picked = InPicked;
+    Data.Color = InColor;
+    Data.X = X;
+    Data.Y = Y;
+    Data.Z = Z;
+    Data.Gizmo = Gizmo;
+    return ConstantRing.Allocate(&Data, sizeof(Data), OutSlice);
+}
+
+void D3D11RHI::BindModelConstants(const FConstantSlice& Slice)
+{
+    ConstantRing.BindVS(0, Slice); // b0 슬롯
+}
+
+void D3D11RHI::BindHighLightConstants(const FConstantSlice& Slice)
+{
+    ConstantRing.BindVS(2, Slice); // b2 슬롯
+    ConstantRing.BindPS(2, Slice); // b2 슬롯 (Pixel Shader에도 바인딩)
+}
+
+FConstantUploadStats D3D11RHI::GetConstantUploadStats() const
+{
+    FConstantUploadStats Stats = ConstantRing.GetStats();
+    Stats.NumMaps += ConstantStats.NumMaps;
+    Stats.NumUnmaps += ConstantStats.NumUnmaps;
+    Stats.BytesUploaded += ConstantStats.BytesUploaded;
+    return Stats;
+}
+
+bool D3D11RHI::WriteConstantBuffer(ID3D11Buffer* Buffer, const void* Data, uint32 Size)
+{
+    if (!Buffer)
+    {
+        return false;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    if (FAILED(DeviceContext->Map(Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+    {
+        return false;
+    }
+    memcpy(mapped.pData, Data, Size);
+    DeviceContext->Unmap(Buffer, 0);
+    CountConstantUpload(Size);
+    return true;
+}
+
+void D3D11RHI::CountConstantUpload(uint32 Size)
+{
+    ++ConstantStats.NumMaps;
+    ++ConstantStats.NumUnmaps;
+    ConstantStats.BytesUploaded += Size;
+}
+
 void D3D11RHI::IASetPrimitiveTopology()
 {
     DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -548,6 +643,8 @@ void D3D11RHI::CreateFrameBuffer()
 
     DXGI_SWAP_CHAIN_DESC swapDesc;
     SwapChain->GetDesc(&swapDesc);
+    BackBufferWidth = std::max(swapDesc.BufferDesc.Width, 1u);
+    BackBufferHeight = std::max(swapDesc.BufferDesc.Height, 1u);
 
     // FXAA SRV생성
     D3D11_TEXTURE2D_DESC FXAAtd = {};
@@ -802,14 +899,6 @@ void D3D11RHI::CreateConstantBuffer()
     viewportDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
     Device->CreateBuffer(&viewportDesc, nullptr, &ViewportCB);
 
-    // b7 : Light array (FLightGPU[MAX_LIGHTS])
-    D3D11_BUFFER_DESC lightDesc = {};
-    lightDesc.Usage = D3D11_USAGE_DYNAMIC;
-    lightDesc.ByteWidth = sizeof(FLightInfo) * MAX_LIGHT_COUNT;
-    lightDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-    lightDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-    Device->CreateBuffer(&lightDesc, nullptr, &LightCB);  
-
     //b0 : FXAA 
     D3D11_BUFFER_DESC fxaaDesc = {};
     fxaaDesc.Usage = D3D11_USAGE_DYNAMIC;
@@ -826,6 +915,14 @@ void D3D11RHI::CreateConstantBuffer()
     heatDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE; 
     Device->CreateBuffer(&heatDesc, nullptr, &HeatCB);
 
+    // b9 : 클러스터드 라이트 그리드 정보
+    D3D11_BUFFER_DESC lightClusterDesc = {};
+    lightClusterDesc.Usage = D3D11_USAGE_DYNAMIC;
+    lightClusterDesc.ByteWidth = sizeof(FLightClusterConstants);
+    lightClusterDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    lightClusterDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    Device->CreateBuffer(&lightClusterDesc, nullptr, &LightClusterCB);
+
 
     // b6 : DepthVisualizationBuffer (Scene Depth 시각화용)
     D3D11_BUFFER_DESC depthVisDesc = {};
@@ -905,11 +1002,15 @@ void D3D11RHI::UpdateInvWorldConstantBuffer(const FMatrix& InvWorldMatrix, const
     data.InvWorld = InvWorldMatrix;
     data.InvViewProj = InvViewProjMatrix;
 
-    D3D11_MAPPED_SUBRESOURCE mapped;
-    if (SUCCEEDED(DeviceContext->Map(InvWorldCB, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+    FConstantSlice Slice;
+    if (ConstantRing.Allocate(&data, sizeof(InvWorldBufferType), Slice))
+    {
+        ConstantRing.BindPS(4, Slice);
+        return;
+    }
+
+    if (WriteConstantBuffer(InvWorldCB, &data, sizeof(InvWorldBufferType)))
     {
-        memcpy(mapped.pData, &data, sizeof(InvWorldBufferType));
-        DeviceContext->Unmap(InvWorldCB, 0);
         DeviceContext->PSSetConstantBuffers(4, 1, &InvWorldCB);
     }
 }
@@ -1456,30 +1557,95 @@ void D3D11RHI::RefreshFXAAConstantsFromSwapchain()
      
 }
 
-void D3D11RHI::UpdateLightConstantBuffers(const TArray<FLightInfo>& InLights)
+void D3D11RHI::UpdateClusteredLightBuffers(const FClusteredLightCulling& LightClusters)
 {
-    if (!LightCB) return;
-    D3D11_MAPPED_SUBRESOURCE mapped{};
+    const TArray<FLightInfo>& Lights = LightClusters.GetVisibleLights();
+    const TArray<FLightClusterRange>& Ranges = LightClusters.GetClusterRanges();
+    const TArray<uint32>& Indices = LightClusters.GetLightIndices();
+
+    const bool bUploaded =
+        UploadShaderBuffer(ClusterLightBuffer, Lights.data(), static_cast<uint32>(Lights.size()), sizeof(FLightInfo), DXGI_FORMAT_UNKNOWN) &&
+        UploadShaderBuffer(ClusterRangeBuffer, Ranges.data(), static_cast<uint32>(Ranges.size()), sizeof(FLightClusterRange), DXGI_FORMAT_R32G32_UINT) &&
+        UploadShaderBuffer(ClusterIndexBuffer, Indices.data(), static_cast<uint32>(Indices.size()), sizeof(uint32), DXGI_FORMAT_R32_UINT);
+
+    // 업로드에 실패하면 그리드를 비워 셰이더가 라이트를 순회하지 않도록 함
+    FLightClusterConstants Constants = LightClusters.GetConstants();
+    if (!bUploaded)
+    {
+        Constants.TilesX = 0;
+    }
+
+    if (WriteConstantBuffer(LightClusterCB, &Constants, sizeof(Constants)))
+    {
+        DeviceContext->PSSetConstantBuffers(9, 1, &LightClusterCB);
+    }
+
+    ID3D11ShaderResourceView* SRVs[3] = { ClusterLightBuffer.SRV, ClusterRangeBuffer.SRV, ClusterIndexBuffer.SRV };
+    DeviceContext->PSSetShaderResources(10, 3, SRVs);
+}
+
+void D3D11RHI::FDynamicShaderBuffer::Release()
+{
+    if (SRV) { SRV->Release(); SRV = nullptr; }
+    if (Buffer) { Buffer->Release(); Buffer = nullptr; }
+    Capacity = 0;
+}
 
-    if (SUCCEEDED(DeviceContext->Map(LightCB, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+bool D3D11RHI::UploadShaderBuffer(FDynamicShaderBuffer& Target, const void* Data, uint32 NumElements, uint32 Stride, DXGI_FORMAT Format)
+{
+    const uint32 RequiredElements = std::max(NumElements, 1u);
+    if (!Target.Buffer || Target.Capacity < RequiredElements)
     {
-        const size_t maxBytes = sizeof(FLightInfo) * static_cast<size_t>(MAX_LIGHT_COUNT);
-        memset(mapped.pData, 0, maxBytes);
-         
-        size_t copyCount = InLights.size();
+        Target.Release();
 
-        if (copyCount > static_cast<size_t>(MAX_LIGHT_COUNT))
-            copyCount = static_cast<size_t>(MAX_LIGHT_COUNT);
+        uint32 NewCapacity = 64;
+        while (NewCapacity < RequiredElements)
+        {
+            NewCapacity *= 2;
+        }
 
-        const size_t bytes = sizeof(FLightInfo) * copyCount;
-        if (bytes > 0)
+        const bool bStructured = (Format == DXGI_FORMAT_UNKNOWN);
+
+        D3D11_BUFFER_DESC Desc = {};
+        Desc.Usage = D3D11_USAGE_DYNAMIC;
+        Desc.ByteWidth = NewCapacity * Stride;
+        Desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+        Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        Desc.MiscFlags = bStructured ? D3D11_RESOURCE_MISC_BUFFER_STRUCTURED : 0;
+        Desc.StructureByteStride = bStructured ? Stride : 0;
+        if (FAILED(Device->CreateBuffer(&Desc, nullptr, &Target.Buffer)))
         {
-            memcpy(mapped.pData, InLights.data(), bytes);
+            return false;
         }
 
-        DeviceContext->Unmap(LightCB, 0);
-        DeviceContext->PSSetConstantBuffers(7, 1, &LightCB);
-    } 
+        D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc = {};
+        SRVDesc.Format = Format;
+        SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+        SRVDesc.Buffer.FirstElement = 0;
+        SRVDesc.Buffer.NumElements = NewCapacity;
+        if (FAILED(Device->CreateShaderResourceView(Target.Buffer, &SRVDesc, &Target.SRV)))
+        {
+            Target.Release();
+            return false;
+        }
+        Target.Capacity = NewCapacity;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE Mapped{};
+    if (FAILED(DeviceContext->Map(Target.Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+    {
+        return false;
+    }
+    if (NumElements > 0)
+    {
+        memcpy(Mapped.pData, Data, static_cast<size_t>(NumElements) * Stride);
+    }
+    else
+    {
+        memset(Mapped.pData, 0, Stride);
+    }
+    DeviceContext->Unmap(Target.Buffer, 0);
+    return true;
 }
 
 void D3D11RHI::UpdateFXAAConstantBuffers(const FXAAInfo& InFXAAInfo)
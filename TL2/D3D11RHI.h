@@ -1,6 +1,9 @@
 ﻿#pragma once
 #include "RHIDevice.h"
 #include "ResourceManager.h"
+#include "ConstantBufferRing.h"
+
+class FClusteredLightCulling;
 
 class D3D11RHI : public URHIDevice
 {
@@ -52,7 +55,8 @@ public:
     void UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeSec) override;
     void UpdateInvWorldConstantBuffer(const FMatrix& InvWorldMatrix, const FMatrix& InvViewProjMatrix) override;
     void UpdateViewportConstantBuffer(float StartX, float StartY, float SizeX, float SizeY);
-    void UpdateLightConstantBuffers(const TArray<FLightInfo>& InLights) override;
+    // 클러스터드 라이트 업로드: b9 클러스터 상수, t10 라이트, t11 클러스터 구간, t12 라이트 인덱스 (PS)
+    void UpdateClusteredLightBuffers(const FClusteredLightCulling& LightClusters);
     void UpdateFXAAConstantBuffers(const FXAAInfo& InFXAAInfo) override;
     void UpdateViewportConstantBuffer(float ViewportX, float ViewportY, float ViewportWidth, float ViewportHeight, float ScreenWidth, float ScreenHeight);
     void UpdateDepthVisualizationBuffer(float NearPlane, float FarPlane, float ViewportX, float ViewportY, float ViewportWidth, float ViewportHeight, float ScreenWidth, float ScreenHeight);
@@ -62,6 +66,21 @@ public:
     void UpdateInverseViewProjMatrixConstantBuffer(const FMatrix& InvViewMatrix, const FMatrix& InvProjectionMatrix);
     void UpdateCopyShaderViewportBuffer(float ViewportX, float ViewportY, float ViewportWidth, float ViewportHeight, float ScreenWidth, float ScreenHeight);
 
+    // 프레임 상수 링 (모델/하이라이트/색/InvWorld). 오프셋 바인딩을 지원하지 않으면 위 Update* 함수는 개별 상수 버퍼로 동작
+    void BeginConstantFrame();
+    bool IsConstantRingEnabled() const { return ConstantRing.IsSupported(); }
+    bool BeginConstantBatch(uint32 MaxBytes) { return ConstantRing.BeginBatch(MaxBytes); }
+    void EndConstantBatch() { ConstantRing.EndBatch(); }
+    bool AllocateModelConstants(const FMatrix& ModelMatrix, FConstantSlice& OutSlice);
+    bool AllocateHighLightConstants(const uint32 InPicked, const FVector& InColor, const uint32 X, const uint32 Y, const uint32 Z, const uint32 Gizmo, FConstantSlice& OutSlice);
+    void BindModelConstants(const FConstantSlice& Slice);
+    void BindHighLightConstants(const FConstantSlice& Slice);
+    // 이번 프레임의 상수 버퍼 Map/Unmap 횟수와 업로드 바이트 (링 + 개별 버퍼)
+    FConstantUploadStats GetConstantUploadStats() const;
+
+    // 프레임당 상수 링 크기 (256바이트 슬라이스 16K개)
+    static constexpr uint32 ConstantRingCapacity = 4 * 1024 * 1024;
+
     void IASetPrimitiveTopology() override;
     void RSSetState(EViewModeIndex ViewModeIndex) override;
     void RSSetFrontCullState() override;
@@ -110,6 +129,9 @@ public:
     {
         return SwapChain;
     }
+    // 백버퍼 크기 (프레임버퍼 생성 시 캐시, 매번 GetDesc하지 않음)
+    inline UINT GetBackBufferWidth() const { return BackBufferWidth; }
+    inline UINT GetBackBufferHeight() const { return BackBufferHeight; }
     inline ID3D11ShaderResourceView* GetSceneShaderResourceView()
     {
         return SceneShaderResourceView;
@@ -160,10 +182,28 @@ private:
     void ReleaseDeviceAndSwapChain();
  
 	void OmSetDepthStencilState(EComparisonFunc Func) override;
+
+    // 개별 상수 버퍼를 DISCARD로 갱신 (상수 링 폴백 경로, 통계 포함)
+    bool WriteConstantBuffer(ID3D11Buffer* Buffer, const void* Data, uint32 Size);
+    void CountConstantUpload(uint32 Size);
+
+    // 매 프레임 DISCARD로 갱신하는 SRV 버퍼 (용량이 모자라면 두 배로 다시 생성)
+    struct FDynamicShaderBuffer
+    {
+        ID3D11Buffer* Buffer = nullptr;
+        ID3D11ShaderResourceView* SRV = nullptr;
+        uint32 Capacity = 0;    // 원소 수
+
+        void Release();
+    };
+    // Format이 DXGI_FORMAT_UNKNOWN이면 StructuredBuffer, 아니면 형식 버퍼. 빈 입력도 원소 하나는 유지
+    bool UploadShaderBuffer(FDynamicShaderBuffer& Target, const void* Data, uint32 NumElements, uint32 Stride, DXGI_FORMAT Format);
     
 private:
     //24
     D3D11_VIEWPORT ViewportInfo{};
+    UINT BackBufferWidth = 1;
+    UINT BackBufferHeight = 1;
 
     //8
     ID3D11Device* Device{};//
@@ -218,9 +258,14 @@ private:
     ID3D11Buffer* InvWorldCB{};
     ID3D11Buffer* ViewportCB{};
     ID3D11Buffer* DepthVisualizationCB{};
-    ID3D11Buffer* LightCB{}; 
     ID3D11Buffer* FXAACB{};
     ID3D11Buffer* HeatCB{};
+    ID3D11Buffer* LightClusterCB{};
+
+    // 클러스터드 라이트 버퍼 (t10 ~ t12)
+    FDynamicShaderBuffer ClusterLightBuffer;
+    FDynamicShaderBuffer ClusterRangeBuffer;
+    FDynamicShaderBuffer ClusterIndexBuffer;
 
     // ✅ Fog Pass용 Constant Buffers
     ID3D11Buffer* CameraNearFarCB = nullptr;          // b0: Camera Info
@@ -233,6 +278,10 @@ private:
 
     ID3D11Buffer* ConstantBuffer{};
 
+    // 프레임 상수 링 (b0 모델, b2 하이라이트, b3 색, b4 InvWorld)
+    FConstantBufferRing ConstantRing;
+    FConstantUploadStats ConstantStats;    // 개별 상수 버퍼 경로 통계
+
     ID3D11SamplerState* DefaultSamplerState = nullptr;
     ID3D11SamplerState* MirrorSamplerState = nullptr;
 
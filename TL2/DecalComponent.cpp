@@ -10,7 +10,6 @@
 #include "StaticMeshComponent.h"
 #include "AABoundingBoxComponent.h"
 #include "RenderingStats.h"
-#include "SelectionManager.h"
 #include "CameraActor.h"
 #include "World.h"
 #include "VertexData.h"
@@ -39,9 +38,7 @@ UDecalComponent::UDecalComponent()
 
     // Billboard setup (Editor only)
     auto& ResourceManager = UResourceManager::GetInstance();
-    BillboardQuad = ResourceManager.Get<UTextQuad>("Billboard");
     BillboardTexture = ResourceManager.Load<UTexture>("Editor/Icon/S_DecalActorIcon.dds");
-    BillboardMaterial = ResourceManager.Load<UMaterial>("Billboard.hlsl");
 
     SetTickEnabled(true);
 }
@@ -217,8 +214,19 @@ void UDecalComponent::RenderDecalProjection(URenderer* Renderer, const FMatrix&
         return;
     }
 
-    // Affected Meshes 찾기
-    TArray<UStaticMeshComponent*> AffectedMeshes = FindAffectedMeshes(GWorld);
+    // Affected Meshes 찾기 (단독 호출: 반투명 큐를 거치지 않으므로 블렌드 상태를 직접 설정)
+    Renderer->OMSetBlendState(true);
+    RenderDecalProjection(Renderer, View, Proj, FindAffectedMeshes(GWorld));
+    Renderer->OMSetBlendState(false);
+}
+
+void UDecalComponent::RenderDecalProjection(URenderer* Renderer, const FMatrix& View, const FMatrix& Proj, const TArray<UStaticMeshComponent*>& AffectedMeshes)
+{
+    if (!Renderer || !DecalTexture)
+    {
+        return;
+    }
+
     if (AffectedMeshes.empty())
         return;
 
@@ -231,8 +239,8 @@ void UDecalComponent::RenderDecalProjection(URenderer* Renderer, const FMatrix&
     // Decal Shader 및 파이프라인 준비
     UShader* DecalProjShader = UResourceManager::GetInstance().Load<UShader>("ProjectionDecal.hlsl");
 
+    // 블렌드 상태는 호출자(FTranslucentQueue)가 패스 단위로 설정
     Renderer->PrepareShader(DecalProjShader);
-    Renderer->OMSetBlendState(true);
     Renderer->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly);
      
     // reset viewfrustum posision 
@@ -288,15 +296,35 @@ void UDecalComponent::RenderDecalProjection(URenderer* Renderer, const FMatrix&
         Renderer->GetRHIDevice()->PSSetDefaultSampler(0);
     }
 
+    // 데칼 단위 상수는 메시마다 다시 올리지 않고 한 번만 갱신
+    Renderer->UpdateInvWorldBuffer(DecalView, DecalProj);
+    Renderer->UpdateColorBuffer(FVector4{ 1.0f, 1.0f, 1.0f, CurrentAlpha });
+
+    // 리시버 모델 행렬을 상수 링에 한 번에 올리고, 드로우에서는 오프셋만 바인딩
+    TArray<FMatrix> ModelMatrices;
+    ModelMatrices.reserve(AffectedMeshes.size());
     for (UStaticMeshComponent* StaticMeshComponent : AffectedMeshes)
     {
-        UStaticMesh* Mesh = StaticMeshComponent->GetStaticMesh();
-        if (!StaticMeshComponent || !Mesh)
+        ModelMatrices.push_back(StaticMeshComponent ? StaticMeshComponent->GetWorldMatrix() : FMatrix::Identity());
+    }
+    TArray<FConstantSlice> ModelSlices;
+    const bool bModelSlicesUploaded = Renderer->UploadModelConstants(ModelMatrices, ModelSlices);
+
+    for (size_t MeshIndex = 0; MeshIndex < AffectedMeshes.size(); ++MeshIndex)
+    {
+        UStaticMeshComponent* StaticMeshComponent = AffectedMeshes[MeshIndex];
+        if (!StaticMeshComponent || !StaticMeshComponent->GetStaticMesh())
             continue;
+        UStaticMesh* Mesh = StaticMeshComponent->GetStaticMesh();
 
-        Renderer->UpdateConstantBuffer(StaticMeshComponent->GetWorldMatrix(), View, Proj);
-        Renderer->UpdateInvWorldBuffer(DecalView, DecalProj);
-        Renderer->UpdateColorBuffer(FVector4{ 1.0f, 1.0f, 1.0f, CurrentAlpha });
+        if (bModelSlicesUploaded)
+        {
+            Renderer->BindModelConstants(ModelSlices[MeshIndex], View, Proj);
+        }
+        else
+        {
+            Renderer->UpdateConstantBuffer(ModelMatrices[MeshIndex], View, Proj);
+        }
 
         UINT Stride = 0;
         switch (Mesh->GetVertexType())
@@ -331,7 +359,6 @@ void UDecalComponent::RenderDecalProjection(URenderer* Renderer, const FMatrix&
     ID3D11ShaderResourceView* NullSRV[2] = { nullptr, nullptr };
     DevieContext->PSSetShaderResources(0, 2, NullSRV);
 
-    Renderer->OMSetBlendState(false);
     Renderer->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 }
 
@@ -436,120 +463,18 @@ void UDecalComponent::StartFade()
     DecalCurrentState = EDecalState::FadeIn;
 }
 
-void UDecalComponent::CreateBillboardVertices()
-{
-    TArray<FBillboardVertexInfo_GPU> vertices;
-
-    // 단일 쿼드의 4개 정점 생성 (카메라를 향하는 평면)
-    float halfW = BillboardWidth * 0.5f;
-    float halfH = BillboardHeight * 0.5f;
-
-    FBillboardVertexInfo_GPU Info;
-
-    // UV 좌표 (전체 텍스처 사용)
-    float UCoord = 0.0f;
-    float VCoord = 0.0f;
-    float ULength = 1.0f;
-    float VLength = 1.0f;
-
-    // 정점 0: 좌상단
-    Info.Position[0] = -halfW;
-    Info.Position[1] = halfH;
-    Info.Position[2] = 0.0f;
-    Info.CharSize[0] = BillboardWidth;
-    Info.CharSize[1] = BillboardHeight;
-    Info.UVRect[0] = UCoord;
-    Info.UVRect[1] = VCoord;
-    Info.UVRect[2] = ULength;
-    Info.UVRect[3] = VLength;
-    vertices.push_back(Info);
-
-    // 정점 1: 우상단
-    Info.Position[0] = halfW;
-    Info.Position[1] = halfH;
-    Info.Position[2] = 0.0f;
-    vertices.push_back(Info);
-
-    // 정점 2: 좌하단
-    Info.Position[0] = -halfW;
-    Info.Position[1] = -halfH;
-    Info.Position[2] = 0.0f;
-    vertices.push_back(Info);
-
-    // 정점 3: 우하단
-    Info.Position[0] = halfW;
-    Info.Position[1] = -halfH;
-    Info.Position[2] = 0.0f;
-    vertices.push_back(Info);
-
-    // 동적 버텍스 버퍼 업데이트
-    UResourceManager::GetInstance().UpdateDynamicVertexBuffer("Billboard", vertices);
-}
-
 void UDecalComponent::RenderBillboard(URenderer* Renderer, const FMatrix& View, const FMatrix& Proj)
 {
-    if (!BillboardMaterial || !BillboardTexture || !BillboardQuad)
-        return;
-
-    // 카메라 정보 가져오기
-    UWorld* World = GetOwner() ? GetOwner()->GetWorld() : nullptr;
-    if (!World)
-        return;
-
-    ACameraActor* CameraActor = World->GetCameraActor();
-    if (!CameraActor)
+    if (!BillboardTexture)
         return;
 
-    FVector CamRight = CameraActor->GetActorRight();
-    FVector CamUp = CameraActor->GetActorUp();
-
-    // 빌보드 위치 설정 (데칼 액터의 위치)
-    FVector BillboardPos = GetWorldLocation();
-
-    // 텍스처 로드 
-    BillboardMaterial->Load("Editor/Icon/S_DecalActorIcon.dds", Renderer->GetRHIDevice()->GetDevice());
-
-    // 상수 버퍼 업데이트
-    Renderer->UpdateBillboardConstantBuffers(BillboardPos, View, Proj, CamRight, CamUp);
-
-    // 셰이더 준비
-    UShader* CompShader = BillboardMaterial->GetShader();
-    Renderer->PrepareShader(CompShader);
-
-    ID3D11DeviceContext* DeviceContext = Renderer->GetRHIDevice()->GetDeviceContext();
-
-    // InputLayout 설정 (중요!)
-    DeviceContext->IASetInputLayout(CompShader->GetInputLayout());
-
-    // 빌보드 정점 생성 및 버퍼 업데이트
-    CreateBillboardVertices();
-
-    // 렌더링
-    Renderer->OMSetBlendState(true);
-    Renderer->RSSetState(EViewModeIndex::VMI_Unlit);
-
-    // 버퍼 및 텍스처 바인딩
-    UINT Stride = sizeof(FBillboardVertexInfo_GPU);
-    UINT Offset = 0;
-    ID3D11Buffer* VertexBuffer = BillboardQuad->GetVertexBuffer();
-    ID3D11Buffer* IndexBuffer = BillboardQuad->GetIndexBuffer();
-
-    DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
-    DeviceContext->IASetIndexBuffer(IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-
-    // 텍스처 바인딩 (중요!)
-    UTexture* CompTexture = BillboardMaterial->GetTexture();
-    if (CompTexture && CompTexture->GetShaderResourceView())
-    {
-        ID3D11ShaderResourceView* TextureSRV = CompTexture->GetShaderResourceView();
-        Renderer->GetRHIDevice()->PSSetDefaultSampler(0);
-        DeviceContext->PSSetShaderResources(0, 1, &TextureSRV);
-    }
-
-    DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-    DeviceContext->DrawIndexed(BillboardQuad->GetIndexCount(), 0, 0);
-
-    Renderer->OMSetBlendState(false);
+    // 아이콘은 반투명 큐에 모아 다른 빌보드/텍스트와 함께 깊이 순으로 그림
+    FBillboardSprite Sprite;
+    Sprite.Position = GetWorldLocation();
+    Sprite.Width = BillboardWidth;
+    Sprite.Height = BillboardHeight;
+    Sprite.Texture = BillboardTexture;
+    Renderer->GetTranslucentQueue().AddBillboard(Sprite);
 }
 
 void UDecalComponent::RenderOBB(URenderer* Renderer)
@@ -560,7 +485,7 @@ void UDecalComponent::RenderOBB(URenderer* Renderer)
     }
 
     // Owner가 선택된 경우에만 OBB Drawing
-    if (!USelectionManager::GetInstance().IsActorSelected(Owner))
+    if (!Owner->IsSelected())
     {
         return;
     }
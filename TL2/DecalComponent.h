@@ -40,6 +40,9 @@ public:
     // 실제 Decal 투영만 렌더링
     void RenderDecalProjection(URenderer* Renderer, const FMatrix& View, const FMatrix& Proj);
 
+    // 미리 계산된 수신 메시 목록으로 투영 (World의 FDecalReceiverCache 사용, 블렌드 상태는 호출자가 설정)
+    void RenderDecalProjection(URenderer* Renderer, const FMatrix& View, const FMatrix& Proj, const TArray<UStaticMeshComponent*>& AffectedMeshes);
+
     // Decal Box와 충돌하는 Static Mesh 컴포넌트 찾기
     TArray<UStaticMeshComponent*> FindAffectedMeshes(UWorld* World);
     
@@ -88,7 +91,6 @@ public:
 private:
      void RenderBillboard(URenderer* Renderer, const FMatrix& View, const FMatrix& Proj);
     void RenderOBB(URenderer* Renderer);
-    void CreateBillboardVertices();
 
 protected:
     // Texture
@@ -121,9 +123,7 @@ protected:
     float MaxAlpha;
 
     // Billboard properties
-    UTextQuad* BillboardQuad = nullptr;
     UTexture* BillboardTexture = nullptr;
-    UMaterial* BillboardMaterial = nullptr;
     float BillboardWidth = 1.0f;
     float BillboardHeight = 1.0f; 
 };
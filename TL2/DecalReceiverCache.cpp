@@ -0,0 +1,178 @@
+﻿#include "pch.h"
+#include "DecalReceiverCache.h"
+#include "DecalComponent.h"
+#include "StaticMeshComponent.h"
+#include "BVH.h"
+#include <chrono>
+
+namespace
+{
+	bool IsSameBox(const FOrientedBox& A, const FOrientedBox& B)
+	{
+		return A.Center.X == B.Center.X && A.Center.Y == B.Center.Y && A.Center.Z == B.Center.Z &&
+			A.HalfExtents.X == B.HalfExtents.X && A.HalfExtents.Y == B.HalfExtents.Y && A.HalfExtents.Z == B.HalfExtents.Z &&
+			A.Rotation.X == B.Rotation.X && A.Rotation.Y == B.Rotation.Y && A.Rotation.Z == B.Rotation.Z && A.Rotation.W == B.Rotation.W;
+	}
+}
+
+float FDecalReceiverCache::Update(const TArray<UDecalComponent*>& Decals, const FBVH* BVH, const TArray<AActor*>& LevelActors)
+{
+	auto StartTime = std::chrono::high_resolution_clock::now();
+
+	if (!IsStillValid(Decals))
+	{
+		Rebuild(Decals, BVH, LevelActors);
+	}
+	PendingMovedActors.Empty();
+
+	std::chrono::duration<float, std::milli> Duration = std::chrono::high_resolution_clock::now() - StartTime;
+	return Duration.count();
+}
+
+const TArray<UStaticMeshComponent*>& FDecalReceiverCache::GetReceivers(const UDecalComponent* Decal) const
+{
+	static const TArray<UStaticMeshComponent*> EmptyReceivers;
+
+	const int32* EntryIndex = DecalToEntry.Find(Decal);
+	return EntryIndex ? Entries[*EntryIndex].Receivers : EmptyReceivers;
+}
+
+void FDecalReceiverCache::Invalidate()
+{
+	bValid = false;
+	PendingMovedActors.Empty();
+}
+
+void FDecalReceiverCache::NotifyActorMoved(AActor* Actor)
+{
+	if (bValid && Actor)
+	{
+		PendingMovedActors.Add(Actor);
+	}
+}
+
+bool FDecalReceiverCache::IsStillValid(const TArray<UDecalComponent*>& Decals) const
+{
+	if (!bValid || Decals.Num() != Entries.Num())
+		return false;
+
+	// 데칼 자체가 움직이거나 크기가 바뀌었는지 (이동 알림 없이 크기만 바뀌는 경우도 포함)
+	for (int32 i = 0; i < Decals.Num(); ++i)
+	{
+		if (Entries[i].Decal != Decals[i] || !IsSameBox(Decals[i]->GetDecalOrientedBox(), Entries[i].OBB))
+			return false;
+	}
+
+	// 움직인 액터가 기존 수신 메시이거나, 새 위치가 어떤 데칼 박스와 겹치면 재계산
+	for (AActor* Actor : PendingMovedActors)
+	{
+		if (ReceiverActors.Contains(Actor))
+			return false;
+
+		FBound ActorBounds;
+		if (!FBVH::CalculateActorBounds(Actor, ActorBounds))
+			continue;
+
+		for (const FDecalEntry& Entry : Entries)
+		{
+			if (Entry.AABB.IsIntersect(ActorBounds))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void FDecalReceiverCache::Rebuild(const TArray<UDecalComponent*>& Decals, const FBVH* BVH, const TArray<AActor*>& LevelActors)
+{
+	Entries.SetNum(Decals.Num());
+	DecalToEntry.Empty();
+	ReceiverActors.Empty();
+	QueryBounds.clear();
+	CandidatePairs.clear();
+	PairCount = 0;
+
+	for (int32 i = 0; i < Decals.Num(); ++i)
+	{
+		FDecalEntry& Entry = Entries[i];
+		Entry.Decal = Decals[i];
+		Entry.OBB = Decals[i]->GetDecalOrientedBox();
+		Entry.AABB = Decals[i]->GetDecalBoundingBox();
+		Entry.Receivers.clear();
+
+		DecalToEntry.Add(Decals[i], i);
+		QueryBounds.Add(Entry.AABB);
+	}
+
+	// 1단계: 모든 데칼 AABB로 BVH를 한 번 순회 (Broad Phase)
+	if (BVH && BVH->GetNodeCount() > 0)
+	{
+		BVH->IntersectAABBBatch(QueryBounds, CandidatePairs);
+	}
+	else
+	{
+		// BVH가 없는 경우 모든 Actor를 후보군으로 (Fallback)
+		for (AActor* Actor : LevelActors)
+		{
+			for (int32 i = 0; i < Entries.Num(); ++i)
+			{
+				CandidatePairs.Add({ i, Actor });
+			}
+		}
+	}
+
+	// 데칼별로 후보를 모아 OBB 검사를 한 번에 돌리기 위해 데칼 인덱스 순으로 정렬
+	CandidatePairs.Sort([](const TPair<int32, AActor*>& A, const TPair<int32, AActor*>& B)
+	{
+		return A.first < B.first;
+	});
+
+	// 2단계: 컴포넌트 AABB, 3단계: OBB vs OBB (SAT, 데칼 하나당 배치 1회)
+	int32 PairIndex = 0;
+	while (PairIndex < CandidatePairs.Num())
+	{
+		const int32 EntryIndex = CandidatePairs[PairIndex].first;
+		FDecalEntry& Entry = Entries[EntryIndex];
+
+		CandidateComponents.clear();
+		CandidateOwners.clear();
+		CandidateBoxes.clear();
+
+		for (; PairIndex < CandidatePairs.Num() && CandidatePairs[PairIndex].first == EntryIndex; ++PairIndex)
+		{
+			AActor* Actor = CandidatePairs[PairIndex].second;
+			if (!Actor || Actor->GetActorHiddenInGame())
+				continue;
+
+			for (UActorComponent* Component : Actor->GetComponents())
+			{
+				UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Component);
+				if (!StaticMeshComp || !StaticMeshComp->GetStaticMesh())
+					continue;
+
+				if (!Entry.AABB.IsIntersect(StaticMeshComp->GetWorldBoundingBox()))
+					continue;
+
+				CandidateComponents.Add(StaticMeshComp);
+				CandidateOwners.Add(Actor);
+				CandidateBoxes.Add(StaticMeshComp->GetWorldOrientedBox());
+			}
+		}
+
+		if (CandidateBoxes.IsEmpty())
+			continue;
+
+		PairCount += FOrientedBox::IntersectsMany(Entry.OBB, CandidateBoxes, HitMask);
+
+		for (int32 i = 0; i < CandidateBoxes.Num(); ++i)
+		{
+			if (HitMask[i >> 6] & (1ull << (i & 63)))
+			{
+				Entry.Receivers.Add(CandidateComponents[i]);
+				ReceiverActors.Add(CandidateOwners[i]);
+			}
+		}
+	}
+
+	bValid = true;
+}
@@ -0,0 +1,62 @@
+﻿#pragma once
+#include "AABoundingBoxComponent.h"
+#include "OrientedBox.h"
+
+class AActor;
+class FBVH;
+class UDecalComponent;
+class UStaticMeshComponent;
+
+/**
+ * FDecalReceiverCache
+ * - 모든 데칼 박스를 모아 BVH를 한 번만 순회해 (데칼, 메시) 쌍을 만든다
+ * - 결과는 뷰포트 간, 프레임 간 재사용하고 다음 경우에만 다시 계산한다
+ *   · 액터 추가/삭제/숨김 (Invalidate)
+ *   · 데칼 목록이나 데칼 박스(위치/회전/크기)가 바뀜
+ *   · 영향받던 메시가 움직였거나, 움직인 메시가 데칼 박스와 새로 겹침
+ */
+class FDecalReceiverCache
+{
+public:
+	// 유효하면 검증만 하고, 아니면 다시 계산. 이번 호출에 걸린 시간(ms) 반환
+	float Update(const TArray<UDecalComponent*>& Decals, const FBVH* BVH, const TArray<AActor*>& LevelActors);
+
+	// 데칼이 투영될 메시 목록 (캐시에 없으면 빈 배열)
+	const TArray<UStaticMeshComponent*>& GetReceivers(const UDecalComponent* Decal) const;
+
+	void Invalidate();
+
+	// 트랜스폼이 바뀐 액터 기록 (다음 Update에서 캐시에 영향이 있는지 검사)
+	void NotifyActorMoved(AActor* Actor);
+
+	int32 GetPairCount() const { return PairCount; }
+
+private:
+	struct FDecalEntry
+	{
+		UDecalComponent* Decal = nullptr;
+		FOrientedBox OBB;
+		FBound AABB;
+		TArray<UStaticMeshComponent*> Receivers;
+	};
+
+	bool IsStillValid(const TArray<UDecalComponent*>& Decals) const;
+	void Rebuild(const TArray<UDecalComponent*>& Decals, const FBVH* BVH, const TArray<AActor*>& LevelActors);
+
+	TArray<FDecalEntry> Entries;
+	TMap<const UDecalComponent*, int32> DecalToEntry;
+
+	TSet<AActor*> ReceiverActors;
+	TSet<AActor*> PendingMovedActors;
+
+	// Rebuild 중간 버퍼 (재할당 방지)
+	TArray<FBound> QueryBounds;
+	TArray<TPair<int32, AActor*>> CandidatePairs;
+	TArray<UStaticMeshComponent*> CandidateComponents;
+	TArray<AActor*> CandidateOwners;
+	TArray<FOrientedBox> CandidateBoxes;
+	TArray<uint64> HitMask;
+
+	int32 PairCount = 0;
+	bool bValid = false;
+};
@@ -0,0 +1,98 @@
+﻿#include "pch.h"
+#include "DynamicRingBuffer.h"
+
+bool FDynamicRingBuffer::Initialize(ID3D11Device* Device, uint32 InCapacity, UINT BindFlags)
+{
+	Release();
+
+	D3D11_BUFFER_DESC Desc = {};
+	Desc.ByteWidth = InCapacity;
+	Desc.Usage = D3D11_USAGE_DYNAMIC;
+	Desc.BindFlags = BindFlags;
+	Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+	HRESULT hr = Device->CreateBuffer(&Desc, nullptr, &Buffer);
+	if (FAILED(hr))
+	{
+		UE_LOG("FDynamicRingBuffer: CreateBuffer failed (%u bytes)", InCapacity);
+		Buffer = nullptr;
+		return false;
+	}
+
+	Capacity = InCapacity;
+	// 첫 업로드가 DISCARD로 시작하도록 끝으로 설정
+	WriteOffset = Capacity;
+	return true;
+}
+
+void FDynamicRingBuffer::Release()
+{
+	if (Buffer)
+	{
+		Buffer->Release();
+		Buffer = nullptr;
+	}
+	Capacity = 0;
+	WriteOffset = 0;
+	bWriting = false;
+}
+
+bool FDynamicRingBuffer::Upload(ID3D11DeviceContext* DeviceContext, const void* Data, uint32 Size, uint32 Alignment, uint32& OutOffset)
+{
+	uint8* Dest = BeginWrite(DeviceContext, Size, Alignment, OutOffset);
+	if (!Dest)
+	{
+		return false;
+	}
+
+	std::memcpy(Dest, Data, Size);
+	EndWrite(DeviceContext, Size);
+	return true;
+}
+
+uint8* FDynamicRingBuffer::BeginWrite(ID3D11DeviceContext* DeviceContext, uint32 Size, uint32 Alignment, uint32& OutOffset)
+{
+	if (!Buffer || bWriting || Size == 0 || Size > Capacity)
+	{
+		return nullptr;
+	}
+
+	uint32 Offset = (WriteOffset + (Alignment - 1)) / Alignment * Alignment;
+	D3D11_MAP MapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+
+	if (Offset + Size > Capacity)
+	{
+		// 한 바퀴 돌았으므로 이전 내용을 버리고 처음부터
+		Offset = 0;
+		MapType = D3D11_MAP_WRITE_DISCARD;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE Mapped;
+	if (FAILED(DeviceContext->Map(Buffer, 0, MapType, 0, &Mapped)))
+	{
+		return nullptr;
+	}
+
+	WriteOffset = Offset + Size;
+	PendingOffset = Offset;
+	OutOffset = Offset;
+	bWriting = true;
+
+	++NumMaps;
+	return static_cast<uint8*>(Mapped.pData) + Offset;
+}
+
+void FDynamicRingBuffer::EndWrite(ID3D11DeviceContext* DeviceContext, uint32 WrittenSize)
+{
+	if (!bWriting)
+	{
+		return;
+	}
+
+	DeviceContext->Unmap(Buffer, 0);
+	bWriting = false;
+
+	// 예약했지만 쓰지 않은 뒤쪽은 다음 기록이 이어서 사용
+	WriteOffset = std::min(WriteOffset, PendingOffset + WrittenSize);
+	BytesUploaded += WrittenSize;
+}
@@ -0,0 +1,51 @@
+﻿#pragma once
+
+/**
+ * FDynamicRingBuffer
+ * - CPU가 매 프레임 채우는 동적 GPU 버퍼를 링 형태로 하위 할당
+ * - 이어 쓰기는 MAP_WRITE_NO_OVERWRITE, 끝에 닿아 처음으로 돌아갈 때만 MAP_WRITE_DISCARD
+ *   (GPU가 아직 읽는 영역을 덮어쓰지 않으면서 프레임 내 Map 비용을 최소화)
+ */
+class FDynamicRingBuffer
+{
+public:
+	FDynamicRingBuffer() = default;
+	~FDynamicRingBuffer() { Release(); }
+
+	FDynamicRingBuffer(const FDynamicRingBuffer&) = delete;
+	FDynamicRingBuffer& operator=(const FDynamicRingBuffer&) = delete;
+
+	bool Initialize(ID3D11Device* Device, uint32 InCapacity, UINT BindFlags);
+	void Release();
+
+	bool IsInitialized() const { return Buffer != nullptr; }
+
+	// Data를 링에 복사하고 버퍼 내 바이트 오프셋을 돌려줌 (용량보다 크면 실패)
+	bool Upload(ID3D11DeviceContext* DeviceContext, const void* Data, uint32 Size, uint32 Alignment, uint32& OutOffset);
+
+	// Size 바이트를 예약하고 매핑된 주소를 돌려줌 (EndWrite까지 유효, 여러 데이터를 한 번의 Map으로 기록할 때 사용)
+	uint8* BeginWrite(ID3D11DeviceContext* DeviceContext, uint32 Size, uint32 Alignment, uint32& OutOffset);
+	// 실제로 쓴 바이트 수만큼만 예약을 남기고 Unmap
+	void EndWrite(ID3D11DeviceContext* DeviceContext, uint32 WrittenSize);
+
+	// 다음 기록이 DISCARD로 버퍼 처음부터 시작하도록 되감음 (프레임 단위 선형 할당용)
+	void Rewind() { WriteOffset = Capacity; }
+
+	ID3D11Buffer* GetBuffer() const { return Buffer; }
+	uint32 GetCapacity() const { return Capacity; }
+
+	// 통계 (ResetStats 이후 누적)
+	uint32 GetNumMaps() const { return NumMaps; }
+	uint64 GetBytesUploaded() const { return BytesUploaded; }
+	void ResetStats() { NumMaps = 0; BytesUploaded = 0; }
+
+private:
+	ID3D11Buffer* Buffer = nullptr;
+	uint32 Capacity = 0;
+	uint32 WriteOffset = 0;
+	uint32 PendingOffset = 0;	// BeginWrite로 예약한 영역의 시작
+	bool bWriting = false;
+
+	uint32 NumMaps = 0;
+	uint64 BytesUploaded = 0;
+};
@@ -2,6 +2,7 @@
 #include "EditorClipboard.h"
 #include "Actor.h"
 #include "World.h"
+#include "ObjectFactory.h"
 
 UEditorClipboard& UEditorClipboard::GetInstance()
 {
@@ -11,13 +12,21 @@ UEditorClipboard& UEditorClipboard::GetInstance()
 
 void UEditorClipboard::Copy(const TArray<AActor*>& Actors)
 {
-    CopiedActors.clear();
+    DestroyCopiedActors();
 
+    // 선택을 한 번만 복제해 월드 밖에 보관 (붙여넣기마다 원본을 다시 읽지 않음)
+    ObjectFactory::ReserveObjects(Actors.Num() * 4);
+    CopiedActors.Reserve(Actors.Num());
     for (AActor* Actor : Actors)
     {
-        if (Actor)
+        if (!Actor)
+        {
+            continue;
+        }
+
+        if (AActor* Prototype = Cast<AActor>(Actor->Duplicate()))
         {
-            CopiedActors.push_back(Actor);
+            CopiedActors.Add(Prototype);
         }
     }
 
@@ -43,33 +52,8 @@ TArray<AActor*> UEditorClipboard::Paste(UWorld* World, const FVector& SpawnOffse
         return PastedActors;
     }
 
-    // 복사된 액터들을 복제
-    for (AActor* OriginalActor : CopiedActors)
-    {
-        // 원본 액터가 삭제되었는지 확인
-        if (!OriginalActor)
-        {
-            continue;
-        }
-
-        // 액터 복제
-        AActor* DuplicatedActor = Cast<AActor>(OriginalActor->Duplicate());
-        if (!DuplicatedActor)
-        {
-            UE_LOG("EditorClipboard: Failed to duplicate actor");
-            continue;
-        }
-
-        // 위치 오프셋 적용
-        FVector NewLocation = OriginalActor->GetActorLocation() + SpawnOffset;
-        DuplicatedActor->SetActorLocation(NewLocation);
-
-        // 월드에 스폰
-        World->SpawnActor(DuplicatedActor);
-		// 고유 이름 생성 및 설정
-       
-        PastedActors.push_back(DuplicatedActor);
-    }
+    // 원형들을 한 번에 복제/등록 (이름 일괄 생성, BVH 증분 삽입 한 번)
+    PastedActors = World->DuplicateActors(CopiedActors, SpawnOffset);
 
     if (!PastedActors.empty())
     {
@@ -86,6 +70,15 @@ bool UEditorClipboard::HasCopiedActors() const
 
 void UEditorClipboard::Clear()
 {
-    CopiedActors.clear();
+    DestroyCopiedActors();
     UE_LOG("EditorClipboard: Clipboard cleared");
 }
+
+void UEditorClipboard::DestroyCopiedActors()
+{
+    for (AActor* Prototype : CopiedActors)
+    {
+        ObjectFactory::DeleteObject(Prototype);
+    }
+    CopiedActors.clear();
+}
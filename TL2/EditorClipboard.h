@@ -8,8 +8,9 @@ class UWorld;
 /**
  * EditorClipboard
  * - 에디터에서 Copy/Paste 기능을 담당하는 싱글톤 클래스
- * - Ctrl+C로 선택된 액터들을 복사
- * - Ctrl+V로 복사된 액터들을 붙여넣기
+ * - Ctrl+C로 선택된 액터들을 월드 밖 원형(prototype)으로 한 번 복제해 보관
+ *   (원본이 이후 수정/삭제되어도 복사 시점 상태로 붙여넣음)
+ * - Ctrl+V로 원형들을 UWorld::DuplicateActors로 한 번에 붙여넣기
  */
 class UEditorClipboard
 {
@@ -29,7 +30,7 @@ public:
     void Clear();
 
     /** 복사된 액터 개수 반환 */
-    int32 GetCopiedActorCount() const { return static_cast<int32>(CopiedActors.size()); }
+    int32 GetCopiedActorCount() const { return CopiedActors.Num(); }
 
 private:
     UEditorClipboard() = default;
@@ -38,5 +39,7 @@ private:
     UEditorClipboard(const UEditorClipboard&) = delete;
     UEditorClipboard& operator=(const UEditorClipboard&) = delete;
 
-    TArray<AActor*> CopiedActors; // 복사된 액터 참조
+    void DestroyCopiedActors();
+
+    TArray<AActor*> CopiedActors; // 월드에 등록되지 않은 원형 액터 (클립보드 소유)
 };
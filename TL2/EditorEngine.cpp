@@ -9,6 +9,7 @@
 #include"SMultiViewportWindow.h"
 #include "EditorClipboard.h"
 #include "UI/UIManager.h"
+#include "Picking.h"
 #include "GizmoActor.h"
 UEditorEngine::UEditorEngine()
 {
@@ -105,6 +106,7 @@ void UEditorEngine::StartPIE()
 
     // GWorld를 PIE 월드로 전환
     GWorld = PIEWorld;
+    CPickingSystem::InvalidatePickingCache();
 
     // 메인 뷰포트 ViewportClient를 PIE 월드로 전환
     PIEWorld->GetMainViewport()->GetViewportClient()->SetWorld(PIEWorld);
@@ -139,6 +141,7 @@ void UEditorEngine::EndPIE()
     // ViewportClient의 World를 에디터 월드로 복원
     UWorld* EditorWorld = GetWorld(EWorldType::Editor);
     GWorld = EditorWorld;
+    CPickingSystem::InvalidatePickingCache();	// PIE 월드는 다음 Tick에 삭제되므로 그 컴포넌트를 가리키는 결과를 버림
 
     if (EditorWorld && EditorWorld->GetMainViewport())
     {
@@ -212,11 +215,7 @@ void UEditorEngine::ProcessEditorShortcuts()
                 // 붙여넣은 액터들을 선택
                 if (!PastedActors.empty())
                 {
-                    USelectionManager::GetInstance().ClearSelection();
-                    for (AActor* Actor : PastedActors)
-                    {
-                        USelectionManager::GetInstance().SelectActor(Actor);
-                    }
+                    USelectionManager::GetInstance().SelectActors(PastedActors);
 
                     // 첫 번째 액터를 Gizmo 타겟으로 설정
                     AGizmoActor* GizmoActor = EditorWorld->GetGizmoActor();
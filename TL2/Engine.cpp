@@ -2,6 +2,7 @@
 #include "pch.h"
 #include "Engine.h"
 #include "World.h"
+#include "Picking.h"
 
 UWorld* GWorld = nullptr;
 UEngine* GEngine = nullptr;
@@ -54,6 +55,7 @@ void UEngine::SetWorld(UWorld* InWorld, EWorldType InType)
             {
                 GWorld = InWorld; // 현재 활성 월드 갱신
                 GWorld->WorldType = InType;
+                CPickingSystem::InvalidatePickingCache();
             }
             return;
         }
@@ -69,6 +71,7 @@ void UEngine::SetWorld(UWorld* InWorld, EWorldType InType)
     {
         GWorld = InWorld;
         GWorld->WorldType = InType;
+        CPickingSystem::InvalidatePickingCache();
     }
 }
 void UEngine::Render()
@@ -39,6 +39,22 @@ void FViewportClient::Draw(FViewport* Viewport)
         return;
     }
 
+    if (ACameraActor* ViewCamera = PrepareCamera(Viewport))
+    {
+        // 월드의 모든 액터들을 렌더링
+        World->SetViewModeIndex(ViewModeIndex);
+        World->RenderViewports(ViewCamera, Viewport);
+        // Gizmo rendering moved to PostProcessing in World::RenderGizmo()
+    }
+}
+
+ACameraActor* FViewportClient::PrepareCamera(FViewport* Viewport)
+{
+    if (!Viewport || !World)
+    {
+        return nullptr;
+    }
+
     switch (ViewportType)
     {
     case EViewportType::Perspective:
@@ -53,12 +69,6 @@ void FViewportClient::Draw(FViewport* Viewport)
             PerspectiveCameraPosition = Camera->GetActorLocation();
             PerspectiveCameraRotation = Camera->GetActorRotation() ;
             PerspectiveCameraFov = Camera->GetCameraComponent()->GetFOV();
-            if (World)
-            {
-                World->SetViewModeIndex(ViewModeIndex);
-                World->RenderViewports(Camera, Viewport);
-                // Gizmo rendering moved to PostProcessing in World::RenderGizmo()
-            }
             break;
         }
     case EViewportType::Orthographic_Top:
@@ -71,17 +81,10 @@ void FViewportClient::Draw(FViewport* Viewport)
             Camera = ViewPortCamera;
             Camera->GetCameraComponent()->SetProjectionMode(ECameraProjectionMode::Orthographic);
             SetupCameraMode();
-
-            // 월드의 모든 액터들을 렌더링
-            if (World)
-            {
-                World->SetViewModeIndex(ViewModeIndex);
-                World->RenderViewports(Camera, Viewport);
-                // Gizmo rendering moved to PostProcessing in World::RenderGizmo()
-            }
             break;
         }
     }
+    return Camera;
 }
 
 
@@ -141,6 +144,17 @@ void FViewportClient::MouseMove(FViewport* Viewport, int32 X, int32 Y)
         GizmoActor->ProcessGizmoInteraction(Camera, Viewport, static_cast<float>(X), static_cast<float>(Y));
     }
 
+    if (bMarqueePending && bIsMouseButtonDown)
+    {
+        MarqueeEndX = X;
+        MarqueeEndY = Y;
+        if (!bMarqueeActive &&
+            (std::abs(X - MarqueeStartX) > MarqueeDragThreshold || std::abs(Y - MarqueeStartY) > MarqueeDragThreshold))
+        {
+            bMarqueeActive = true;
+        }
+    }
+
     bool bCanOrthographicCameraMove = !bIsMouseButtonDown && bIsMouseRightButtonDown && (World->IsPIEWorld() || !GizmoActor->GetbIsHovering());
     if (bCanOrthographicCameraMove) // 직교투영이고 마우스 버튼이 눌려있을 때
     {
@@ -223,6 +237,9 @@ void FViewportClient::MouseButtonDown(FViewport* Viewport, int32 X, int32 Y, int
         }
         PickedComponent = CPickingSystem::PerformGlobalBVHPicking(AllActors, Camera, ViewportMousePos, ViewportSize, ViewportOffset, PickingAspectRatio, Viewport);
 
+        bMarqueePending = false;
+        bMarqueeActive = false;
+
         if (PickedComponent)
         {
             PickedActor = PickedComponent->GetOwner();
@@ -238,9 +255,17 @@ void FViewportClient::MouseButtonDown(FViewport* Viewport, int32 X, int32 Y, int
         }
         else
         {
-            // Clear selection if nothing was picked
-            USelectionManager::GetInstance().ClearSelection();
-            UUIManager::GetInstance().ResetPickedActor();
+            // Clear selection if nothing was picked (Ctrl을 누르고 있으면 마퀴로 추가 선택할 수 있도록 유지)
+            if (!UInputManager::GetInstance().IsKeyDown(VK_CONTROL))
+            {
+                USelectionManager::GetInstance().ClearSelection();
+                UUIManager::GetInstance().ResetPickedActor();
+            }
+
+            // 빈 곳 클릭: 드래그하면 마퀴 선택
+            bMarqueePending = true;
+            MarqueeStartX = MarqueeEndX = X;
+            MarqueeStartY = MarqueeEndY = Y;
         }
     }
     else if (Button == 1) {//우클릭시
@@ -257,6 +282,38 @@ void FViewportClient::MouseButtonUp(FViewport* Viewport, int32 X, int32 Y, int32
     if (Button == 0) // Left mouse button
     {
         bIsMouseButtonDown = false;
+
+        if (bMarqueeActive && Viewport && World && !World->IsPIEWorld())
+        {
+            MarqueeEndX = X;
+            MarqueeEndY = Y;
+
+            FVector2D ViewportSize(static_cast<float>(Viewport->GetSizeX()), static_cast<float>(Viewport->GetSizeY()));
+            float PickingAspectRatio = ViewportSize.Y > 0.0f ? ViewportSize.X / ViewportSize.Y : 1.0f;
+
+            TArray<AActor*> MarqueeActors;
+            CPickingSystem::PerformMarqueeSelection(Camera,
+                FVector2D(static_cast<float>(MarqueeStartX), static_cast<float>(MarqueeStartY)),
+                FVector2D(static_cast<float>(MarqueeEndX), static_cast<float>(MarqueeEndY)),
+                ViewportSize, PickingAspectRatio, Viewport, true, MarqueeActors);
+
+            // 결과는 액터마다 SelectActor를 부르지 않고 한 번에 반영
+            USelectionManager& SelectionManager = USelectionManager::GetInstance();
+            SelectionManager.SelectActors(MarqueeActors, UInputManager::GetInstance().IsKeyDown(VK_CONTROL));
+
+            if (AActor* PrimaryActor = SelectionManager.GetSelectedActor())
+            {
+                UUIManager::GetInstance().SetPickedActor(PrimaryActor);
+                if (AGizmoActor* GizmoActor = World->GetGizmoActor())
+                {
+                    GizmoActor->SetTargetActor(PrimaryActor);
+                    GizmoActor->SetActorLocation(PrimaryActor->GetActorLocation());
+                }
+            }
+        }
+
+        bMarqueePending = false;
+        bMarqueeActive = false;
     }
     else
     {
@@ -265,6 +322,18 @@ void FViewportClient::MouseButtonUp(FViewport* Viewport, int32 X, int32 Y, int32
     }
 }
 
+bool FViewportClient::GetMarqueeRect(FVector2D& OutStart, FVector2D& OutEnd) const
+{
+    if (!bMarqueeActive)
+    {
+        return false;
+    }
+
+    OutStart = FVector2D(static_cast<float>(MarqueeStartX), static_cast<float>(MarqueeStartY));
+    OutEnd = FVector2D(static_cast<float>(MarqueeEndX), static_cast<float>(MarqueeEndY));
+    return true;
+}
+
 void FViewportClient::MouseWheel(float DeltaSeconds)
 {
     if (!Camera) return;
@@ -32,6 +32,8 @@ public:
 
     // 렌더링
     virtual void Draw(FViewport* Viewport);
+    // 뷰포트 타입에 맞게 카메라를 설정하고 반환 (Draw 및 가시성 사전 계산에서 공용)
+    ACameraActor* PrepareCamera(FViewport* Viewport);
     virtual void Tick(float DeltaTime);
 
     // 입력 처리
@@ -62,6 +64,9 @@ public:
 
     EViewModeIndex GetViewModeIndex() { return ViewModeIndex;}
 
+    // 드래그 중인 마퀴(박스) 선택 사각형 (뷰포트 로컬 픽셀, 드래그 중이 아니면 false)
+    bool GetMarqueeRect(FVector2D& OutStart, FVector2D& OutEnd) const;
+
 
 protected:
     EViewportType ViewportType = EViewportType::Perspective;
@@ -82,6 +87,15 @@ protected:
     //뷰모드
     EViewModeIndex ViewModeIndex = EViewModeIndex::VMI_Lit;
 
+    // 마퀴 선택: 빈 곳을 좌클릭한 뒤 임계값 이상 드래그하면 시작, 버튼을 떼면 한 번에 선택
+    bool bMarqueePending = false;
+    bool bMarqueeActive = false;
+    int32 MarqueeStartX{};
+    int32 MarqueeStartY{};
+    int32 MarqueeEndX{};
+    int32 MarqueeEndY{};
+    static constexpr int32 MarqueeDragThreshold = 4;
+
     //원근 투영
     bool PerspectiveCameraInput = false;
     FVector PerspectiveCameraPosition;
@@ -64,6 +64,27 @@ void FFrustum::Update(const FMatrix& InViewProjectionMatrix)
 			Planes[i].Distance /= NormalLength;
 		}
 	}
+
+	// SIMD 분류용 SoA 레이아웃 갱신
+	for (int i = 0; i < 8; ++i)
+	{
+		if (i < 6)
+		{
+			PlaneNX[i] = Planes[i].Normal.X;
+			PlaneNY[i] = Planes[i].Normal.Y;
+			PlaneNZ[i] = Planes[i].Normal.Z;
+			PlaneD[i] = Planes[i].Distance;
+		}
+		else
+		{
+			// 패딩 평면: 법선 0, 거리 1 → 어떤 박스든 항상 안쪽
+			PlaneNX[i] = PlaneNY[i] = PlaneNZ[i] = 0.0f;
+			PlaneD[i] = 1.0f;
+		}
+		PlaneAbsNX[i] = std::fabs(PlaneNX[i]);
+		PlaneAbsNY[i] = std::fabs(PlaneNY[i]);
+		PlaneAbsNZ[i] = std::fabs(PlaneNZ[i]);
+	}
 }
 
 /**
@@ -102,3 +123,92 @@ bool FFrustum::IsVisible(FBound& InBox) const
 	// 6개의 모든 평면 검사를 통과했다면, AABB는 절두체와 교차하거나 내부에 있는 것입니다.
 	return true;
 }
+
+/**
+ * 평면 마스크를 사용해 AABB를 절두체에 대해 분류합니다.
+ * 박스를 Center/Extent로 바꾼 뒤 4개 평면씩 SSE로 동시에 검사합니다.
+ *  - Center까지의 거리 + 투영 반경 < 0 이면 그 평면의 완전히 바깥
+ *  - Center까지의 거리 - 투영 반경 >= 0 이면 그 평면의 완전히 안쪽
+ *
+ * @param InBox 검사할 AABB입니다.
+ * @param InOutPlaneMask 검사할 평면 비트 마스크입니다. 완전히 안쪽인 평면의 비트는 제거됩니다.
+ * @return Outside / Intersects / Inside
+ */
+EFrustumContainment FFrustum::ClassifyBox(const FBound& InBox, uint32& InOutPlaneMask) const
+{
+	if (InOutPlaneMask == 0)
+	{
+		return EFrustumContainment::Inside;
+	}
+
+	const FVector Center = InBox.GetCenter();
+	const FVector Extent = InBox.GetExtent();
+	const __m128 CX = _mm_set1_ps(Center.X);
+	const __m128 CY = _mm_set1_ps(Center.Y);
+	const __m128 CZ = _mm_set1_ps(Center.Z);
+	const __m128 EX = _mm_set1_ps(Extent.X);
+	const __m128 EY = _mm_set1_ps(Extent.Y);
+	const __m128 EZ = _mm_set1_ps(Extent.Z);
+	const __m128 Zero = _mm_setzero_ps();
+
+	uint32 OutsideBits = 0;
+	uint32 InsideBits = 0;
+
+	for (int32 Batch = 0; Batch < 2; ++Batch)
+	{
+		const int32 Base = Batch * 4;
+
+		// 이 묶음의 4개 평면 중 검사할 평면이 없으면 건너뜀
+		if (((InOutPlaneMask >> Base) & 0xF) == 0)
+		{
+			continue;
+		}
+
+		__m128 Dist = _mm_load_ps(&PlaneD[Base]);
+		Dist = _mm_add_ps(Dist, _mm_mul_ps(_mm_load_ps(&PlaneNX[Base]), CX));
+		Dist = _mm_add_ps(Dist, _mm_mul_ps(_mm_load_ps(&PlaneNY[Base]), CY));
+		Dist = _mm_add_ps(Dist, _mm_mul_ps(_mm_load_ps(&PlaneNZ[Base]), CZ));
+
+		__m128 Radius = _mm_mul_ps(_mm_load_ps(&PlaneAbsNX[Base]), EX);
+		Radius = _mm_add_ps(Radius, _mm_mul_ps(_mm_load_ps(&PlaneAbsNY[Base]), EY));
+		Radius = _mm_add_ps(Radius, _mm_mul_ps(_mm_load_ps(&PlaneAbsNZ[Base]), EZ));
+
+		OutsideBits |= static_cast<uint32>(_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(Dist, Radius), Zero))) << Base;
+		InsideBits |= static_cast<uint32>(_mm_movemask_ps(_mm_cmpge_ps(_mm_sub_ps(Dist, Radius), Zero))) << Base;
+	}
+
+	if (OutsideBits & InOutPlaneMask)
+	{
+		return EFrustumContainment::Outside;
+	}
+
+	InOutPlaneMask &= ~InsideBits;
+	return InOutPlaneMask == 0 ? EFrustumContainment::Inside : EFrustumContainment::Intersects;
+}
+
+/**
+ * 삼각형을 평면별로 분리 검사합니다.
+ * 세 꼭짓점이 모두 한 평면의 바깥(음수 공간)에 있으면 그 평면이 분리축이므로 겹치지 않습니다.
+ * 절두체 모서리 근처를 비스듬히 지나는 큰 삼각형은 true가 될 수 있습니다. (보수적)
+ *
+ * @param InPlaneMask 검사할 평면 비트 마스크입니다. (상위 노드에서 완전히 안쪽으로 판정된 평면 제외)
+ */
+bool FFrustum::IntersectsTriangle(const FVector& A, const FVector& B, const FVector& C, uint32 InPlaneMask) const
+{
+	for (int32 i = 0; i < 6; ++i)
+	{
+		if ((InPlaneMask & (1u << i)) == 0)
+		{
+			continue;
+		}
+
+		const FPlane& CurrentPlane = Planes[i];
+		if (FVector::Dot(CurrentPlane.Normal, A) + CurrentPlane.Distance < 0.0f &&
+			FVector::Dot(CurrentPlane.Normal, B) + CurrentPlane.Distance < 0.0f &&
+			FVector::Dot(CurrentPlane.Normal, C) + CurrentPlane.Distance < 0.0f)
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -9,9 +9,20 @@ struct FPlane
 	float   Distance;
 };
 
+// 평면 마스크 기반 AABB 분류 결과
+enum class EFrustumContainment : uint8
+{
+	Outside,	// 어느 한 평면의 완전히 바깥
+	Intersects,	// 하나 이상의 평면과 걸쳐 있음
+	Inside		// 검사한 모든 평면의 완전히 안쪽
+};
+
 class FFrustum
 {
 public:
+	// 6개 평면을 모두 검사하는 초기 평면 마스크
+	static constexpr uint32 AllPlanesMask = 0x3F;
+
 	// View-Projection 행렬로부터 6개의 평면을 추출하여 절두체를 업데이트합니다.
 	void Update(const FMatrix& InViewProjectionMatrix);
 
@@ -19,6 +30,23 @@ public:
 	//  AABB가 보이거나 교차하면 true, 완전히 보이지 않아 컬링 대상이면 false를 반환합니다.
 	bool IsVisible(FBound& InBox) const;
 
+	// InOutPlaneMask에 켜진 평면만 SIMD로 한 번에 검사합니다.
+	// 완전히 안쪽으로 판정된 평면의 비트는 마스크에서 제거되어 자식 노드 검사에서 생략됩니다.
+	EFrustumContainment ClassifyBox(const FBound& InBox, uint32& InOutPlaneMask) const;
+
+	// 삼각형이 절두체와 겹칠 수 있는지 검사합니다. (InPlaneMask에 켜진 평면만)
+	// 세 꼭짓점이 모두 같은 평면의 바깥이면 false, 그 외에는 true인 보수적 판정입니다.
+	bool IntersectsTriangle(const FVector& A, const FVector& B, const FVector& C, uint32 InPlaneMask = AllPlanesMask) const;
+
 private:
 	FPlane Planes[6];
-};
\ No newline at end of file
+
+	// SIMD 검사용 SoA 평면 데이터 (6개 평면 + 항상 안쪽으로 판정되는 패딩 2개)
+	alignas(16) float PlaneNX[8];
+	alignas(16) float PlaneNY[8];
+	alignas(16) float PlaneNZ[8];
+	alignas(16) float PlaneD[8];
+	alignas(16) float PlaneAbsNX[8];
+	alignas(16) float PlaneAbsNY[8];
+	alignas(16) float PlaneAbsNZ[8];
+};
@@ -22,5 +22,5 @@ void UGizmoArrowComponent::Render(URenderer* Renderer, const FMatrix& View, cons
     // 1. 메쉬 렌더링 (항상 실행)
     Renderer->UpdateConstantBuffer(GetWorldMatrix(), View, Proj);
     Renderer->PrepareShader(GetMaterial()->GetShader());
-    Renderer->DrawIndexedPrimitiveComponent(GetStaticMesh(), D3D10_PRIMITIVE_TOPOLOGY_TRIANGLELIST, MaterailSlots);
+    Renderer->DrawIndexedPrimitiveComponent(GetStaticMesh(), ERHIPrimitiveTopology::TriangleList, MaterailSlots);
 }
@@ -0,0 +1,289 @@
+﻿#include "pch.h"
+#include "GizmoCollisionProxy.h"
+#include "ObjManager.h"
+#include <immintrin.h>
+#include <algorithm>
+#include <numeric>
+#include <cfloat>
+#include <memory>
+
+namespace
+{
+	// 로컬 공간 레이 방향은 정규화하지 않으므로 평행 판정은 상대 크기와 무관하게 아주 작은 값만 거른다
+	constexpr float ParallelEpsilon = 1e-12f;
+
+	// 좌표축과 평행한 레이의 역수가 무한대가 되어 0 * inf = NaN이 나오지 않도록 하는 최소 성분
+	constexpr float MinDirComponent = 1e-12f;
+
+	constexpr int32 MaxTraversalDepth = 64;
+
+	// 프록시는 레지스트리가 소유 (프로그램 종료 시 함께 해제, 반환하는 포인터는 그때까지 유효)
+	TMap<FString, std::unique_ptr<FGizmoCollisionProxy>>& GetProxyRegistry()
+	{
+		static TMap<FString, std::unique_ptr<FGizmoCollisionProxy>> Registry;
+		return Registry;
+	}
+
+	float SafeInverse(float Value)
+	{
+		if (std::fabs(Value) < MinDirComponent)
+		{
+			Value = Value < 0.0f ? -MinDirComponent : MinDirComponent;
+		}
+		return 1.0f / Value;
+	}
+}
+
+void FGizmoRayPacket::Reset()
+{
+	for (int32 Lane = 0; Lane < Lanes; ++Lane)
+	{
+		OriginX[Lane] = OriginY[Lane] = OriginZ[Lane] = 0.0f;
+		DirX[Lane] = DirY[Lane] = DirZ[Lane] = 0.0f;
+		InvDirX[Lane] = InvDirY[Lane] = InvDirZ[Lane] = 0.0f;
+		MaxT[Lane] = -1.0f;
+	}
+}
+
+void FGizmoRayPacket::SetLane(int32 Lane, const FVector& Origin, const FVector& Direction, float InMaxT)
+{
+	OriginX[Lane] = Origin.X;
+	OriginY[Lane] = Origin.Y;
+	OriginZ[Lane] = Origin.Z;
+	DirX[Lane] = Direction.X;
+	DirY[Lane] = Direction.Y;
+	DirZ[Lane] = Direction.Z;
+	InvDirX[Lane] = SafeInverse(Direction.X);
+	InvDirY[Lane] = SafeInverse(Direction.Y);
+	InvDirZ[Lane] = SafeInverse(Direction.Z);
+	MaxT[Lane] = InMaxT;
+}
+
+const FGizmoCollisionProxy* FGizmoCollisionProxy::FindOrBake(const FString& MeshPath)
+{
+	TMap<FString, std::unique_ptr<FGizmoCollisionProxy>>& Registry = GetProxyRegistry();
+	if (const std::unique_ptr<FGizmoCollisionProxy>* Found = Registry.Find(MeshPath))
+	{
+		return Found->get();
+	}
+
+	// 읽기 실패도 (nullptr로) 기록해 두어 매 프레임 다시 로드하지 않음
+	std::unique_ptr<FGizmoCollisionProxy> Proxy;
+	if (FStaticMesh* Mesh = FObjManager::LoadObjStaticMeshAsset(MeshPath))
+	{
+		Proxy = std::make_unique<FGizmoCollisionProxy>();
+		Proxy->Bake(*Mesh);
+	}
+	const FGizmoCollisionProxy* Result = Proxy.get();
+	Registry.Emplace(MeshPath, std::move(Proxy));
+	return Result;
+}
+
+void FGizmoCollisionProxy::Bake(const FStaticMesh& Mesh)
+{
+	// 인덱스가 있으면 인덱스 삼각형, 없으면 정점 배열을 순차 삼각형으로 간주 (기존 메시 검사와 동일)
+	const bool bIndexed = Mesh.Indices.Num() >= 3;
+	const int32 NumTriangles = bIndexed ? Mesh.Indices.Num() / 3 : Mesh.Vertices.Num() / 3;
+
+	TArray<FTriangle> Source;
+	TArray<FVector> Centroids;
+	Source.Reserve(NumTriangles);
+	Centroids.Reserve(NumTriangles);
+
+	for (int32 Tri = 0; Tri < NumTriangles; ++Tri)
+	{
+		const int32 Base = Tri * 3;
+		const FVector& A = Mesh.Vertices[bIndexed ? Mesh.Indices[Base + 0] : Base + 0].pos;
+		const FVector& B = Mesh.Vertices[bIndexed ? Mesh.Indices[Base + 1] : Base + 1].pos;
+		const FVector& C = Mesh.Vertices[bIndexed ? Mesh.Indices[Base + 2] : Base + 2].pos;
+
+		Source.Add({ A, B - A, C - A });
+		Centroids.Add((A + B + C) * (1.0f / 3.0f));
+	}
+
+	Nodes.clear();
+	Triangles.clear();
+	Nodes.Reserve(std::max(1, 2 * NumTriangles / MaxLeafTriangles));
+	Triangles.Reserve(NumTriangles);
+
+	if (NumTriangles > 0)
+	{
+		BuildNode(Source, Centroids, 0, NumTriangles);
+	}
+}
+
+void FGizmoCollisionProxy::BuildNode(TArray<FTriangle>& Source, TArray<FVector>& Centroids, int32 First, int32 Count)
+{
+	const int32 NodeIndex = Nodes.Num();
+	Nodes.Add(FNode());
+
+	// 노드 바운드 / 무게중심 바운드
+	FVector BoundMin(FLT_MAX, FLT_MAX, FLT_MAX), BoundMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	FVector CentroidMin = BoundMin, CentroidMax = BoundMax;
+	for (int32 Index = First; Index < First + Count; ++Index)
+	{
+		const FTriangle& Tri = Source[Index];
+		const FVector Points[3] = { Tri.V0, Tri.V0 + Tri.E1, Tri.V0 + Tri.E2 };
+		for (const FVector& Point : Points)
+		{
+			BoundMin = FVector(std::min(BoundMin.X, Point.X), std::min(BoundMin.Y, Point.Y), std::min(BoundMin.Z, Point.Z));
+			BoundMax = FVector(std::max(BoundMax.X, Point.X), std::max(BoundMax.Y, Point.Y), std::max(BoundMax.Z, Point.Z));
+		}
+		const FVector& Centroid = Centroids[Index];
+		CentroidMin = FVector(std::min(CentroidMin.X, Centroid.X), std::min(CentroidMin.Y, Centroid.Y), std::min(CentroidMin.Z, Centroid.Z));
+		CentroidMax = FVector(std::max(CentroidMax.X, Centroid.X), std::max(CentroidMax.Y, Centroid.Y), std::max(CentroidMax.Z, Centroid.Z));
+	}
+
+	{
+		FNode& Node = Nodes[NodeIndex];
+		Node.Min[0] = BoundMin.X; Node.Min[1] = BoundMin.Y; Node.Min[2] = BoundMin.Z;
+		Node.Max[0] = BoundMax.X; Node.Max[1] = BoundMax.Y; Node.Max[2] = BoundMax.Z;
+	}
+
+	const FVector Extent = CentroidMax - CentroidMin;
+	const float LargestExtent = std::max(Extent.X, std::max(Extent.Y, Extent.Z));
+	if (Count <= MaxLeafTriangles || LargestExtent <= 0.0f)
+	{
+		// 리프: 삼각형을 최종 배열에 연속으로 배치
+		Nodes[NodeIndex].FirstOrRight = Triangles.Num();
+		Nodes[NodeIndex].Count = Count;
+		for (int32 Index = First; Index < First + Count; ++Index)
+		{
+			Triangles.Add(Source[Index]);
+		}
+		return;
+	}
+
+	// 가장 긴 무게중심 축의 중앙값으로 분할
+	const int32 Axis = (Extent.X >= Extent.Y && Extent.X >= Extent.Z) ? 0 : (Extent.Y >= Extent.Z ? 1 : 2);
+	const int32 Half = Count / 2;
+
+	TArray<int32> Order(Count);
+	std::iota(Order.begin(), Order.end(), First);
+	std::nth_element(Order.begin(), Order.begin() + Half, Order.end(), [&](int32 L, int32 R)
+		{
+			return Centroids[L][Axis] < Centroids[R][Axis];
+		});
+
+	TArray<FTriangle> SortedTriangles;
+	TArray<FVector> SortedCentroids;
+	SortedTriangles.Reserve(Count);
+	SortedCentroids.Reserve(Count);
+	for (int32 Index : Order)
+	{
+		SortedTriangles.Add(Source[Index]);
+		SortedCentroids.Add(Centroids[Index]);
+	}
+	std::copy(SortedTriangles.begin(), SortedTriangles.end(), Source.begin() + First);
+	std::copy(SortedCentroids.begin(), SortedCentroids.end(), Centroids.begin() + First);
+
+	// 왼쪽 자식은 바로 다음 노드, 오른쪽 자식 인덱스만 기록
+	Nodes[NodeIndex].Count = 0;
+	BuildNode(Source, Centroids, First, Half);
+	Nodes[NodeIndex].FirstOrRight = Nodes.Num();
+	BuildNode(Source, Centroids, First + Half, Count - Half);
+}
+
+bool FGizmoCollisionProxy::IntersectPacket(const FGizmoRayPacket& Rays, float OutT[FGizmoRayPacket::Lanes]) const
+{
+	for (int32 Lane = 0; Lane < FGizmoRayPacket::Lanes; ++Lane)
+	{
+		OutT[Lane] = FLT_MAX;
+	}
+	if (Nodes.IsEmpty()) return false;
+
+	const __m128 OX = _mm_load_ps(Rays.OriginX), OY = _mm_load_ps(Rays.OriginY), OZ = _mm_load_ps(Rays.OriginZ);
+	const __m128 DX = _mm_load_ps(Rays.DirX), DY = _mm_load_ps(Rays.DirY), DZ = _mm_load_ps(Rays.DirZ);
+	const __m128 IX = _mm_load_ps(Rays.InvDirX), IY = _mm_load_ps(Rays.InvDirY), IZ = _mm_load_ps(Rays.InvDirZ);
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 One = _mm_set1_ps(1.0f);
+	const __m128 Epsilon = _mm_set1_ps(KINDA_SMALL_NUMBER);
+	const __m128 DetEpsilon = _mm_set1_ps(ParallelEpsilon);
+	const __m128 AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+	// 레인별 현재 최근접 거리 (이보다 먼 노드/삼각형은 건너뜀)
+	__m128 BestT = _mm_load_ps(Rays.MaxT);
+	__m128 HitMask = Zero;
+
+	int32 Stack[MaxTraversalDepth];
+	int32 StackSize = 0;
+	Stack[StackSize++] = 0;
+
+	while (StackSize > 0)
+	{
+		const FNode& Node = Nodes[Stack[--StackSize]];
+
+		// 4레이 slab 검사: 어떤 레인도 현재 최근접보다 가까이 노드에 들어가지 않으면 건너뜀
+		const __m128 T1X = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(Node.Min[0]), OX), IX);
+		const __m128 T2X = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(Node.Max[0]), OX), IX);
+		const __m128 T1Y = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(Node.Min[1]), OY), IY);
+		const __m128 T2Y = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(Node.Max[1]), OY), IY);
+		const __m128 T1Z = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(Node.Min[2]), OZ), IZ);
+		const __m128 T2Z = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(Node.Max[2]), OZ), IZ);
+
+		const __m128 TNear = _mm_max_ps(_mm_max_ps(_mm_min_ps(T1X, T2X), _mm_min_ps(T1Y, T2Y)), _mm_max_ps(_mm_min_ps(T1Z, T2Z), Zero));
+		const __m128 TFar = _mm_min_ps(_mm_min_ps(_mm_max_ps(T1X, T2X), _mm_max_ps(T1Y, T2Y)), _mm_min_ps(_mm_max_ps(T1Z, T2Z), BestT));
+		if (_mm_movemask_ps(_mm_cmple_ps(TNear, TFar)) == 0) continue;
+
+		if (Node.Count == 0)
+		{
+			if (StackSize + 2 > MaxTraversalDepth) continue;
+			Stack[StackSize++] = Node.FirstOrRight;
+			Stack[StackSize++] = static_cast<int32>(&Node - Nodes.data()) + 1;
+			continue;
+		}
+
+		// 리프: 삼각형 하나를 4레이에 대해 Möller–Trumbore (양면)
+		for (int32 Index = Node.FirstOrRight; Index < Node.FirstOrRight + Node.Count; ++Index)
+		{
+			const FTriangle& Tri = Triangles[Index];
+			const __m128 E1X = _mm_set1_ps(Tri.E1.X), E1Y = _mm_set1_ps(Tri.E1.Y), E1Z = _mm_set1_ps(Tri.E1.Z);
+			const __m128 E2X = _mm_set1_ps(Tri.E2.X), E2Y = _mm_set1_ps(Tri.E2.Y), E2Z = _mm_set1_ps(Tri.E2.Z);
+
+			// P = D x E2, Det = E1 . P
+			const __m128 PX = _mm_sub_ps(_mm_mul_ps(DY, E2Z), _mm_mul_ps(DZ, E2Y));
+			const __m128 PY = _mm_sub_ps(_mm_mul_ps(DZ, E2X), _mm_mul_ps(DX, E2Z));
+			const __m128 PZ = _mm_sub_ps(_mm_mul_ps(DX, E2Y), _mm_mul_ps(DY, E2X));
+			const __m128 Det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(E1X, PX), _mm_mul_ps(E1Y, PY)), _mm_mul_ps(E1Z, PZ));
+			const __m128 ValidDet = _mm_cmpgt_ps(_mm_and_ps(Det, AbsMask), DetEpsilon);
+			const __m128 InvDet = _mm_div_ps(One, Det);
+
+			// S = O - V0, U = (S . P) / Det
+			const __m128 SX = _mm_sub_ps(OX, _mm_set1_ps(Tri.V0.X));
+			const __m128 SY = _mm_sub_ps(OY, _mm_set1_ps(Tri.V0.Y));
+			const __m128 SZ = _mm_sub_ps(OZ, _mm_set1_ps(Tri.V0.Z));
+			const __m128 U = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(SX, PX), _mm_mul_ps(SY, PY)), _mm_mul_ps(SZ, PZ)), InvDet);
+
+			// Q = S x E1, V = (D . Q) / Det, T = (E2 . Q) / Det
+			const __m128 QX = _mm_sub_ps(_mm_mul_ps(SY, E1Z), _mm_mul_ps(SZ, E1Y));
+			const __m128 QY = _mm_sub_ps(_mm_mul_ps(SZ, E1X), _mm_mul_ps(SX, E1Z));
+			const __m128 QZ = _mm_sub_ps(_mm_mul_ps(SX, E1Y), _mm_mul_ps(SY, E1X));
+			const __m128 V = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(DX, QX), _mm_mul_ps(DY, QY)), _mm_mul_ps(DZ, QZ)), InvDet);
+			const __m128 T = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(E2X, QX), _mm_mul_ps(E2Y, QY)), _mm_mul_ps(E2Z, QZ)), InvDet);
+
+			__m128 Mask = ValidDet;
+			Mask = _mm_and_ps(Mask, _mm_cmpge_ps(U, _mm_sub_ps(Zero, Epsilon)));
+			Mask = _mm_and_ps(Mask, _mm_cmpge_ps(V, _mm_sub_ps(Zero, Epsilon)));
+			Mask = _mm_and_ps(Mask, _mm_cmple_ps(_mm_add_ps(U, V), _mm_add_ps(One, Epsilon)));
+			Mask = _mm_and_ps(Mask, _mm_cmpgt_ps(T, Epsilon));
+			Mask = _mm_and_ps(Mask, _mm_cmplt_ps(T, BestT));
+
+			BestT = _mm_or_ps(_mm_and_ps(Mask, T), _mm_andnot_ps(Mask, BestT));
+			HitMask = _mm_or_ps(HitMask, Mask);
+		}
+	}
+
+	const int32 LaneHits = _mm_movemask_ps(HitMask);
+	if (LaneHits == 0) return false;
+
+	alignas(16) float Best[FGizmoRayPacket::Lanes];
+	_mm_store_ps(Best, BestT);
+	for (int32 Lane = 0; Lane < FGizmoRayPacket::Lanes; ++Lane)
+	{
+		if (LaneHits & (1 << Lane))
+		{
+			OutT[Lane] = Best[Lane];
+		}
+	}
+	return true;
+}
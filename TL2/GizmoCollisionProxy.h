@@ -0,0 +1,73 @@
+﻿#pragma once
+
+struct FStaticMesh;
+
+/**
+ * FGizmoRayPacket
+ * - 기즈모 축 그룹(X/Y/Z 핸들)을 한 번에 검사하기 위한 4레인 SoA 레이 묶음
+ * - 레인마다 각 핸들의 로컬 공간 레이를 담는다 (방향을 정규화하지 않으므로 로컬 t = 월드 t)
+ */
+struct FGizmoRayPacket
+{
+	static constexpr int32 Lanes = 4;
+
+	alignas(16) float OriginX[Lanes];
+	alignas(16) float OriginY[Lanes];
+	alignas(16) float OriginZ[Lanes];
+	alignas(16) float DirX[Lanes];
+	alignas(16) float DirY[Lanes];
+	alignas(16) float DirZ[Lanes];
+	alignas(16) float InvDirX[Lanes];
+	alignas(16) float InvDirY[Lanes];
+	alignas(16) float InvDirZ[Lanes];
+	alignas(16) float MaxT[Lanes];		// 비활성 레인은 -1 (어떤 히트도 통과하지 못함)
+
+	FGizmoRayPacket() { Reset(); }
+
+	void Reset();
+	void SetLane(int32 Lane, const FVector& Origin, const FVector& Direction, float InMaxT = FLT_MAX);
+};
+
+/**
+ * FGizmoCollisionProxy
+ * - 기즈모 핸들 메시(화살표/링/스케일 핸들)를 메시 경로마다 한 번만 구운 충돌 프록시
+ * - 삼각형을 로컬 공간 그대로 (V0, E1, E2)로 보관하고 리프 4개 이하의 평평한 배열 BVH로 묶는다
+ * - 레이 묶음 4개를 SSE로 동시에 순회: 노드는 4레이 slab 검사, 리프는 삼각형 하나를 4레이 Möller–Trumbore로 검사
+ * - 매 프레임 정점 변환이 없으므로 호버 비용은 핸들 메시 정밀도와 거의 무관
+ */
+class FGizmoCollisionProxy
+{
+public:
+	// 메시 경로별 프록시 (처음 요청될 때 구움, 메시를 읽을 수 없으면 nullptr)
+	static const FGizmoCollisionProxy* FindOrBake(const FString& MeshPath);
+
+	// 레인별 가장 가까운 히트 거리 (미스면 FLT_MAX), 하나라도 맞으면 true
+	bool IntersectPacket(const FGizmoRayPacket& Rays, float OutT[FGizmoRayPacket::Lanes]) const;
+
+	int32 GetNumTriangles() const { return Triangles.Num(); }
+	int32 GetNumNodes() const { return Nodes.Num(); }
+
+private:
+	static constexpr int32 MaxLeafTriangles = 4;
+
+	struct FNode
+	{
+		float Min[3];
+		float Max[3];
+		int32 FirstOrRight;		// 리프: 첫 삼각형 인덱스, 내부: 오른쪽 자식 인덱스 (왼쪽 자식은 바로 다음 노드)
+		int32 Count;			// 리프 삼각형 수 (0이면 내부 노드)
+	};
+
+	struct FTriangle
+	{
+		FVector V0;
+		FVector E1;
+		FVector E2;
+	};
+
+	void Bake(const FStaticMesh& Mesh);
+	void BuildNode(TArray<FTriangle>& Source, TArray<FVector>& Centroids, int32 First, int32 Count);
+
+	TArray<FNode> Nodes;
+	TArray<FTriangle> Triangles;
+};
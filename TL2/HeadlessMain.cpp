@@ -0,0 +1,29 @@
+﻿// 헤드리스 RHI 코어 실행 파일 진입점 (에디터 빌드에서는 제외)
+// - windows.h/d3d11/UWorld 없이 정렬/제출 코어와 Null 컨텍스트만 링크해 CI에서 실행할 수 있다
+// - 빌드 대상: HeadlessMain.cpp MeshDrawCommand.cpp RHICommandList.cpp NullRHICommandContext.cpp TaskSystem.cpp PickingTimer.cpp
+//   예) g++ -std=c++20 -O2 -pthread <위 파일들> -o TL2Headless
+// - 사용법: TL2Headless [합성 드로우 수]
+#include "MeshDrawCommand.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+// FBenchmark가 출력하는 콘솔 로그 (에디터에서는 GlobalConsole.cpp가 정의)
+extern "C" void ConsoleLogV(const char* fmt, va_list args)
+{
+	vprintf(fmt, args);
+	printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+	const int32 NumDraws = argc > 1 ? atoi(argv[1]) : 100000;
+	if (NumDraws <= 0)
+	{
+		printf("usage: %s [NumDraws]\n", argv[0]);
+		return 1;
+	}
+
+	FMeshDrawSortBenchmark::Run(NumDraws);
+	return 0;
+}
@@ -0,0 +1,109 @@
+﻿#include "pch.h"
+#include "HeadlessRenderDriver.h"
+#include "StaticMeshComponent.h"
+#include "CameraActor.h"
+#include "Benchmark.h"
+
+FHeadlessRenderDriver::FFrameStats FHeadlessRenderDriver::RenderFrame(UWorld* World, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix)
+{
+	FFrameStats Stats;
+	NullContext.Reset();
+	if (!World)
+		return Stats;
+
+	// 1. 컬링: 에디터 뷰포트와 같은 FSceneVisibility 경로 (뷰포트가 없으므로 쇼 플래그는 적용하지 않음)
+	const FViewVisibility* Visibility = nullptr;
+	Stats.CullMs = FBenchmark::MeasureMs([&]()
+	{
+		World->FlushBVHUpdates();
+		SceneVisibility.Invalidate();
+		SceneVisibility.SetOcclusionCullingEnabled(World->GetSceneVisibility().IsOcclusionCullingEnabled());
+		Visibility = &SceneVisibility.ComputeViewImmediate(nullptr, ViewMatrix, ProjMatrix, World->GetBVH(), World->GetActors());
+	});
+	Stats.NumVisiblePrimitives = Visibility->Primitives.Num();
+	Stats.NumCulledActors = Visibility->CulledActorCount;
+	Stats.NumOcclusionCulled = Visibility->OcclusionCulledCount;
+
+	// 2. 기록: 정적 메시는 가시 목록 앞부분에 모여 있음
+	Stats.RecordMs = FBenchmark::MeasureMs([&]()
+	{
+		MeshDrawCommands.Reset();
+		for (const FVisiblePrimitive& Item : Visibility->Primitives)
+		{
+			if (Item.Type != EVisiblePrimitiveType::StaticMesh)
+				break;
+
+			const bool bSelected = Item.Owner && Item.Owner->IsSelected();
+			MeshDrawCommands.AddStaticMesh(static_cast<UStaticMeshComponent*>(Item.Primitive), Item.ViewDepth, bSelected);
+		}
+	});
+	Stats.NumMeshCommands = MeshDrawCommands.Num();
+
+	// 3. 정렬
+	Stats.SortMs = FBenchmark::MeasureMs([&]() { MeshDrawCommands.Sort(); });
+
+	// 4. RHI 커맨드 리스트 기록 (렌더러와 같은 초기 상태)
+	Stats.SubmitMs = FBenchmark::MeasureMs([&]()
+	{
+		RHICommands.Reset();
+		RHICommands.SetPrimitiveTopology(ERHIPrimitiveTopology::TriangleList);
+		RHICommands.SetDefaultSampler(0);
+		FRHIMeshDrawBackend Backend(RHICommands, ViewMatrix, ProjMatrix, FVector(1.0f, 1.0f, 0.0f));
+		Stats.SubmitResult = MeshDrawCommands.Submit(Backend);
+	});
+
+	// 5. 실행
+	Stats.ExecuteMs = FBenchmark::MeasureMs([&]() { RHICommands.Execute(NullContext); });
+
+	Stats.NumRHICommands = RHICommands.GetNumCommands();
+	Stats.RHICommandBytes = RHICommands.GetUsedBytes();
+	return Stats;
+}
+
+void FHeadlessRenderDriver::Run(UWorld* World, int32 NumFrames)
+{
+	if (!World || NumFrames <= 0)
+		return;
+
+	FMatrix ViewMatrix = FMatrix::Identity();
+	FMatrix ProjMatrix = FMatrix::PerspectiveFovLH(60.0f * (PI / 180.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+	if (ACameraActor* Camera = World->GetCameraActor())
+	{
+		ViewMatrix = Camera->GetViewMatrix();
+		ProjMatrix = Camera->GetProjectionMatrix();
+	}
+
+	FHeadlessRenderDriver Driver;
+	Driver.RenderFrame(World, ViewMatrix, ProjMatrix);	// 버퍼 용량 확보용 (측정에서 제외)
+
+	FFrameStats Total;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const FFrameStats Stats = Driver.RenderFrame(World, ViewMatrix, ProjMatrix);
+		Total.CullMs += Stats.CullMs;
+		Total.RecordMs += Stats.RecordMs;
+		Total.SortMs += Stats.SortMs;
+		Total.SubmitMs += Stats.SubmitMs;
+		Total.ExecuteMs += Stats.ExecuteMs;
+		Total.NumVisiblePrimitives = Stats.NumVisiblePrimitives;
+		Total.NumCulledActors = Stats.NumCulledActors;
+		Total.NumOcclusionCulled = Stats.NumOcclusionCulled;
+		Total.NumMeshCommands = Stats.NumMeshCommands;
+		Total.NumRHICommands = Stats.NumRHICommands;
+		Total.RHICommandBytes = Stats.RHICommandBytes;
+	}
+
+	FBenchmark Bench("RENDER HEADLESS");
+	const FNullRHICommandContext& Context = Driver.GetContext();
+	Bench.LogInfo("%d frames, %d visible primitives (%u actors frustum culled, %u occluded)",
+		NumFrames, Total.NumVisiblePrimitives, Total.NumCulledActors, Total.NumOcclusionCulled);
+	Bench.LogInfo("%d mesh commands -> %u RHI commands (%llu bytes)",
+		Total.NumMeshCommands, Total.NumRHICommands, Total.RHICommandBytes);
+	Bench.LogResult("cull", Total.CullMs / NumFrames, "per frame");
+	Bench.LogResult("record", Total.RecordMs / NumFrames, "per frame");
+	Bench.LogResult("sort", Total.SortMs / NumFrames, "per frame");
+	Bench.LogResult("submit", Total.SubmitMs / NumFrames, "per frame");
+	Bench.LogResult("execute (null)", Total.ExecuteMs / NumFrames, "per frame");
+	Bench.LogInfo("%u draws  %llu indices  shader %u  buffer %u  texture %u  material %u",
+		Context.DrawCalls, Context.Indices, Context.ShaderChanges, Context.BufferChanges, Context.TextureChanges, Context.MaterialChanges);
+}
@@ -0,0 +1,49 @@
+﻿#pragma once
+#include "MeshDrawCommand.h"
+#include "NullRHICommandContext.h"
+#include "SceneVisibility.h"
+
+class UWorld;
+
+/**
+ * FHeadlessRenderDriver
+ * - 렌더러/뷰포트 없이 월드의 정적 메시를 한 프레임 분량 기록하고 Null 컨텍스트에서 실행 (콘솔 RENDER HEADLESS)
+ * - FSceneVisibility 컬링(프러스텀 + 오클루전) → 보이는 정적 메시만 기록 → 정렬
+ *   → FRHIMeshDrawBackend로 RHI 커맨드 리스트 기록 → FNullRHICommandContext 실행
+ *   (UWorld::RenderViewports + URenderer::SubmitMeshDrawCommands와 같은 경로이며 실행 대상만 다름)
+ * - 월드 없이 코어(정렬/제출/Null 실행)만 돌리는 진입점은 HeadlessMain.cpp
+ */
+class FHeadlessRenderDriver
+{
+public:
+	struct FFrameStats
+	{
+		int32 NumVisiblePrimitives = 0;
+		uint32 NumCulledActors = 0;
+		uint32 NumOcclusionCulled = 0;
+		int32 NumMeshCommands = 0;
+		uint32 NumRHICommands = 0;
+		uint64 RHICommandBytes = 0;
+		double CullMs = 0.0;		// FSceneVisibility 컬링/정렬
+		double RecordMs = 0.0;		// 메시 드로우 커맨드 기록
+		double SortMs = 0.0;
+		double SubmitMs = 0.0;		// 정렬된 커맨드 → RHI 커맨드 리스트
+		double ExecuteMs = 0.0;		// Null 컨텍스트 실행
+		FMeshDrawSubmitResult SubmitResult;
+	};
+
+	FFrameStats RenderFrame(UWorld* World, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix);
+
+	// 마지막 RenderFrame의 실행 호출 집계
+	const FNullRHICommandContext& GetContext() const { return NullContext; }
+
+	// 월드 메인 카메라 시점으로 NumFrames 프레임을 실행하고 프레임 평균을 출력
+	static void Run(UWorld* World, int32 NumFrames = 10);
+
+private:
+	// 월드의 프레임 뷰 캐시를 건드리지 않도록 별도 인스턴스 사용
+	FSceneVisibility SceneVisibility;
+	FMeshDrawCommandList MeshDrawCommands;
+	FRHICommandList RHICommands;
+	FNullRHICommandContext NullContext;
+};
@@ -0,0 +1,227 @@
+﻿#include "pch.h"
+#include "IDBufferTile.h"
+#include "BoundingVolumeHierarchy.h"
+#include "Frustum.h"
+#include <immintrin.h>
+
+FIDBufferTile::FIDBufferTile()
+{
+	Depth.SetNum(Size * Size, 1.0f);
+	Ids.SetNum(Size * Size, InvalidId);
+}
+
+void FIDBufferTile::Begin(const FMatrix& InTileViewProjection)
+{
+	ViewProjection = InTileViewProjection;
+	std::fill(Depth.begin(), Depth.end(), 1.0f);
+	std::fill(Ids.begin(), Ids.end(), InvalidId);
+}
+
+uint32 FIDBufferTile::GetId(int32 X, int32 Y) const
+{
+	if (X < 0 || Y < 0 || X >= Size || Y >= Size)
+		return InvalidId;
+	return Ids[Y * Size + X];
+}
+
+float FIDBufferTile::GetDepth(int32 X, int32 Y) const
+{
+	if (X < 0 || Y < 0 || X >= Size || Y >= Size)
+		return 1.0f;
+	return Depth[Y * Size + X];
+}
+
+void FIDBufferTile::GatherTriangles(const FNarrowPhaseBVHNode* Node, const FFrustum& LocalFrustum, uint32 PlaneMask)
+{
+	if (!Node)
+		return;
+
+	if (LocalFrustum.ClassifyBox(Node->Bounds, PlaneMask) == EFrustumContainment::Outside)
+		return;
+
+	if (Node->IsLeaf())
+	{
+		for (const auto& Primitive : Node->Primitives)
+		{
+			TriangleScratch.Add(Primitive.TriangleIndex);
+		}
+		return;
+	}
+
+	GatherTriangles(Node->Left, LocalFrustum, PlaneMask);
+	GatherTriangles(Node->Right, LocalFrustum, PlaneMask);
+}
+
+int32 FIDBufferTile::RasterizeMesh(const FStaticMesh& Mesh, const FNarrowPhaseBVHNode* MeshBVH, const FMatrix& WorldMatrix, uint32 Id)
+{
+	const FMatrix WorldViewProjection = WorldMatrix * ViewProjection;
+
+	// 1. 타일 절두체와 겹치는 삼각형만 모음 (World * TileViewProj에서 뽑은 평면 = 메시 로컬 공간 절두체)
+	TriangleScratch.clear();
+	if (MeshBVH)
+	{
+		FFrustum LocalFrustum;
+		LocalFrustum.Update(WorldViewProjection);
+		GatherTriangles(MeshBVH, LocalFrustum, FFrustum::AllPlanesMask);
+	}
+	else
+	{
+		const int32 NumTriangles = Mesh.Indices.Num() / 3;
+		TriangleScratch.Reserve(NumTriangles);
+		for (int32 i = 0; i < NumTriangles; ++i)
+		{
+			TriangleScratch.Add(i);
+		}
+	}
+
+	// 2. 삼각형마다 클립 공간으로 변환 후 래스터화 (타일 밖 정점이 대부분이므로 메시 전체 정점 변환은 하지 않음)
+	for (int32 TriangleIndex : TriangleScratch)
+	{
+		FVector4 Clip[3];
+		for (int32 k = 0; k < 3; ++k)
+		{
+			const FVector& P = Mesh.Vertices[Mesh.Indices[TriangleIndex * 3 + k]].pos;
+			Clip[k] = FVector4(P.X, P.Y, P.Z, 1.0f) * WorldViewProjection;
+		}
+		RasterizeClipTriangle(Clip[0], Clip[1], Clip[2], Id);
+	}
+	return TriangleScratch.Num();
+}
+
+FVector4 FIDBufferTile::ToScreen(const FVector4& Clip) const
+{
+	const float InvW = 1.0f / Clip.W;
+	return FVector4(
+		(Clip.X * InvW * 0.5f + 0.5f) * Size,
+		(0.5f - Clip.Y * InvW * 0.5f) * Size,
+		Clip.Z * InvW,
+		Clip.W);
+}
+
+void FIDBufferTile::RasterizeClipTriangle(const FVector4& C0, const FVector4& C1, const FVector4& C2, uint32 Id)
+{
+	const FVector4 In[3] = { C0, C1, C2 };
+	const bool bInside[3] = { C0.Z >= 0.0f, C1.Z >= 0.0f, C2.Z >= 0.0f };
+	const int32 NumInside = int32(bInside[0]) + int32(bInside[1]) + int32(bInside[2]);
+
+	if (NumInside == 0)
+		return;
+
+	if (NumInside == 3)
+	{
+		RasterizeTriangle(ToScreen(C0), ToScreen(C1), ToScreen(C2), Id);
+		return;
+	}
+
+	// 근평면(z = 0)에 대한 Sutherland-Hodgman: 삼각형 하나는 최대 사각형 하나가 됨
+	FVector4 Out[4];
+	int32 NumOut = 0;
+	for (int32 i = 0; i < 3; ++i)
+	{
+		const FVector4& A = In[i];
+		const FVector4& B = In[(i + 1) % 3];
+		const bool bAIn = bInside[i];
+		const bool bBIn = bInside[(i + 1) % 3];
+
+		if (bAIn)
+		{
+			Out[NumOut++] = A;
+		}
+		if (bAIn != bBIn)
+		{
+			const float T = A.Z / (A.Z - B.Z);
+			Out[NumOut++] = FVector4(
+				A.X + (B.X - A.X) * T,
+				A.Y + (B.Y - A.Y) * T,
+				0.0f,
+				A.W + (B.W - A.W) * T);
+		}
+	}
+
+	const FVector4 S0 = ToScreen(Out[0]);
+	for (int32 i = 1; i + 1 < NumOut; ++i)
+	{
+		RasterizeTriangle(S0, ToScreen(Out[i]), ToScreen(Out[i + 1]), Id);
+	}
+}
+
+void FIDBufferTile::RasterizeTriangle(const FVector4& V0, const FVector4& V1, const FVector4& V2, uint32 Id)
+{
+	// 원평면 밖이면 무시 (근평면은 이미 잘림)
+	if (std::min({ V0.Z, V1.Z, V2.Z }) > 1.0f)
+		return;
+
+	float Area = (V1.X - V0.X) * (V2.Y - V0.Y) - (V2.X - V0.X) * (V1.Y - V0.Y);
+	if (std::fabs(Area) < 1e-8f)
+		return;
+
+	int32 MinX = std::max(0, static_cast<int32>(std::floor(std::min({ V0.X, V1.X, V2.X }))));
+	int32 MaxX = std::min(Size - 1, static_cast<int32>(std::ceil(std::max({ V0.X, V1.X, V2.X }))));
+	int32 MinY = std::max(0, static_cast<int32>(std::floor(std::min({ V0.Y, V1.Y, V2.Y }))));
+	int32 MaxY = std::min(Size - 1, static_cast<int32>(std::ceil(std::max({ V0.Y, V1.Y, V2.Y }))));
+	if (MinX > MaxX || MinY > MaxY)
+		return;
+
+	// 양면 피킹: 감는 방향과 무관하게 내부가 양수가 되도록 부호 정리
+	const float Sign = Area > 0.0f ? 1.0f : -1.0f;
+
+	// 에지 함수 E(x, y) = A * x + B * y + C
+	const float A0 = (V1.Y - V2.Y) * Sign, B0 = (V2.X - V1.X) * Sign, C0 = (V1.X * V2.Y - V2.X * V1.Y) * Sign;
+	const float A1 = (V2.Y - V0.Y) * Sign, B1 = (V0.X - V2.X) * Sign, C1 = (V2.X * V0.Y - V0.X * V2.Y) * Sign;
+	const float A2 = (V0.Y - V1.Y) * Sign, B2 = (V1.X - V0.X) * Sign, C2 = (V0.X * V1.Y - V1.X * V0.Y) * Sign;
+
+	// 깊이 평면 z(x, y) = Z0 + DzDx * x + DzDy * y
+	const float InvArea = 1.0f / Area;
+	const float DzDx = ((V1.Z - V0.Z) * (V2.Y - V0.Y) - (V2.Z - V0.Z) * (V1.Y - V0.Y)) * InvArea;
+	const float DzDy = ((V2.Z - V0.Z) * (V1.X - V0.X) - (V1.Z - V0.Z) * (V2.X - V0.X)) * InvArea;
+	const float Z0 = V0.Z - DzDx * V0.X - DzDy * V0.Y;
+
+	// 4픽셀 단위 SSE 처리 (Size가 4의 배수이므로 행 시작을 4의 배수로 내려도 범위를 넘지 않음)
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 LaneOffset = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	const __m128 VA0 = _mm_set1_ps(A0), VA1 = _mm_set1_ps(A1), VA2 = _mm_set1_ps(A2);
+	const __m128 VDzDx = _mm_set1_ps(DzDx);
+	const __m128i VId = _mm_set1_epi32(static_cast<int32>(Id));
+
+	const int32 StartX = MinX & ~3;
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		const float PixelY = static_cast<float>(Y) + 0.5f;
+		const __m128 RowE0 = _mm_set1_ps(B0 * PixelY + C0);
+		const __m128 RowE1 = _mm_set1_ps(B1 * PixelY + C1);
+		const __m128 RowE2 = _mm_set1_ps(B2 * PixelY + C2);
+		const __m128 RowZ = _mm_set1_ps(DzDy * PixelY + Z0);
+
+		float* DepthRow = Depth.data() + Y * Size;
+		uint32* IdRow = Ids.data() + Y * Size;
+		for (int32 X = StartX; X <= MaxX; X += 4)
+		{
+			const __m128 PixelX = _mm_add_ps(_mm_set1_ps(static_cast<float>(X)), LaneOffset);
+
+			const __m128 E0 = _mm_add_ps(_mm_mul_ps(VA0, PixelX), RowE0);
+			const __m128 E1 = _mm_add_ps(_mm_mul_ps(VA1, PixelX), RowE1);
+			const __m128 E2 = _mm_add_ps(_mm_mul_ps(VA2, PixelX), RowE2);
+
+			__m128 Inside = _mm_and_ps(_mm_cmpge_ps(E0, Zero), _mm_cmpge_ps(E1, Zero));
+			Inside = _mm_and_ps(Inside, _mm_cmpge_ps(E2, Zero));
+			if (_mm_movemask_ps(Inside) == 0)
+				continue;
+
+			// 깊이 테스트: 덮였고 더 가까우며 근평면 앞이 아닌 픽셀만 기록
+			const __m128 TriZ = _mm_add_ps(_mm_mul_ps(VDzDx, PixelX), RowZ);
+			const __m128 OldZ = _mm_loadu_ps(DepthRow + X);
+			__m128 Write = _mm_and_ps(Inside, _mm_cmplt_ps(TriZ, OldZ));
+			Write = _mm_and_ps(Write, _mm_cmpge_ps(TriZ, Zero));
+			if (_mm_movemask_ps(Write) == 0)
+				continue;
+
+			// 깊이/ID 모두 같은 마스크로 갱신 (SSE2 blend)
+			_mm_storeu_ps(DepthRow + X, _mm_or_ps(_mm_and_ps(Write, TriZ), _mm_andnot_ps(Write, OldZ)));
+
+			const __m128i WriteMask = _mm_castps_si128(Write);
+			const __m128i OldId = _mm_loadu_si128(reinterpret_cast<const __m128i*>(IdRow + X));
+			const __m128i NewId = _mm_or_si128(_mm_and_si128(WriteMask, VId), _mm_andnot_si128(WriteMask, OldId));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(IdRow + X), NewId);
+		}
+	}
+}
@@ -0,0 +1,50 @@
+﻿#pragma once
+
+struct FStaticMesh;
+struct FNarrowPhaseBVHNode;
+class FFrustum;
+
+/**
+ * FIDBufferTile
+ * - GPU ID 렌더 타깃 피킹을 CPU로 흉내 내는 커서 주변의 작은 타일 (Size x Size 픽셀)
+ * - 타일 영역만 클립 공간 [-1, 1]로 확대한 ViewProjection으로 메시 삼각형을 SSE 래스터화해
+ *   픽셀마다 가장 가까운 깊이와 컴포넌트 ID를 기록한다
+ * - 메시 삼각형 BVH로 타일 절두체 밖의 노드는 건너뛰므로 비용은 타일에 걸친 삼각형 수에만 비례
+ * - 근평면을 가로지르는 삼각형은 클립 공간에서 잘라서 기록 (카메라에 붙은 큰 면도 정확히 피킹)
+ * - 깊이 규약은 D3D와 동일 (NDC z: 0 = near, 1 = far)
+ */
+class FIDBufferTile
+{
+public:
+	static constexpr int32 Size = 64;
+	static constexpr uint32 InvalidId = 0;
+
+	FIDBufferTile();
+
+	// 깊이를 far(1.0), ID를 InvalidId로 초기화하고 타일 ViewProjection을 설정
+	void Begin(const FMatrix& InTileViewProjection);
+
+	// 메시 삼각형을 Id로 기록 (MeshBVH가 있으면 타일과 겹치는 리프만, 기록한 삼각형 수 반환)
+	int32 RasterizeMesh(const FStaticMesh& Mesh, const FNarrowPhaseBVHNode* MeshBVH, const FMatrix& WorldMatrix, uint32 Id);
+
+	// 타일 픽셀의 ID / NDC 깊이 (범위 밖이면 InvalidId / 1.0)
+	uint32 GetId(int32 X, int32 Y) const;
+	float GetDepth(int32 X, int32 Y) const;
+
+private:
+	void GatherTriangles(const FNarrowPhaseBVHNode* Node, const FFrustum& LocalFrustum, uint32 PlaneMask);
+
+	// 클립 공간 삼각형: 근평면(z >= 0)으로 자른 뒤 화면 공간 래스터화
+	void RasterizeClipTriangle(const FVector4& C0, const FVector4& C1, const FVector4& C2, uint32 Id);
+	void RasterizeTriangle(const FVector4& V0, const FVector4& V1, const FVector4& V2, uint32 Id);
+
+	FVector4 ToScreen(const FVector4& Clip) const;
+
+	FMatrix ViewProjection;
+
+	TArray<float> Depth;		// Size * Size
+	TArray<uint32> Ids;			// Size * Size
+
+	// 타일과 겹치는 삼각형 인덱스 (메시마다 재사용)
+	TArray<int32> TriangleScratch;
+};
@@ -1,8 +1,16 @@
 ﻿#include "pch.h"
 #include "Level.h"
 
+namespace
+{
+	// 소비되지 않은 이벤트가 이보다 많아지면 버리고 전체 재구성으로 대신함
+	constexpr int32 MinActorEventCapacity = 1024;
+}
+
 ULevel::ULevel()
 {
+	static uint32 NextLevelSerial = 0;
+	LevelSerial = ++NextLevelSerial;
 }
 
 ULevel::~ULevel()
@@ -15,6 +23,17 @@ void ULevel::AddActor(AActor* InActor)
 	if (InActor)	
 	{
 		Actors.Add(InActor);
+		SearchIndex.Add(InActor);
+		PushActorEvent(ELevelActorEvent::Added, InActor);
+	}
+}
+
+void ULevel::AddActors(const TArray<AActor*>& InActors)
+{
+	Actors.Reserve(Actors.Num() + InActors.Num());
+	for (AActor* Actor : InActors)
+	{
+		AddActor(Actor);
 	}
 }
  
@@ -23,10 +42,20 @@ void ULevel::RemoveActor(AActor* InActor)
 	if (InActor)
 	{
 		Actors.Remove(InActor);
+		SearchIndex.Remove(InActor);
+		PushActorEvent(ELevelActorEvent::Removed, InActor);
 		//delete InActor;
 	}
 }
 
+void ULevel::ClearActors()
+{
+	Actors.clear();
+	SearchIndex.Clear();
+	PendingActorEvents.clear();
+	bActorEventsOverflowed = true;
+}
+
 const TArray<AActor*>& ULevel::GetActors() const
 {
 	return Actors;
@@ -36,3 +65,38 @@ TArray<AActor*>& ULevel::GetActors()
 {
 	return Actors;
 }
+
+void ULevel::NotifyActorRenamed(AActor* InActor)
+{
+	if (InActor)
+	{
+		SearchIndex.Rename(InActor);
+		PushActorEvent(ELevelActorEvent::Renamed, InActor);
+	}
+}
+
+void ULevel::ConsumeActorEvents(TArray<FLevelActorEvent>& OutEvents, bool& bOutNeedsFullRebuild)
+{
+	OutEvents.clear();
+	OutEvents.swap(PendingActorEvents);
+	bOutNeedsFullRebuild = bActorEventsOverflowed;
+	bActorEventsOverflowed = false;
+}
+
+void ULevel::PushActorEvent(ELevelActorEvent Type, AActor* InActor)
+{
+	if (bActorEventsOverflowed)
+	{
+		return;
+	}
+
+	// 아무도 소비하지 않는 레벨(PIE 중 에디터 레벨 등)에서 무한히 쌓이지 않도록 상한
+	if (PendingActorEvents.Num() >= std::max(MinActorEventCapacity, Actors.Num()))
+	{
+		PendingActorEvents.clear();
+		bActorEventsOverflowed = true;
+		return;
+	}
+
+	PendingActorEvents.Add({ Type, InActor });
+}
@@ -2,9 +2,24 @@
 #include "pch.h"
 #include "Object.h"
 #include "Actor.h"
+#include "ActorSearchIndex.h"
 
 class ADecalActor;
 
+// 레벨 액터 목록 변경 알림 (아웃라이너 등이 전체 목록을 다시 훑지 않고 바뀐 액터만 반영)
+enum class ELevelActorEvent : uint8
+{
+	Added,
+	Removed,
+	Renamed,
+};
+
+struct FLevelActorEvent
+{
+	ELevelActorEvent Type;
+	AActor* Actor;		// Removed 이후에는 이미 해제됐을 수 있으므로 키로만 사용
+};
+
 class ULevel : public UObject
 {
 public:
@@ -13,12 +28,34 @@ public:
 	~ULevel() override;
 
 	void AddActor(AActor* InActor); 
+	void AddActors(const TArray<AActor*>& InActors);
 
 	void RemoveActor(AActor* InActor);
+	void ClearActors();
 	const TArray<AActor*>& GetActors() const;
 	TArray<AActor*>& GetActors();
+
+	// 레벨에 속한 액터의 이름이 바뀌었음을 알림 (AActor::SetName에서 호출)
+	void NotifyActorRenamed(AActor* InActor);
+
+	// 마지막 호출 이후 쌓인 이벤트를 꺼냄
+	// 큐가 넘쳤거나 목록이 통째로 비워졌으면 bOutNeedsFullRebuild = true (이벤트 대신 전체 재구성)
+	void ConsumeActorEvents(TArray<FLevelActorEvent>& OutEvents, bool& bOutNeedsFullRebuild);
+
+	// 이름/클래스 검색 인덱스 (추가/제거/이름 변경 시점에 갱신)
+	const FActorSearchIndex& GetActorSearchIndex() const { return SearchIndex; }
+
+	// 레벨 인스턴스 고유 번호 (해제 후 같은 주소에 새 레벨이 생겨도 구분)
+	uint32 GetLevelSerial() const { return LevelSerial; }
 	
 private:
+	void PushActorEvent(ELevelActorEvent Type, AActor* InActor);
+
 	TArray<AActor*> Actors;
-};
 
+	TArray<FLevelActorEvent> PendingActorEvents;
+	bool bActorEventsOverflowed = false;
+	uint32 LevelSerial = 0;
+
+	FActorSearchIndex SearchIndex;
+};
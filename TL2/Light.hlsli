@@ -30,6 +30,27 @@ cbuffer LightBuffer : register(b7)
     FLightInfo Lights[MAX_LIGHTS];
 }
 
+// 클러스터드 라이트 그리드 (FLightClusterConstants와 같은 배치)
+cbuffer LightClusterBuffer : register(b9)
+{
+    uint ClusterTilesX;
+    uint ClusterTilesY;
+    uint ClusterSlices;
+    uint bClusterPerspective;
+
+    float4 ClusterViewportRect; // x, y, 너비, 높이 (픽셀)
+
+    float ClusterDepthScale;
+    float ClusterDepthBias;
+    float ClusterNearZ;
+    float ClusterFarZ;
+}
+
+// 화면에 닿는 라이트 / 클러스터별 [Offset, Count] / 클러스터가 참조하는 라이트 인덱스
+StructuredBuffer<FLightInfo> ClusterLights : register(t10);
+Buffer<uint2> ClusterRanges : register(t11);
+Buffer<uint> ClusterLightIndices : register(t12);
+
 float SoftAttenuate(FLightInfo LightInfo, float3 Position)
 {
     float dist = length(Position - LightInfo.LightPos);
@@ -51,4 +72,35 @@ float3 Calculate_PointLight_Diffuse(FLightInfo LightInfo, float3 worldPos, float
 
     return lightColor * NdotL * atten;
 } 
+
+// 픽셀 위치(SV_POSITION.xy)와 뷰 공간 깊이로 클러스터를 찾음
+uint ComputeLightClusterIndex(float2 screenPos, float viewDepth)
+{
+    float2 uv = saturate((screenPos - ClusterViewportRect.xy) / ClusterViewportRect.zw);
+    uint tileX = min((uint) (uv.x * ClusterTilesX), ClusterTilesX - 1);
+    uint tileY = min((uint) (uv.y * ClusterTilesY), ClusterTilesY - 1);
+
+    float depth = bClusterPerspective ? log(max(viewDepth, ClusterNearZ)) : viewDepth;
+    int slice = (int) floor(depth * ClusterDepthScale - ClusterDepthBias);
+    uint sliceIndex = (uint) clamp(slice, 0, (int) ClusterSlices - 1);
+
+    return (sliceIndex * ClusterTilesY + tileY) * ClusterTilesX + tileX;
+}
+
+// 자기 클러스터에 배정된 포인트 라이트만 누적
+float3 Calculate_ClusteredPointLights_Diffuse(float2 screenPos, float viewDepth, float3 worldPos, float3 worldNormal)
+{
+    float3 lighting = float3(0.0f, 0.0f, 0.0f);
+    if (ClusterTilesX == 0)
+    {
+        return lighting;
+    }
+
+    uint2 range = ClusterRanges[ComputeLightClusterIndex(screenPos, viewDepth)];
+    for (uint i = 0; i < range.y; ++i)
+    {
+        lighting += Calculate_PointLight_Diffuse(ClusterLights[ClusterLightIndices[range.x + i]], worldPos, worldNormal);
+    }
+    return lighting;
+}
 #endif // _LIGHT_HLSLI_
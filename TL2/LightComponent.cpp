@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "LightComponent.h"
+#include "LightRegistry.h"
 
 ULightComponent::ULightComponent() : LightColor(1,0,0), AttenuationRadius(1.7f), Intensity(1.0f)
 {
@@ -18,5 +19,16 @@ UObject* ULightComponent::Duplicate(FObjectDuplicationParameters Parameters)
 
 ULightComponent::~ULightComponent()
 {
+    if (Registry)
+    {
+        Registry->Unregister(this);
+    }
+}
 
+void ULightComponent::MarkLightDirty()
+{
+    if (Registry)
+    {
+        Registry->MarkLightDirty(this);
+    }
 }
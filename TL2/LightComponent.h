@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "SceneComponent.h"
 
+class FLightRegistry;
+
 class ULightComponent : public USceneComponent
 {
 public:
@@ -16,13 +18,16 @@ public:
     float GetIntensity() { return Intensity; }
 
     //void SetLightColor(FLinearColor Color) { LightColor = Color; }
-    void SetLightColor(FVector4 Color) { LightColor = Color; }
-    void SetAttenuationRadius(float Att) { AttenuationRadius = Att; }
-    void SetIntensity(float InIntensity) {Intensity = InIntensity; }
+    void SetLightColor(FVector4 Color) { LightColor = Color; MarkLightDirty(); }
+    void SetAttenuationRadius(float Att) { AttenuationRadius = Att; MarkLightDirty(); }
+    void SetIntensity(float InIntensity) {Intensity = InIntensity; MarkLightDirty(); }
 
 protected:
     ~ULightComponent();
 
+    // 월드 라이트 레지스트리의 캐시(위치/반경/색)를 다음 수집 때 다시 읽도록 표시
+    void MarkLightDirty();
+
 private:
     /** 빛의 색을 정하는 인자*/
     //FLinearColor LightColor;
@@ -33,6 +38,10 @@ private:
 
     /** 빛의 세기, 강도 */
     float Intensity;
-     
+
+    // 등록된 월드 라이트 레지스트리 (FLightRegistry만 변경)
+    friend class FLightRegistry;
+    FLightRegistry* Registry = nullptr;
+    int32 RegistryIndex = -1;
 };
 
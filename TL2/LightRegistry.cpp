@@ -0,0 +1,331 @@
+﻿#include "pch.h"
+#include "LightRegistry.h"
+#include "LightComponent.h"
+#include "PointLightComponent.h"
+#include "Frustum.h"
+
+FLightRegistry::~FLightRegistry()
+{
+	// 월드보다 오래 사는 라이트가 해제된 레지스트리를 가리키지 않도록 연결만 끊음
+	for (FLightEntry& Entry : Entries)
+	{
+		Entry.Light->Registry = nullptr;
+		Entry.Light->RegistryIndex = -1;
+	}
+}
+
+void FLightRegistry::Register(ULightComponent* Light)
+{
+	if (!Light || Light->Registry == this)
+	{
+		return;
+	}
+
+	// 다른 월드에서 옮겨 온 경우 이전 등록을 먼저 해제
+	if (Light->Registry)
+	{
+		Light->Registry->Unregister(Light);
+	}
+
+	Light->Registry = this;
+	Light->RegistryIndex = Entries.Num();
+
+	FLightEntry& Entry = Entries.emplace_back();
+	Entry.Light = Light;
+	Entry.Owner = Light->GetOwner();
+	if (Entry.Owner)
+	{
+		++LightOwners[Entry.Owner];
+	}
+
+	RefreshEntry(Entry);
+	bTreeDirty = true;
+}
+
+void FLightRegistry::Unregister(ULightComponent* Light)
+{
+	if (!Light || Light->Registry != this)
+	{
+		return;
+	}
+
+	const int32 Index = Light->RegistryIndex;
+	FLightEntry& Entry = Entries[Index];
+
+	if (Entry.bDirty)
+	{
+		DirtyLights.erase(std::find(DirtyLights.begin(), DirtyLights.end(), Light));
+	}
+
+	if (Entry.Owner)
+	{
+		int32* Count = LightOwners.Find(Entry.Owner);
+		if (Count && --(*Count) <= 0)
+		{
+			LightOwners.Remove(Entry.Owner);
+		}
+	}
+
+	// 마지막 엔트리를 빈 자리로 옮겨 O(1) 제거
+	const int32 LastIndex = Entries.Num() - 1;
+	if (Index != LastIndex)
+	{
+		Entries[Index] = Entries[LastIndex];
+		Entries[Index].Light->RegistryIndex = Index;
+	}
+	Entries.pop_back();
+
+	Light->Registry = nullptr;
+	Light->RegistryIndex = -1;
+	bTreeDirty = true;
+}
+
+void FLightRegistry::RegisterActor(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (ULightComponent* Light = Cast<ULightComponent>(Component))
+		{
+			Register(Light);
+		}
+	}
+}
+
+void FLightRegistry::UnregisterActor(AActor* Actor)
+{
+	if (!Actor || !LightOwners.Contains(Actor))
+	{
+		return;
+	}
+
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (ULightComponent* Light = Cast<ULightComponent>(Component))
+		{
+			Unregister(Light);
+		}
+	}
+}
+
+void FLightRegistry::MarkLightDirty(ULightComponent* Light)
+{
+	if (!Light || Light->Registry != this)
+	{
+		return;
+	}
+
+	FLightEntry& Entry = Entries[Light->RegistryIndex];
+	if (!Entry.bDirty)
+	{
+		Entry.bDirty = true;
+		DirtyLights.Add(Light);
+	}
+}
+
+void FLightRegistry::NotifyActorMoved(AActor* Actor)
+{
+	// 라이트가 없는 액터는 컴포넌트를 훑지 않음
+	if (!Actor || !LightOwners.Contains(Actor))
+	{
+		return;
+	}
+
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (ULightComponent* Light = Cast<ULightComponent>(Component))
+		{
+			MarkLightDirty(Light);
+		}
+	}
+}
+
+void FLightRegistry::Update()
+{
+	for (ULightComponent* Light : DirtyLights)
+	{
+		RefreshEntry(Entries[Light->RegistryIndex]);
+	}
+	if (!DirtyLights.IsEmpty())
+	{
+		DirtyLights.clear();
+		bBoundsDirty = true;
+	}
+
+	if (bTreeDirty)
+	{
+		BuildTree();
+	}
+	else if (bBoundsDirty)
+	{
+		RefitTree();
+	}
+}
+
+void FLightRegistry::GatherVisibleLights(const FFrustum& Frustum, TArray<FLightInfo>& OutLights)
+{
+	Update();
+
+	OutLights.clear();
+	if (Nodes.IsEmpty())
+	{
+		return;
+	}
+
+	// (노드, 평면 마스크) 스택. 완전히 안쪽인 서브트리는 평면 검사 없이 모두 수집
+	TraversalStack.clear();
+	TraversalStack.Add(0);
+	TraversalStack.Add(static_cast<int32>(FFrustum::AllPlanesMask));
+
+	while (!TraversalStack.IsEmpty())
+	{
+		uint32 PlaneMask = static_cast<uint32>(TraversalStack.back());
+		TraversalStack.pop_back();
+		const FNode& Node = Nodes[TraversalStack.back()];
+		TraversalStack.pop_back();
+
+		if (PlaneMask != 0 && Frustum.ClassifyBox(Node.Bounds, PlaneMask) == EFrustumContainment::Outside)
+		{
+			continue;
+		}
+
+		if (Node.Count == 0)
+		{
+			const int32 NodeIndex = static_cast<int32>(&Node - Nodes.data());
+			TraversalStack.Add(Node.Right);
+			TraversalStack.Add(static_cast<int32>(PlaneMask));
+			TraversalStack.Add(NodeIndex + 1);
+			TraversalStack.Add(static_cast<int32>(PlaneMask));
+			continue;
+		}
+
+		for (int32 i = Node.First; i < Node.First + Node.Count; ++i)
+		{
+			const FLightEntry& Entry = Entries[LeafOrder[i]];
+			if (Entry.Info.Radius <= 0.0f || !Entry.Light->IsActive() || (Entry.Owner && Entry.Owner->GetActorHiddenInGame()))
+			{
+				continue;
+			}
+
+			uint32 LightMask = PlaneMask;
+			if (LightMask != 0 && Frustum.ClassifyBox(Entry.Bounds, LightMask) == EFrustumContainment::Outside)
+			{
+				continue;
+			}
+			OutLights.Add(Entry.Info);
+		}
+	}
+}
+
+void FLightRegistry::RefreshEntry(FLightEntry& Entry)
+{
+	ULightComponent* Light = Entry.Light;
+
+	FLightInfo& Info = Entry.Info;
+	Info.Type = ELighType::Point;
+	Info.LightPos = Light->GetWorldLocation();
+	Info.Radius = Light->GetAttenuationRadius();
+	Info.Color = Light->GetLightColor();
+	Info.Intensity = Light->GetIntensity();
+	if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(Light))
+	{
+		Info.RadiusFallOff = PointLight->GetFalloff();
+	}
+
+	const float Radius = std::max(Info.Radius, 0.0f);
+	const FVector Extent(Radius, Radius, Radius);
+	Entry.Bounds = FBound(Info.LightPos - Extent, Info.LightPos + Extent);
+	Entry.bDirty = false;
+}
+
+void FLightRegistry::BuildTree()
+{
+	Nodes.clear();
+	LeafOrder.resize(Entries.Num());
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		LeafOrder[i] = i;
+	}
+
+	if (!Entries.IsEmpty())
+	{
+		Nodes.Reserve(Entries.Num() * 2 / MaxLeafLights + 1);
+		BuildNode(0, Entries.Num());
+	}
+
+	bTreeDirty = false;
+	bBoundsDirty = false;
+}
+
+int32 FLightRegistry::BuildNode(int32 Begin, int32 End)
+{
+	const int32 NodeIndex = Nodes.Num();
+	Nodes.emplace_back();
+
+	FBound Bounds = Entries[LeafOrder[Begin]].Bounds;
+	FBound CenterBounds(Bounds.GetCenter(), Bounds.GetCenter());
+	for (int32 i = Begin + 1; i < End; ++i)
+	{
+		const FBound& EntryBounds = Entries[LeafOrder[i]].Bounds;
+		const FVector Center = EntryBounds.GetCenter();
+		Bounds += EntryBounds;
+		CenterBounds += FBound(Center, Center);
+	}
+	Nodes[NodeIndex].Bounds = Bounds;
+
+	if (End - Begin <= MaxLeafLights)
+	{
+		Nodes[NodeIndex].First = Begin;
+		Nodes[NodeIndex].Count = End - Begin;
+		return NodeIndex;
+	}
+
+	// 중심점 분포가 가장 넓은 축의 중앙값으로 분할
+	const FVector CenterExtent = CenterBounds.Max - CenterBounds.Min;
+	int32 Axis = 0;
+	if (CenterExtent.Y > CenterExtent.X) Axis = 1;
+	if (CenterExtent.Z > (Axis == 0 ? CenterExtent.X : CenterExtent.Y)) Axis = 2;
+
+	auto AxisCenter = [this, Axis](int32 EntryIndex)
+	{
+		const FVector Center = Entries[EntryIndex].Bounds.GetCenter();
+		return Axis == 0 ? Center.X : (Axis == 1 ? Center.Y : Center.Z);
+	};
+
+	const int32 Mid = (Begin + End) / 2;
+	std::nth_element(LeafOrder.begin() + Begin, LeafOrder.begin() + Mid, LeafOrder.begin() + End,
+		[&AxisCenter](int32 A, int32 B) { return AxisCenter(A) < AxisCenter(B); });
+
+	BuildNode(Begin, Mid);
+	const int32 Right = BuildNode(Mid, End);
+	Nodes[NodeIndex].Right = Right;
+	return NodeIndex;
+}
+
+void FLightRegistry::RefitTree()
+{
+	// 자식 노드는 항상 부모보다 뒤에 있으므로 역순으로 한 번 훑으면 된다
+	for (int32 NodeIndex = Nodes.Num() - 1; NodeIndex >= 0; --NodeIndex)
+	{
+		FNode& Node = Nodes[NodeIndex];
+		if (Node.Count > 0)
+		{
+			Node.Bounds = Entries[LeafOrder[Node.First]].Bounds;
+			for (int32 i = Node.First + 1; i < Node.First + Node.Count; ++i)
+			{
+				Node.Bounds += Entries[LeafOrder[i]].Bounds;
+			}
+		}
+		else
+		{
+			Node.Bounds = Nodes[NodeIndex + 1].Bounds;
+			Node.Bounds += Nodes[Node.Right].Bounds;
+		}
+	}
+
+	bBoundsDirty = false;
+}
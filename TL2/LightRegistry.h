@@ -0,0 +1,75 @@
+﻿#pragma once
+#include "AABoundingBoxComponent.h"
+
+class AActor;
+class FFrustum;
+class ULightComponent;
+
+/**
+ * FLightRegistry
+ * - 월드에 속한 라이트 컴포넌트 목록. 액터 스폰/로드/삭제, 컴포넌트 추가/소멸 시점에 등록/해제
+ * - 라이트별 월드 위치/반경/색을 FLightInfo로 캐시하고, 트랜스폼이나 속성이 바뀐 라이트만 다시 읽음
+ * - 라이트 구 바운드로 작은 BVH를 만들어 뷰 절두체에 닿는 라이트만 수집 (전체 컴포넌트 순회 없음)
+ */
+class FLightRegistry
+{
+public:
+	~FLightRegistry();
+
+	void Register(ULightComponent* Light);
+	void Unregister(ULightComponent* Light);
+
+	// 액터가 가진 라이트 컴포넌트를 한 번에 등록/해제 (이미 등록된 라이트는 무시)
+	void RegisterActor(AActor* Actor);
+	void UnregisterActor(AActor* Actor);
+
+	// 라이트 속성(색/세기/반경/감쇠) 변경
+	void MarkLightDirty(ULightComponent* Light);
+	// 액터 트랜스폼 변경 (라이트를 가진 액터만 처리)
+	void NotifyActorMoved(AActor* Actor);
+
+	// 더티 라이트 캐시 갱신 후 구성이 바뀌었으면 BVH 재빌드, 위치/반경만 바뀌었으면 Refit
+	void Update();
+
+	// 절두체와 겹치는 라이트 수집 (숨김 액터/비활성 컴포넌트 제외). 필요하면 먼저 Update
+	void GatherVisibleLights(const FFrustum& Frustum, TArray<FLightInfo>& OutLights);
+
+	int32 Num() const { return Entries.Num(); }
+
+private:
+	struct FLightEntry
+	{
+		ULightComponent* Light = nullptr;
+		AActor* Owner = nullptr;	// 등록 시점의 소유 액터 (해제 시 카운트 감소용)
+		FLightInfo Info{};
+		FBound Bounds;
+		bool bDirty = true;
+	};
+
+	// Count > 0이면 리프 ([First, First + Count) 범위의 LeafOrder), 아니면 왼쪽 자식 = 자기 다음 노드, 오른쪽 = Right
+	struct FNode
+	{
+		FBound Bounds;
+		int32 Right = -1;
+		int32 First = 0;
+		int32 Count = 0;
+	};
+
+	static constexpr int32 MaxLeafLights = 4;
+
+	void RefreshEntry(FLightEntry& Entry);
+	void BuildTree();
+	int32 BuildNode(int32 Begin, int32 End);
+	void RefitTree();
+
+	TArray<FLightEntry> Entries;
+	TArray<ULightComponent*> DirtyLights;
+	TMap<AActor*, int32> LightOwners;	// 액터별 등록된 라이트 수
+
+	TArray<FNode> Nodes;
+	TArray<int32> LeafOrder;			// 리프가 참조하는 Entries 인덱스
+	TArray<int32> TraversalStack;
+
+	bool bTreeDirty = true;		// 라이트 추가/삭제 → 재빌드
+	bool bBoundsDirty = false;	// 위치/반경 변경 → Refit
+};
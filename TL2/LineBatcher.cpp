@@ -0,0 +1,224 @@
+﻿#include "pch.h"
+#include "LineBatcher.h"
+#include "AABoundingBoxComponent.h"
+
+namespace
+{
+	// UAABoundingBoxComponent::CreateLineData와 같은 코너 번호 (bit0: X, bit1: Y, bit2: Z가 Max)
+	//  v0(000) v1(X) v2(XY) v3(Y) v4(Z) v5(XZ) v6(XYZ) v7(YZ)
+	constexpr int32 BoxCornerBits[8] = { 0b000, 0b001, 0b011, 0b010, 0b100, 0b101, 0b111, 0b110 };
+
+	// 아래 면 4개, 위 면 4개, 기둥 4개
+	constexpr int32 BoxEdges[12][2] =
+	{
+		{ 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 },
+		{ 4, 5 }, { 5, 6 }, { 6, 7 }, { 7, 4 },
+		{ 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 },
+	};
+}
+
+uint32 FLineBatcher::FChunkList::NumVertices() const
+{
+	uint32 Total = 0;
+	for (int32 i = 0; i < NumUsed; ++i)
+	{
+		Total += Chunks[i]->Count;
+	}
+	return Total;
+}
+
+void FLineBatcher::Release()
+{
+	for (FChunkList* List : { &Transient, &Persistent })
+	{
+		for (std::unique_ptr<FChunk>& Chunk : List->Chunks)
+		{
+			if (Chunk->Buffer)
+			{
+				Chunk->Buffer->Release();
+				Chunk->Buffer = nullptr;
+			}
+		}
+		List->Chunks.clear();
+		List->NumUsed = 0;
+	}
+}
+
+void FLineBatcher::Reset(FChunkList& List)
+{
+	// 내용은 지우지 않고 개수만 0으로 (다음 기록이 이전 내용과 비교해 변경 여부를 판단)
+	for (int32 i = 0; i < List.NumUsed; ++i)
+	{
+		List.Chunks[i]->Count = 0;
+	}
+	List.NumUsed = 0;
+}
+
+void FLineBatcher::Append(FChunkList& List, const FVertexSimple* Source, uint32 NumVertices)
+{
+	FChunk* Chunk = List.NumUsed > 0 ? List.Chunks[List.NumUsed - 1].get() : nullptr;
+	if (!Chunk || Chunk->Count + NumVertices > VerticesPerChunk)
+	{
+		if (List.NumUsed == List.Chunks.Num())
+		{
+			std::unique_ptr<FChunk> NewChunk = std::make_unique<FChunk>();
+			NewChunk->Vertices.resize(VerticesPerChunk);
+			List.Chunks.Add(std::move(NewChunk));
+		}
+		Chunk = List.Chunks[List.NumUsed++].get();
+		Chunk->Count = 0;
+	}
+
+	FVertexSimple* Dest = Chunk->Vertices.data() + Chunk->Count;
+	const size_t Bytes = sizeof(FVertexSimple) * NumVertices;
+	if (!Chunk->bDirty && std::memcmp(Dest, Source, Bytes) != 0)
+	{
+		Chunk->bDirty = true;
+	}
+	std::memcpy(Dest, Source, Bytes);
+	Chunk->Count += NumVertices;
+}
+
+void FLineBatcher::AddLine(const FVector& Start, const FVector& End, const FVector4& Color, ELineBatchCategory Category)
+{
+	const FVertexSimple Line[2] = { { Start, Color }, { End, Color } };
+	Append(GetList(Category), Line, 2);
+}
+
+void FLineBatcher::AddLines(const TArray<FVector>& StartPoints, const TArray<FVector>& EndPoints, const TArray<FVector4>& Colors, ELineBatchCategory Category)
+{
+	// Validate input arrays have same size
+	if (StartPoints.size() != EndPoints.size() || StartPoints.size() != Colors.size())
+		return;
+
+	FChunkList& List = GetList(Category);
+
+	// 청크 경계를 넘지 않는 크기로 모아서 추가
+	const int32 LinesPerBlock = 256;
+	FVertexSimple Block[LinesPerBlock * 2];
+	for (int32 Begin = 0; Begin < StartPoints.Num(); Begin += LinesPerBlock)
+	{
+		const int32 Count = std::min(LinesPerBlock, StartPoints.Num() - Begin);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Block[i * 2 + 0] = { StartPoints[Begin + i], Colors[Begin + i] };
+			Block[i * 2 + 1] = { EndPoints[Begin + i], Colors[Begin + i] };
+		}
+		Append(List, Block, static_cast<uint32>(Count * 2));
+	}
+}
+
+void FLineBatcher::AddBoxes(std::span<const FBound> Boxes, const FVector4& Color, ELineBatchCategory Category)
+{
+	FChunkList& List = GetList(Category);
+
+	// 코너 선택 마스크: 비트가 켜진 축은 Max, 아니면 Min
+	__m128 CornerMasks[8];
+	for (int32 c = 0; c < 8; ++c)
+	{
+		const int32 Bits = BoxCornerBits[c];
+		CornerMasks[c] = _mm_castsi128_ps(_mm_setr_epi32((Bits & 1) ? -1 : 0, (Bits & 2) ? -1 : 0, (Bits & 4) ? -1 : 0, 0));
+	}
+	const __m128 ColorV = _mm_loadu_ps(&Color.X);
+
+	// 여러 박스를 한 블록(청크 경계 안)에 모아 한 번에 Append
+	const int32 BoxesPerBlock = 64;
+	const int32 VerticesPerBox = 24;
+	FVertexSimple Block[BoxesPerBlock * VerticesPerBox];
+
+	for (size_t Begin = 0; Begin < Boxes.size(); Begin += BoxesPerBlock)
+	{
+		const int32 Count = static_cast<int32>(std::min<size_t>(BoxesPerBlock, Boxes.size() - Begin));
+		FVertexSimple* Out = Block;
+		for (int32 b = 0; b < Count; ++b)
+		{
+			const FBound& Box = Boxes[Begin + b];
+			const __m128 MinV = _mm_setr_ps(Box.Min.X, Box.Min.Y, Box.Min.Z, 0.0f);
+			const __m128 MaxV = _mm_setr_ps(Box.Max.X, Box.Max.Y, Box.Max.Z, 0.0f);
+
+			__m128 Corners[8];
+			for (int32 c = 0; c < 8; ++c)
+			{
+				Corners[c] = _mm_or_ps(_mm_and_ps(CornerMasks[c], MaxV), _mm_andnot_ps(CornerMasks[c], MinV));
+			}
+
+			// 위치(12바이트)를 16바이트로 쓰면 Color.X까지 덮이므로 색상을 바로 뒤에 기록
+			for (const int32* Edge : BoxEdges)
+			{
+				_mm_storeu_ps(&Out->Position.X, Corners[Edge[0]]);
+				_mm_storeu_ps(&Out->Color.X, ColorV);
+				++Out;
+				_mm_storeu_ps(&Out->Position.X, Corners[Edge[1]]);
+				_mm_storeu_ps(&Out->Color.X, ColorV);
+				++Out;
+			}
+		}
+		Append(List, Block, static_cast<uint32>(Count * VerticesPerBox));
+	}
+}
+
+bool FLineBatcher::UploadChunk(FChunk& Chunk, ID3D11Device* Device, ID3D11DeviceContext* Context)
+{
+	if (!Chunk.Buffer)
+	{
+		D3D11_BUFFER_DESC Desc = {};
+		Desc.Usage = D3D11_USAGE_DYNAMIC;
+		Desc.ByteWidth = static_cast<UINT>(sizeof(FVertexSimple) * VerticesPerChunk);
+		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+		if (FAILED(Device->CreateBuffer(&Desc, nullptr, &Chunk.Buffer)))
+		{
+			UE_LOG("FLineBatcher: 청크 버퍼 생성 실패");
+			Chunk.Buffer = nullptr;
+			return false;
+		}
+		Chunk.bDirty = true;
+	}
+
+	if (!Chunk.bDirty && Chunk.Count == Chunk.UploadedCount)
+	{
+		return true;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE Mapped;
+	if (FAILED(Context->Map(Chunk.Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+	{
+		return false;
+	}
+	std::memcpy(Mapped.pData, Chunk.Vertices.data(), sizeof(FVertexSimple) * Chunk.Count);
+	Context->Unmap(Chunk.Buffer, 0);
+
+	Chunk.UploadedCount = Chunk.Count;
+	Chunk.bDirty = false;
+	++LastUploadedChunks;
+	return true;
+}
+
+uint32 FLineBatcher::Draw(ID3D11Device* Device, ID3D11DeviceContext* Context)
+{
+	LastUploadedChunks = 0;
+	uint32 NumDraws = 0;
+
+	const UINT Stride = sizeof(FVertexSimple);
+	const UINT Offset = 0;
+	Context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+
+	for (FChunkList* List : { &Persistent, &Transient })
+	{
+		for (int32 i = 0; i < List->NumUsed; ++i)
+		{
+			FChunk& Chunk = *List->Chunks[i];
+			if (Chunk.Count == 0 || !UploadChunk(Chunk, Device, Context))
+			{
+				continue;
+			}
+
+			Context->IASetVertexBuffers(0, 1, &Chunk.Buffer, &Stride, &Offset);
+			Context->Draw(Chunk.Count, 0);
+			++NumDraws;
+		}
+	}
+
+	return NumDraws;
+}
@@ -0,0 +1,85 @@
+﻿#pragma once
+#include <span>
+#include "VertexData.h"
+
+struct FBound;
+
+// 라인 수명: Transient는 BeginLineBatch마다 비워지고, Persistent는 ClearPersistentLines 전까지 여러 프레임 유지
+enum class ELineBatchCategory : uint8
+{
+	Transient,
+	Persistent
+};
+
+/**
+ * FLineBatcher
+ * - 라인 정점을 고정 크기 청크(청크마다 GPU 버퍼 1개)에 나눠 담아 용량 제한 없이 늘어남
+ * - 청크에 쓸 때 이전 내용과 비교해 바뀐 청크만 GPU에 다시 올림
+ *   (매 프레임 같은 라인을 다시 넣는 그리드/바운딩 박스도, 한 번 넣고 유지하는 Persistent 라인도 업로드 0회)
+ * - 드로우는 청크마다 Draw 1회 (LINELIST, 인덱스 버퍼 없음)
+ */
+class FLineBatcher
+{
+public:
+	// 청크 하나의 정점 수 (라인 16K개)
+	static const uint32 VerticesPerChunk = 32768;
+
+	FLineBatcher() = default;
+	~FLineBatcher() { Release(); }
+
+	FLineBatcher(const FLineBatcher&) = delete;
+	FLineBatcher& operator=(const FLineBatcher&) = delete;
+
+	void Release();
+
+	// Transient 라인만 비움 (청크와 GPU 버퍼는 재사용)
+	void ResetTransient() { Reset(Transient); }
+	void ClearPersistent() { Reset(Persistent); }
+
+	void AddLine(const FVector& Start, const FVector& End, const FVector4& Color, ELineBatchCategory Category);
+	void AddLines(const TArray<FVector>& StartPoints, const TArray<FVector>& EndPoints, const TArray<FVector4>& Colors, ELineBatchCategory Category);
+
+	// AABB 목록을 박스당 12개 라인으로 펼쳐 추가 (코너 선택과 정점 기록은 SSE)
+	void AddBoxes(std::span<const FBound> Boxes, const FVector4& Color, ELineBatchCategory Category);
+
+	bool IsEmpty() const { return Transient.NumVertices() == 0 && Persistent.NumVertices() == 0; }
+
+	// 바뀐 청크만 업로드한 뒤 Persistent → Transient 순으로 청크마다 Draw (셰이더/상수 버퍼는 호출자가 설정)
+	// 반환값: 드로우 호출 수
+	uint32 Draw(ID3D11Device* Device, ID3D11DeviceContext* Context);
+
+	// 통계: 마지막 Draw에서 업로드한 청크 수
+	uint32 GetLastUploadedChunks() const { return LastUploadedChunks; }
+
+private:
+	struct FChunk
+	{
+		TArray<FVertexSimple> Vertices;	// VerticesPerChunk 크기로 한 번 할당 (이전 내용은 비교용으로 유지)
+		uint32 Count = 0;
+		uint32 UploadedCount = 0;
+		bool bDirty = true;
+		ID3D11Buffer* Buffer = nullptr;
+	};
+
+	struct FChunkList
+	{
+		TArray<std::unique_ptr<FChunk>> Chunks;
+		int32 NumUsed = 0;
+
+		uint32 NumVertices() const;
+	};
+
+	void Reset(FChunkList& List);
+
+	// NumVertices개(한 청크에 들어가는 크기)를 연속으로 추가, 이전 내용과 다르면 청크를 dirty로 표시
+	void Append(FChunkList& List, const FVertexSimple* Source, uint32 NumVertices);
+
+	FChunkList& GetList(ELineBatchCategory Category) { return Category == ELineBatchCategory::Persistent ? Persistent : Transient; }
+
+	bool UploadChunk(FChunk& Chunk, ID3D11Device* Device, ID3D11DeviceContext* Context);
+
+	FChunkList Transient;
+	FChunkList Persistent;
+
+	uint32 LastUploadedChunks = 0;
+};
@@ -0,0 +1,542 @@
+﻿// RHICommandList.cpp와 마찬가지로 pch.h 없이 컴파일 (정렬/제출 코어는 엔진 객체나 d3d11 없이 링크 가능)
+// 엔진 객체를 커맨드로 해석하는 AddStaticMesh는 StaticMeshDrawCommands.cpp
+#include "MeshDrawCommand.h"
+#include "NullRHICommandContext.h"
+#include "TaskSystem.h"
+#include "Benchmark.h"
+#include <bit>
+#include <random>
+
+void RadixSortDrawKeys(TArray<FMeshDrawSortEntry>& Entries, TArray<FMeshDrawSortEntry>& Scratch)
+{
+	const int32 Count = Entries.Num();
+	if (Count < 2)
+		return;
+
+	Scratch.SetNum(Count);
+
+	// 8개 자릿수 히스토그램을 한 번에 계산
+	uint32 Histograms[8][256] = {};
+	for (const FMeshDrawSortEntry& Entry : Entries)
+	{
+		for (int32 Digit = 0; Digit < 8; ++Digit)
+		{
+			++Histograms[Digit][(Entry.SortKey >> (Digit * 8)) & 0xFF];
+		}
+	}
+
+	FMeshDrawSortEntry* Src = Entries.data();
+	FMeshDrawSortEntry* Dst = Scratch.data();
+
+	for (int32 Digit = 0; Digit < 8; ++Digit)
+	{
+		uint32* Histogram = Histograms[Digit];
+		const int32 Shift = Digit * 8;
+
+		// 모든 키가 같은 값을 가진 자릿수는 순서가 바뀌지 않으므로 생략
+		if (Histogram[(Src[0].SortKey >> Shift) & 0xFF] == static_cast<uint32>(Count))
+			continue;
+
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < 256; ++Bucket)
+		{
+			const uint32 BucketCount = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += BucketCount;
+		}
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Dst[Histogram[(Src[i].SortKey >> Shift) & 0xFF]++] = Src[i];
+		}
+
+		std::swap(Src, Dst);
+	}
+
+	// 홀수 번 스왑됐다면 결과가 Scratch에 있음
+	if (Src != Entries.data())
+	{
+		std::copy(Src, Src + Count, Entries.data());
+	}
+}
+
+void ParallelRadixSortDrawKeys(TArray<FMeshDrawSortEntry>& Entries, TArray<FMeshDrawSortEntry>& Scratch)
+{
+	constexpr int32 MaxBlocks = 16;
+
+	FTaskSystem& TaskSystem = FTaskSystem::GetInstance();
+	const int32 Count = Entries.Num();
+	const int32 NumBlocks = std::min(TaskSystem.GetNumWorkers() + 1, MaxBlocks);
+	if (Count < ParallelRadixSortThreshold || NumBlocks < 2)
+	{
+		RadixSortDrawKeys(Entries, Scratch);
+		return;
+	}
+
+	Scratch.SetNum(Count);
+	const int32 BlockSize = (Count + NumBlocks - 1) / NumBlocks;
+
+	// 블록마다 키의 OR/AND → 모든 키가 같은 자릿값을 갖는 자릿수를 한 번에 찾음
+	uint64 BlockOr[MaxBlocks] = {};
+	uint64 BlockAnd[MaxBlocks];
+	TaskSystem.ParallelFor(NumBlocks, [&](int32 Block)
+	{
+		uint64 Or = 0;
+		uint64 And = ~0ull;
+		const int32 End = std::min(Count, (Block + 1) * BlockSize);
+		for (int32 i = Block * BlockSize; i < End; ++i)
+		{
+			Or |= Entries[i].SortKey;
+			And &= Entries[i].SortKey;
+		}
+		BlockOr[Block] = Or;
+		BlockAnd[Block] = And;
+	});
+
+	uint64 VaryingBits = 0;
+	uint64 CommonBits = ~0ull;
+	for (int32 Block = 0; Block < NumBlocks; ++Block)
+	{
+		VaryingBits |= BlockOr[Block];
+		CommonBits &= BlockAnd[Block];
+	}
+	VaryingBits ^= CommonBits;
+
+	FMeshDrawSortEntry* Src = Entries.data();
+	FMeshDrawSortEntry* Dst = Scratch.data();
+	uint32 Histograms[MaxBlocks][256];
+
+	for (int32 Digit = 0; Digit < 8; ++Digit)
+	{
+		const int32 Shift = Digit * 8;
+		if (((VaryingBits >> Shift) & 0xFF) == 0)
+			continue;
+
+		TaskSystem.ParallelFor(NumBlocks, [&](int32 Block)
+		{
+			uint32* Histogram = Histograms[Block];
+			std::fill(Histogram, Histogram + 256, 0u);
+			const int32 End = std::min(Count, (Block + 1) * BlockSize);
+			for (int32 i = Block * BlockSize; i < End; ++i)
+			{
+				++Histogram[(Src[i].SortKey >> Shift) & 0xFF];
+			}
+		});
+
+		// 같은 버킷 안에서는 앞 블록이 먼저 오도록 (버킷 → 블록 순) 시작 위치를 매겨 안정성 유지
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < 256; ++Bucket)
+		{
+			for (int32 Block = 0; Block < NumBlocks; ++Block)
+			{
+				const uint32 BucketCount = Histograms[Block][Bucket];
+				Histograms[Block][Bucket] = Offset;
+				Offset += BucketCount;
+			}
+		}
+
+		TaskSystem.ParallelFor(NumBlocks, [&](int32 Block)
+		{
+			uint32* Histogram = Histograms[Block];
+			const int32 End = std::min(Count, (Block + 1) * BlockSize);
+			for (int32 i = Block * BlockSize; i < End; ++i)
+			{
+				Dst[Histogram[(Src[i].SortKey >> Shift) & 0xFF]++] = Src[i];
+			}
+		});
+
+		std::swap(Src, Dst);
+	}
+
+	if (Src != Entries.data())
+	{
+		std::copy(Src, Src + Count, Entries.data());
+	}
+}
+
+void FMeshDrawCommandList::Reset()
+{
+	Commands.clear();
+	ObjectMatrices.clear();
+	SortEntries.clear();
+
+	ShaderIds.Empty();
+	MaterialIds.Empty();
+	TextureIds.Empty();
+	MeshIds.Empty();
+	MaterialTextures.Empty();
+}
+
+uint32 FMeshDrawCommandList::GetSortId(TMap<const void*, uint32>& Table, const void* Key, uint32 MaxId)
+{
+	if (!Key)
+		return 0;
+
+	if (const uint32* Found = Table.Find(Key))
+		return *Found;
+
+	// 필드 범위를 넘으면 마지막 ID를 공유 (정렬 품질만 떨어지고 결과는 동일)
+	const uint32 Id = std::min(static_cast<uint32>(Table.Num()) + 1, MaxId);
+	Table.Add(Key, Id);
+	return Id;
+}
+
+uint64 FMeshDrawCommandList::MakeSortKey(EMeshPass Pass, uint32 ShaderId, uint32 MaterialId, uint32 TextureId, uint32 MeshId, float ViewDepth)
+{
+	// 양수 float의 비트 패턴은 값 순서와 같으므로 상위 16비트만 사용
+	const uint32 DepthBits = std::bit_cast<uint32>(std::max(ViewDepth, 0.0f)) >> 16;
+
+	return (static_cast<uint64>(Pass) << 62)
+		| (static_cast<uint64>(ShaderId) << 52)
+		| (static_cast<uint64>(MaterialId) << 40)
+		| (static_cast<uint64>(TextureId) << 28)
+		| (static_cast<uint64>(MeshId) << 16)
+		| static_cast<uint64>(DepthBits);
+}
+
+uint32 FMeshDrawCommandList::AddObject(const FMatrix& WorldMatrix)
+{
+	ObjectMatrices.Add(WorldMatrix);
+	return static_cast<uint32>(ObjectMatrices.Num() - 1);
+}
+
+void FMeshDrawCommandList::AddCommand(const FMeshDrawCommand& Command, float ViewDepth, EMeshPass Pass)
+{
+	// 메시는 정점 버퍼로 구분
+	const uint64 SortKey = MakeSortKey(Pass,
+		GetSortId(ShaderIds, Command.Shader.Resource, 0x3FF),
+		GetSortId(MaterialIds, Command.Material, 0xFFF),
+		GetSortId(TextureIds, Command.Texture.Resource, 0xFFF),
+		GetSortId(MeshIds, Command.VertexBuffer.Resource, 0xFFF),
+		ViewDepth);
+
+	SortEntries.Add({ SortKey, static_cast<uint32>(Commands.Num()) });
+	Commands.Add(Command);
+}
+
+void FMeshDrawCommandList::Sort()
+{
+	RadixSortDrawKeys(SortEntries, SortScratch);
+}
+
+void FMeshDrawCommandList::SetInstancedShader(FRHIShaderHandle Shader, FRHIShaderHandle InstancedShader)
+{
+	if (InstancedShader.IsValid())
+	{
+		InstancedShaders.Add(Shader.Resource, InstancedShader);
+	}
+	else
+	{
+		InstancedShaders.Remove(Shader.Resource);
+	}
+}
+
+bool FMeshDrawCommandList::IsSameBatch(const FMeshDrawCommand& A, const FMeshDrawCommand& B)
+{
+	// 정렬 키 ID는 범위를 넘으면 공유될 수 있으므로 실제 핸들로 비교
+	return A.Shader == B.Shader && A.VertexBuffer == B.VertexBuffer && A.IndexBuffer == B.IndexBuffer
+		&& A.Material == B.Material && A.Texture == B.Texture;
+}
+
+void FMeshDrawCommandList::BindSharedState(IMeshDrawBackend& Backend, const FMeshDrawCommand& Command, FRHIShaderHandle Shader, FSubmitState& State, FMeshDrawSubmitResult& Result)
+{
+	if (Shader != Result.LastShader)
+	{
+		Backend.BindShader(Shader);
+		Result.LastShader = Shader;
+		++Result.ShaderChanges;
+	}
+
+	if (Command.VertexBuffer != State.LastVertexBuffer || Command.IndexBuffer != State.LastIndexBuffer)
+	{
+		Backend.BindMesh(Command.VertexBuffer, Command.IndexBuffer, Command.VertexStride);
+		State.LastVertexBuffer = Command.VertexBuffer;
+		State.LastIndexBuffer = Command.IndexBuffer;
+		++Result.MeshChanges;
+	}
+
+	// 픽셀 상수(머티리얼 정보)와 텍스처는 둘 중 하나라도 바뀔 때만 다시 올림
+	if (!State.bMaterialBound || Command.Material != State.LastBoundMaterial || Command.Texture != State.LastBoundTexture)
+	{
+		Backend.BindMaterial(Command.Material, Command.Texture);
+
+		if (Command.Material && Command.Material != Result.LastMaterial)
+		{
+			Result.LastMaterial = Command.Material;
+			++Result.MaterialChanges;
+		}
+		if (Command.Texture.IsValid() && Command.Texture != Result.LastTexture)
+		{
+			Result.LastTexture = Command.Texture;
+			++Result.TextureChanges;
+		}
+
+		State.LastBoundMaterial = Command.Material;
+		State.LastBoundTexture = Command.Texture;
+		State.bMaterialBound = true;
+	}
+}
+
+void FMeshDrawCommandList::SubmitSingle(IMeshDrawBackend& Backend, const FMeshDrawCommand& Command, FSubmitState& State, FMeshDrawSubmitResult& Result) const
+{
+	BindSharedState(Backend, Command, Command.Shader, State, Result);
+
+	// 오브젝트 상수(월드 행렬/하이라이트)는 오브젝트가 바뀔 때만
+	if (Command.ObjectIndex != State.LastObjectIndex)
+	{
+		Backend.BindObject(ObjectMatrices[Command.ObjectIndex], Command.bSelected);
+		State.LastObjectIndex = Command.ObjectIndex;
+	}
+
+	Backend.DrawIndexed(Command.IndexCount, Command.StartIndex);
+	++Result.DrawCalls;
+}
+
+void FMeshDrawCommandList::SubmitInstancedRun(IMeshDrawBackend& Backend, int32 RunStart, int32 RunEnd, FRHIShaderHandle InstancedShader, FSubmitState& State, FMeshDrawSubmitResult& Result)
+{
+	// 선택된 오브젝트는 개별로, 나머지는 섹션별로 모음
+	RunScratch.clear();
+	for (int32 i = RunStart; i < RunEnd; ++i)
+	{
+		const FMeshDrawCommand& Command = Commands[SortEntries[i].CommandIndex];
+		if (Command.bSelected)
+		{
+			SubmitSingle(Backend, Command, State, Result);
+		}
+		else
+		{
+			RunScratch.Add(&Command);
+		}
+	}
+
+	// 같은 메시라도 섹션(StartIndex)이 다르면 별도 드로우. 섹션 수는 작으므로 선형 탐색
+	for (int32 First = 0; First < RunScratch.Num(); ++First)
+	{
+		const FMeshDrawCommand* Section = RunScratch[First];
+		if (!Section)
+			continue;
+
+		InstanceScratch.clear();
+		for (int32 i = First; i < RunScratch.Num(); ++i)
+		{
+			const FMeshDrawCommand* Command = RunScratch[i];
+			if (Command && Command->StartIndex == Section->StartIndex && Command->IndexCount == Section->IndexCount)
+			{
+				InstanceScratch.Add(ObjectMatrices[Command->ObjectIndex]);
+				RunScratch[i] = nullptr;
+			}
+		}
+
+		if (InstanceScratch.Num() < MinInstancesPerDraw)
+		{
+			SubmitSingle(Backend, *Section, State, Result);
+			continue;
+		}
+
+		BindSharedState(Backend, *Section, InstancedShader, State, Result);
+
+		for (int32 ChunkStart = 0; ChunkStart < InstanceScratch.Num(); ChunkStart += MaxInstancesPerDraw)
+		{
+			const int32 ChunkCount = std::min(MaxInstancesPerDraw, InstanceScratch.Num() - ChunkStart);
+			Backend.BindInstances(std::span<const FMatrix>(InstanceScratch.data() + ChunkStart, ChunkCount));
+
+			Backend.DrawIndexedInstanced(Section->IndexCount, Section->StartIndex, static_cast<uint32>(ChunkCount));
+			++Result.DrawCalls;
+			++Result.InstancedDrawCalls;
+			Result.Instances += static_cast<uint32>(ChunkCount);
+		}
+
+		// 인스턴싱 드로우가 오브젝트 상수(하이라이트)를 덮어썼으므로 다음 개별 드로우는 다시 바인딩
+		State.LastObjectIndex = FSubmitState::NoObject;
+	}
+}
+
+FMeshDrawSubmitResult FMeshDrawCommandList::Submit(IMeshDrawBackend& Backend)
+{
+	FMeshDrawSubmitResult Result;
+	FSubmitState State;
+
+	const int32 NumEntries = SortEntries.Num();
+	int32 RunStart = 0;
+	while (RunStart < NumEntries)
+	{
+		const FMeshDrawCommand& First = Commands[SortEntries[RunStart].CommandIndex];
+
+		// 같은 셰이더/메시/머티리얼/텍스처가 연속된 구간
+		int32 RunEnd = RunStart + 1;
+		while (RunEnd < NumEntries && IsSameBatch(First, Commands[SortEntries[RunEnd].CommandIndex]))
+		{
+			++RunEnd;
+		}
+
+		const FRHIShaderHandle* InstancedShader = InstancedShaders.Find(First.Shader.Resource);
+		if (InstancedShader && RunEnd - RunStart >= MinInstancesPerDraw)
+		{
+			SubmitInstancedRun(Backend, RunStart, RunEnd, *InstancedShader, State, Result);
+		}
+		else
+		{
+			for (int32 i = RunStart; i < RunEnd; ++i)
+			{
+				SubmitSingle(Backend, Commands[SortEntries[i].CommandIndex], State, Result);
+			}
+		}
+
+		RunStart = RunEnd;
+	}
+
+	return Result;
+}
+
+// ============================================================================
+// FRHIMeshDrawBackend
+// ============================================================================
+
+FRHIMeshDrawBackend::FRHIMeshDrawBackend(FRHICommandList& InCommandList, const FMatrix& InViewMatrix, const FMatrix& InProjMatrix, const FVector& InHighlightColor)
+	: CommandList(InCommandList)
+	, ViewMatrix(InViewMatrix)
+	, ProjMatrix(InProjMatrix)
+	, HighlightColor(InHighlightColor)
+{
+}
+
+void FRHIMeshDrawBackend::BindShader(FRHIShaderHandle Shader)
+{
+	CommandList.SetShader(Shader);
+}
+
+void FRHIMeshDrawBackend::BindMesh(FRHIBufferHandle VertexBuffer, FRHIBufferHandle IndexBuffer, uint32 VertexStride)
+{
+	CommandList.SetVertexIndexBuffers(VertexBuffer, IndexBuffer, VertexStride);
+}
+
+void FRHIMeshDrawBackend::BindMaterial(const FObjMaterialInfo* MaterialInfo, FRHITextureHandle Texture)
+{
+	if (Texture.IsValid())
+	{
+		CommandList.SetShaderResource(0, Texture);
+	}
+	CommandList.SetPixelConstants(MaterialInfo, Texture.IsValid());
+}
+
+void FRHIMeshDrawBackend::BindObject(const FMatrix& WorldMatrix, bool bSelected)
+{
+	CommandList.SetObjectConstants(WorldMatrix, ViewMatrix, ProjMatrix);
+	CommandList.SetHighlightConstants(bSelected, HighlightColor, 0, 0, 0, 0);
+}
+
+void FRHIMeshDrawBackend::DrawIndexed(uint32 IndexCount, uint32 StartIndex)
+{
+	CommandList.DrawIndexed(IndexCount, StartIndex);
+}
+
+void FRHIMeshDrawBackend::BindInstances(std::span<const FMatrix> WorldMatrices)
+{
+	CommandList.SetObjectConstants(FMatrix::Identity(), ViewMatrix, ProjMatrix);
+	CommandList.SetHighlightConstants(0, HighlightColor, 0, 0, 0, 0);
+	CommandList.SetInstanceData(WorldMatrices.data(), static_cast<uint32>(WorldMatrices.size()));
+}
+
+void FRHIMeshDrawBackend::DrawIndexedInstanced(uint32 IndexCount, uint32 StartIndex, uint32 NumInstances)
+{
+	CommandList.DrawIndexedInstanced(IndexCount, StartIndex, NumInstances);
+}
+
+// ============================================================================
+// FMeshDrawSortBenchmark
+// ============================================================================
+
+void FMeshDrawSortBenchmark::Run(int32 NumDraws)
+{
+	if (NumDraws <= 0)
+		return;
+
+	// 실제 씬처럼 셰이더는 적고 머티리얼/메시는 많으며, 텍스처는 머티리얼이 결정
+	constexpr int32 NumShaders = 8;
+	constexpr int32 NumMaterials = 256;
+	constexpr int32 NumTextures = 128;
+	constexpr int32 NumMeshes = 256;
+	constexpr int32 NumObjects = 4096;
+
+	// Null 컨텍스트는 핸들과 머티리얼 정보를 역참조하지 않으므로 구분 가능한 값만 있으면 됨
+	// (머티리얼 정보는 포인터로만 비교되므로 머티리얼마다 다른 주소를 빌려 씀)
+	std::unique_ptr<uint64[]> MaterialStorage(new uint64[NumMaterials]);
+	auto GetMaterial = [&](int32 Index) { return reinterpret_cast<const FObjMaterialInfo*>(&MaterialStorage[Index]); };
+
+	std::mt19937 Random(12345);
+	std::uniform_int_distribution<int32> PickShader(0, NumShaders - 1);
+	std::uniform_int_distribution<int32> PickMaterial(0, NumMaterials - 1);
+	std::uniform_int_distribution<int32> PickMesh(0, NumMeshes - 1);
+	std::uniform_int_distribution<int32> PickObject(0, NumObjects - 1);
+	std::uniform_int_distribution<uint32> PickIndexCount(36, 3000);
+	std::uniform_real_distribution<float> PickDepth(1.0f, 1000.0f);
+
+	TArray<FMeshDrawCommand> SourceCommands;
+	TArray<float> SourceDepths;
+	SourceCommands.Reserve(NumDraws);
+	SourceDepths.Reserve(NumDraws);
+	for (int32 i = 0; i < NumDraws; ++i)
+	{
+		const int32 MaterialIndex = PickMaterial(Random);
+		const int32 MeshIndex = PickMesh(Random);
+
+		// 핸들 ID는 종류마다 겹치지 않게 (0은 무효 핸들)
+		FMeshDrawCommand Command;
+		Command.Shader = FRHIShaderHandle::FromId(1 + PickShader(Random));
+		Command.VertexBuffer = FRHIBufferHandle::FromId(1 + MeshIndex * 2);
+		Command.IndexBuffer = FRHIBufferHandle::FromId(2 + MeshIndex * 2);
+		Command.VertexStride = 32;
+		Command.Material = GetMaterial(MaterialIndex);
+		Command.Texture = FRHITextureHandle::FromId(1 + MaterialIndex % NumTextures);
+		Command.ObjectIndex = static_cast<uint32>(PickObject(Random));
+		Command.IndexCount = PickIndexCount(Random);
+		SourceCommands.Add(Command);
+		SourceDepths.Add(PickDepth(Random));
+	}
+
+	const FBenchmark Bench("DRAWS");
+	Bench.LogInfo("%d draws (%d shaders, %d materials, %d textures, %d meshes, %d objects)",
+		NumDraws, NumShaders, NumMaterials, NumTextures, NumMeshes, NumObjects);
+
+	FMeshDrawCommandList CommandList;
+	const double RecordMs = FBenchmark::MeasureMs([&]()
+	{
+		for (int32 i = 0; i < NumObjects; ++i)
+		{
+			CommandList.AddObject(FMatrix::Identity());
+		}
+		for (int32 i = 0; i < NumDraws; ++i)
+		{
+			CommandList.AddCommand(SourceCommands[i], SourceDepths[i]);
+		}
+	});
+	Bench.LogResult("record", RecordMs);
+
+	// 렌더러와 같은 경로: 정렬된 커맨드 → FRHIMeshDrawBackend → RHI 커맨드 리스트 → Null 컨텍스트
+	FRHICommandList RHICommands;
+	FNullRHICommandContext NullContext;
+	const FMatrix ViewMatrix = FMatrix::Identity();
+	const FMatrix ProjMatrix = FMatrix::Identity();
+	auto MeasureSubmit = [&](const char* SubmitLabel, const char* ExecuteLabel)
+	{
+		RHICommands.Reset();
+		NullContext.Reset();
+		FMeshDrawSubmitResult Result;
+		const double SubmitMs = FBenchmark::MeasureMs([&]()
+		{
+			FRHIMeshDrawBackend Backend(RHICommands, ViewMatrix, ProjMatrix, FVector(1.0f, 1.0f, 0.0f));
+			Result = CommandList.Submit(Backend);
+		});
+		Bench.LogResult(SubmitLabel, SubmitMs, "%7u draws  shader %6u  material %6u  texture %6u  mesh %6u",
+			Result.DrawCalls, Result.ShaderChanges, Result.MaterialChanges, Result.TextureChanges, Result.MeshChanges);
+
+		const double ExecuteMs = FBenchmark::MeasureMs([&]() { RHICommands.Execute(NullContext); });
+		Bench.LogResult(ExecuteLabel, ExecuteMs, "%7u RHI commands  %8llu bytes  %7u state changes",
+			RHICommands.GetNumCommands(), static_cast<unsigned long long>(RHICommands.GetUsedBytes()), NullContext.GetNumStateChanges());
+	};
+
+	// 기록 순서 그대로 제출한 뒤 정렬해서 다시 제출
+	MeasureSubmit("submit unsorted", "execute unsorted (null)");
+	Bench.LogResult("sort (RadixSortDrawKeys)", FBenchmark::MeasureMs([&]() { CommandList.Sort(); }));
+	MeasureSubmit("submit sorted", "execute sorted (null)");
+}
@@ -0,0 +1,203 @@
+﻿#pragma once
+#include <span>
+#include "RHICommandList.h"
+
+class UStaticMeshComponent;
+struct FObjMaterialInfo;
+
+// 렌더 패스 (정렬 키의 최상위 비트 - 패스 순서대로 제출)
+enum class EMeshPass : uint8
+{
+	Opaque = 0,
+	Translucent = 1,
+};
+
+/**
+ * FMeshDrawCommand
+ * - 메시 섹션(FGroupInfo) 하나를 그리는 데 필요한 상태를 기록 시점에 RHI 핸들로 미리 해석해 둔 것
+ * - 제출 단계에서는 문자열 조회/리소스 검색 없이 핸들 비교만으로 중복 바인딩을 건너뛴다
+ * - 엔진 객체를 참조하지 않으므로 정렬/제출은 pch(windows.h/d3d11) 없이 컴파일된다
+ */
+struct FMeshDrawCommand
+{
+	FRHIShaderHandle Shader;
+	FRHIBufferHandle VertexBuffer;
+	FRHIBufferHandle IndexBuffer;
+	uint32 VertexStride = 0;
+	const FObjMaterialInfo* Material = nullptr;	// nullptr이면 머티리얼 없는 메시 (기본 픽셀 상수)
+	FRHITextureHandle Texture;
+	uint32 ObjectIndex = 0;		// FMeshDrawCommandList::AddObject가 돌려준 월드 행렬 인덱스
+	uint32 StartIndex = 0;
+	uint32 IndexCount = 0;
+	bool bSelected = false;
+};
+
+// 64비트 정렬 키 + 커맨드 인덱스
+struct FMeshDrawSortEntry
+{
+	uint64 SortKey;
+	uint32 CommandIndex;
+};
+
+// 64비트 키 LSD Radix Sort (8비트 x 8패스, 모든 키가 같은 자릿값을 가진 패스는 건너뜀)
+void RadixSortDrawKeys(TArray<FMeshDrawSortEntry>& Entries, TArray<FMeshDrawSortEntry>& Scratch);
+
+// RadixSortDrawKeys와 같은 결과(안정 정렬)를 FTaskSystem 워커로 나눠 계산
+// - 블록별 히스토그램 → 버킷/블록 순 시작 위치 → 블록별 분배를 패스마다 반복
+// - ParallelRadixSortThreshold개 미만이면 직렬 버전 사용
+void ParallelRadixSortDrawKeys(TArray<FMeshDrawSortEntry>& Entries, TArray<FMeshDrawSortEntry>& Scratch);
+
+constexpr int32 ParallelRadixSortThreshold = 4096;
+
+/**
+ * IMeshDrawBackend
+ * - 정렬된 커맨드를 실제로 실행하는 대상
+ * - URenderer, 헤드리스 드라이버, BENCH DRAWS 모두 RHI 커맨드 리스트에 기록하는 FRHIMeshDrawBackend를 사용
+ *   (실행은 D3D11 또는 Null 컨텍스트)
+ */
+class IMeshDrawBackend
+{
+public:
+	virtual ~IMeshDrawBackend() = default;
+
+	virtual void BindShader(FRHIShaderHandle Shader) = 0;
+	virtual void BindMesh(FRHIBufferHandle VertexBuffer, FRHIBufferHandle IndexBuffer, uint32 VertexStride) = 0;
+	// MaterialInfo가 nullptr이면 기본 픽셀 상수
+	virtual void BindMaterial(const FObjMaterialInfo* MaterialInfo, FRHITextureHandle Texture) = 0;
+	virtual void BindObject(const FMatrix& WorldMatrix, bool bSelected) = 0;
+	virtual void DrawIndexed(uint32 IndexCount, uint32 StartIndex) = 0;
+
+	// 인스턴싱: 월드 행렬들을 인스턴스 데이터로 바인딩
+	virtual void BindInstances(std::span<const FMatrix> WorldMatrices) = 0;
+	virtual void DrawIndexedInstanced(uint32 IndexCount, uint32 StartIndex, uint32 NumInstances) = 0;
+};
+
+// 정렬된 메시 커맨드를 RHI 커맨드 리스트에 기록하는 백엔드 (리소스는 기록 시점에 이미 RHI 핸들로 해석됨)
+class FRHIMeshDrawBackend : public IMeshDrawBackend
+{
+public:
+	FRHIMeshDrawBackend(FRHICommandList& InCommandList, const FMatrix& InViewMatrix, const FMatrix& InProjMatrix, const FVector& InHighlightColor);
+
+	void BindShader(FRHIShaderHandle Shader) override;
+	void BindMesh(FRHIBufferHandle VertexBuffer, FRHIBufferHandle IndexBuffer, uint32 VertexStride) override;
+	void BindMaterial(const FObjMaterialInfo* MaterialInfo, FRHITextureHandle Texture) override;
+	void BindObject(const FMatrix& WorldMatrix, bool bSelected) override;
+	void DrawIndexed(uint32 IndexCount, uint32 StartIndex) override;
+	void BindInstances(std::span<const FMatrix> WorldMatrices) override;
+	void DrawIndexedInstanced(uint32 IndexCount, uint32 StartIndex, uint32 NumInstances) override;
+
+private:
+	FRHICommandList& CommandList;
+	FMatrix ViewMatrix;
+	FMatrix ProjMatrix;
+	FVector HighlightColor;
+};
+
+// 제출 결과 (통계 반영 및 렌더러 상태 추적 동기화용)
+struct FMeshDrawSubmitResult
+{
+	uint32 DrawCalls = 0;
+	uint32 ShaderChanges = 0;
+	uint32 MaterialChanges = 0;
+	uint32 TextureChanges = 0;
+	uint32 MeshChanges = 0;
+	uint32 InstancedDrawCalls = 0;
+	uint32 Instances = 0;		// 인스턴싱으로 그려진 컴포넌트 섹션 수
+
+	FRHIShaderHandle LastShader;
+	const FObjMaterialInfo* LastMaterial = nullptr;
+	FRHITextureHandle LastTexture;
+};
+
+/**
+ * FMeshDrawCommandList
+ * - 뷰 하나의 정적 메시 드로우를 섹션 단위 커맨드로 기록
+ * - 정렬 키 (상위 → 하위): Pass(2) | Shader(10) | Material(12) | Texture(12) | Mesh(12) | Depth(16)
+ * - 같은 셰이더/머티리얼/텍스처/메시가 연속되도록 정렬한 뒤 바뀐 상태만 백엔드에 바인딩
+ * - 인스턴싱 셰이더가 등록된 셰이더는 같은 메시 섹션끼리 DrawIndexedInstanced 한 번으로 묶음
+ *   (선택된 컴포넌트는 하이라이트 때문에 개별 드로우)
+ */
+class FMeshDrawCommandList
+{
+public:
+	// 새 뷰 기록 시작 (버퍼 용량은 유지)
+	void Reset();
+
+	// 컴포넌트의 모든 섹션을 기록. ViewDepth는 불투명 패스의 앞→뒤 정렬에 사용
+	// (엔진 객체를 RHI 핸들로 해석하므로 pch를 쓰는 StaticMeshDrawCommands.cpp에 정의)
+	void AddStaticMesh(UStaticMeshComponent* Component, float ViewDepth, bool bSelected, EMeshPass Pass = EMeshPass::Opaque);
+
+	// 오브젝트 월드 행렬을 등록하고 커맨드의 ObjectIndex로 쓸 인덱스를 반환
+	uint32 AddObject(const FMatrix& WorldMatrix);
+
+	// 이미 해석된 커맨드 하나를 기록 (AddStaticMesh의 섹션별 기록, 합성 커맨드 벤치마크)
+	void AddCommand(const FMeshDrawCommand& Command, float ViewDepth, EMeshPass Pass = EMeshPass::Opaque);
+
+	void Sort();
+
+	// 정렬된 순서로 백엔드에 제출 (Sort 이후 호출)
+	FMeshDrawSubmitResult Submit(IMeshDrawBackend& Backend);
+
+	// Shader로 기록된 커맨드를 인스턴싱할 때 사용할 셰이더 (무효 핸들이면 인스턴싱 안 함)
+	void SetInstancedShader(FRHIShaderHandle Shader, FRHIShaderHandle InstancedShader);
+
+	static constexpr int32 MinInstancesPerDraw = 2;
+	static constexpr int32 MaxInstancesPerDraw = 16 * 1024;
+
+	int32 Num() const { return Commands.Num(); }
+	bool IsEmpty() const { return Commands.IsEmpty(); }
+
+private:
+	// 제출 중 마지막으로 바인딩된 상태
+	struct FSubmitState
+	{
+		static constexpr uint32 NoObject = ~0u;
+
+		FRHIBufferHandle LastVertexBuffer;
+		FRHIBufferHandle LastIndexBuffer;
+		uint32 LastObjectIndex = NoObject;
+		const FObjMaterialInfo* LastBoundMaterial = nullptr;
+		FRHITextureHandle LastBoundTexture;
+		bool bMaterialBound = false;
+	};
+
+	static bool IsSameBatch(const FMeshDrawCommand& A, const FMeshDrawCommand& B);
+	static void BindSharedState(IMeshDrawBackend& Backend, const FMeshDrawCommand& Command, FRHIShaderHandle Shader, FSubmitState& State, FMeshDrawSubmitResult& Result);
+	void SubmitSingle(IMeshDrawBackend& Backend, const FMeshDrawCommand& Command, FSubmitState& State, FMeshDrawSubmitResult& Result) const;
+	void SubmitInstancedRun(IMeshDrawBackend& Backend, int32 RunStart, int32 RunEnd, FRHIShaderHandle InstancedShader, FSubmitState& State, FMeshDrawSubmitResult& Result);
+
+	uint32 GetSortId(TMap<const void*, uint32>& Table, const void* Key, uint32 MaxId);
+	static uint64 MakeSortKey(EMeshPass Pass, uint32 ShaderId, uint32 MaterialId, uint32 TextureId, uint32 MeshId, float ViewDepth);
+
+	TArray<FMeshDrawCommand> Commands;
+	TArray<FMatrix> ObjectMatrices;
+	TArray<FMeshDrawSortEntry> SortEntries;
+	TArray<FMeshDrawSortEntry> SortScratch;
+
+	// 핸들/머티리얼 포인터 → 정렬 키용 조밀 ID (프레임마다 처음 등장한 순서로 부여)
+	TMap<const void*, uint32> ShaderIds;
+	TMap<const void*, uint32> MaterialIds;
+	TMap<const void*, uint32> TextureIds;
+	TMap<const void*, uint32> MeshIds;
+
+	// 머티리얼 → 디퓨즈 텍스처 뷰 (CreateOrGetTextureData 문자열 조회를 머티리얼당 1회로)
+	TMap<const FObjMaterialInfo*, FRHITextureHandle> MaterialTextures;
+
+	// 셰이더 → 인스턴싱 셰이더 (Reset에서 지우지 않음)
+	TMap<const void*, FRHIShaderHandle> InstancedShaders;
+
+	// SubmitInstancedRun 중간 버퍼
+	TArray<const FMeshDrawCommand*> RunScratch;
+	TArray<FMatrix> InstanceScratch;
+};
+
+/**
+ * FMeshDrawSortBenchmark
+ * - 셰이더/머티리얼/텍스처/메시를 임의로 섞은 합성 커맨드 N개를 FMeshDrawCommandList에 기록 (콘솔 BENCH DRAWS, HeadlessMain)
+ * - 실제 Sort/Submit 경로를 FRHIMeshDrawBackend로 RHI 커맨드 리스트에 기록하고 FNullRHICommandContext에서 실행해
+ *   정렬 시간과 정렬 전/후 제출/실행 시간, 상태 변경 수를 비교
+ */
+struct FMeshDrawSortBenchmark
+{
+	static void Run(int32 NumDraws = 100000);
+};
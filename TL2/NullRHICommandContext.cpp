@@ -0,0 +1,69 @@
+﻿// RHICommandList.cpp와 마찬가지로 pch.h 없이 컴파일 (d3d11 없이 링크 가능한 실행 백엔드)
+#include "NullRHICommandContext.h"
+
+void FNullRHICommandContext::SetShader(FRHIShaderHandle Shader)
+{
+	++ShaderChanges;
+}
+
+void FNullRHICommandContext::SetVertexIndexBuffers(FRHIBufferHandle VertexBuffer, FRHIBufferHandle IndexBuffer, uint32 Stride)
+{
+	++BufferChanges;
+}
+
+void FNullRHICommandContext::SetPrimitiveTopology(ERHIPrimitiveTopology Topology)
+{
+}
+
+void FNullRHICommandContext::SetDefaultSampler(uint32 Slot)
+{
+}
+
+void FNullRHICommandContext::SetShaderResource(uint32 Slot, FRHITextureHandle Texture)
+{
+	++TextureChanges;
+}
+
+void FNullRHICommandContext::SetPixelConstants(const FObjMaterialInfo* MaterialInfo, bool bHasTexture)
+{
+	++MaterialChanges;
+}
+
+void FNullRHICommandContext::StageObjectConstants(std::span<const FMatrix> WorldMatrices, std::span<const FRHIHighlightConstants> Highlights)
+{
+	StagedConstantBytes += WorldMatrices.size_bytes() + Highlights.size_bytes();
+}
+
+void FNullRHICommandContext::SetObjectConstants(uint32 ConstantIndex, const FMatrix& WorldMatrix, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix)
+{
+	++ObjectConstantUpdates;
+}
+
+void FNullRHICommandContext::SetHighlightConstants(uint32 ConstantIndex, const FRHIHighlightConstants& Constants)
+{
+	++ObjectConstantUpdates;
+}
+
+void FNullRHICommandContext::SetInstanceData(const FMatrix* WorldMatrices, uint32 NumInstances)
+{
+	InstanceBytes += static_cast<uint64>(NumInstances) * sizeof(FMatrix);
+}
+
+void FNullRHICommandContext::DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex)
+{
+	++DrawCalls;
+	Indices += IndexCount;
+}
+
+void FNullRHICommandContext::DrawIndexedInstanced(uint32 IndexCount, uint32 StartIndex, uint32 NumInstances)
+{
+	++DrawCalls;
+	Indices += static_cast<uint64>(IndexCount) * NumInstances;
+}
+
+void FNullRHICommandContext::Reset()
+{
+	ShaderChanges = BufferChanges = TextureChanges = MaterialChanges = 0;
+	ObjectConstantUpdates = DrawCalls = 0;
+	Indices = InstanceBytes = StagedConstantBytes = 0;
+}
@@ -0,0 +1,40 @@
+﻿#pragma once
+#include "RHICommandList.h"
+
+/**
+ * FNullRHICommandContext
+ * - GPU 없이 실행 호출 수만 세는 백엔드 (헤드리스 드라이버/벤치마크/회귀 측정용)
+ * - 핸들은 역참조하지 않으므로 실제 리소스 없이 FRHI*Handle::FromId로 만든 값도 실행할 수 있다
+ * - 상태 변경은 종류별로 따로 세어 정렬 전후의 바인딩 수를 비교할 수 있음
+ */
+class FNullRHICommandContext : public IRHICommandContext
+{
+public:
+	void SetShader(FRHIShaderHandle Shader) override;
+	void SetVertexIndexBuffers(FRHIBufferHandle VertexBuffer, FRHIBufferHandle IndexBuffer, uint32 Stride) override;
+	void SetPrimitiveTopology(ERHIPrimitiveTopology Topology) override;
+	void SetDefaultSampler(uint32 Slot) override;
+	void SetShaderResource(uint32 Slot, FRHITextureHandle Texture) override;
+	void SetPixelConstants(const FObjMaterialInfo* MaterialInfo, bool bHasTexture) override;
+	void StageObjectConstants(std::span<const FMatrix> WorldMatrices, std::span<const FRHIHighlightConstants> Highlights) override;
+	void SetObjectConstants(uint32 ConstantIndex, const FMatrix& WorldMatrix, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix) override;
+	void SetHighlightConstants(uint32 ConstantIndex, const FRHIHighlightConstants& Constants) override;
+	void SetInstanceData(const FMatrix* WorldMatrices, uint32 NumInstances) override;
+	void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) override;
+	void DrawIndexedInstanced(uint32 IndexCount, uint32 StartIndex, uint32 NumInstances) override;
+
+	void Reset();
+
+	// 셰이더/버퍼/텍스처/머티리얼(픽셀 상수) 바인딩 합계
+	uint32 GetNumStateChanges() const { return ShaderChanges + BufferChanges + TextureChanges + MaterialChanges; }
+
+	uint32 ShaderChanges = 0;
+	uint32 BufferChanges = 0;
+	uint32 TextureChanges = 0;
+	uint32 MaterialChanges = 0;
+	uint32 ObjectConstantUpdates = 0;
+	uint32 DrawCalls = 0;
+	uint64 Indices = 0;
+	uint64 InstanceBytes = 0;
+	uint64 StagedConstantBytes = 0;
+};
@@ -151,12 +151,18 @@ public:
 
     // UUID 발급기: 현재 카운터를 반환하고 1 증가
     static uint32 GenerateUUID() { return GUUIDCounter++; }
+
+    // 캐시 키용 버전 발급기 (씬/트랜스폼 버전 공용, UUID와 달리 재설정하지 않음)
+    // - 해제된 오브젝트 주소에 새 오브젝트가 생겨도 (주소, 버전) 쌍이 이전 키와 겹치지 않음
+    static uint64 GenerateVersion() { return ++GVersionCounter; }
     
     //static EPropertyFlag GetPropertyFlag() { return EPropertyFlag::CPF_Instanced; }
 
 private:
     // 전역 UUID 카운터(초기값 1)
     inline static uint32 GUUIDCounter = 1;
+    // 전역 버전 카운터 (단조 증가)
+    inline static uint64 GVersionCounter = 0;
 };
 
 // ── Cast 헬퍼 (UE Cast<> 와 동일 UX) ────────────────────────────
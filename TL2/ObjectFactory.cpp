@@ -6,6 +6,13 @@ TArray<UObject*> GUObjectArray;
 TArray<int32>    GFreeIndices; // 빈 슬롯 목록
 namespace ObjectFactory
 {
+    // 오브젝트 → GUObjectArray 슬롯 (DeleteObject가 배열 전체를 훑지 않도록, 포인터를 역참조하지 않고 조회)
+    TMap<UObject*, int32>& GetObjectIndexMap()
+    {
+        static TMap<UObject*, int32> ObjectIndexMap;
+        return ObjectIndexMap;
+    }
+
     TMap<UClass*, ConstructFunc>& GetRegistry()
     {
         static TMap<UClass*, ConstructFunc> Registry;
@@ -75,6 +82,7 @@ namespace ObjectFactory
         }
 
         Obj->InternalIndex = static_cast<uint32>(idx);
+        GetObjectIndexMap()[Obj] = idx;
 
         // 고유 이름 부여
         static TMap<UClass*, int> NameCounters;
@@ -115,6 +123,7 @@ namespace ObjectFactory
         }
 
         Obj->InternalIndex = static_cast<uint32>(idx);
+        GetObjectIndexMap()[Obj] = idx;
 
         // 고유 이름 부여
         static TMap<UClass*, int> NameCounters;
@@ -132,23 +141,32 @@ namespace ObjectFactory
         return Obj;
     }
 
+    void ReserveObjects(int32 AdditionalCount)
+    {
+        if (AdditionalCount <= 0) return;
+
+        GUObjectArray.Reserve(GUObjectArray.Num() + AdditionalCount);
+        TMap<UObject*, int32>& IndexMap = GetObjectIndexMap();
+        IndexMap.reserve(IndexMap.size() + AdditionalCount);
+    }
+
     void DeleteObject(UObject* Obj)
     {
         if (!Obj) return;
 
         // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 foundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
+        TMap<UObject*, int32>& IndexMap = GetObjectIndexMap();
+        auto It = IndexMap.find(Obj);
+        if (It == IndexMap.end())
         {
-            if (GUObjectArray[i] == Obj)
-            {
-                foundIndex = i;
-                break;
-            }
+            // Not managed or already deleted.
+            return;
         }
-        if (foundIndex < 0)
+
+        const int32 foundIndex = It->second;
+        IndexMap.erase(It);
+        if (foundIndex < 0 || foundIndex >= GUObjectArray.Num() || GUObjectArray[foundIndex] != Obj)
         {
-            // Not managed or already deleted.
             return;
         }
 
@@ -169,6 +187,7 @@ namespace ObjectFactory
         }
         GUObjectArray.Empty();
         GUObjectArray.Shrink();
+        GetObjectIndexMap().clear();
         //GUObjectArray.clear();
     }
     // (선택) null 슬롯 압축
@@ -183,6 +202,7 @@ namespace ObjectFactory
                 {
                     GUObjectArray[write] = Obj;
                     Obj->InternalIndex = static_cast<uint32>(write);
+                    GetObjectIndexMap()[Obj] = write;
                     GUObjectArray[read] = nullptr;
                 }
                 ++write;
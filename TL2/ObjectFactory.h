@@ -42,6 +42,8 @@ namespace ObjectFactory
     {
         return static_cast<T*>(NewObject(&Outer, T::StaticClass()));
     }
+    // 대량 생성(붙여넣기/복제) 전에 오브젝트 테이블과 인덱스 맵을 미리 확보
+    void ReserveObjects(int32 AdditionalCount);
     // 개별 삭제(단일 소유자: Factory)
     void DeleteObject(UObject* Obj);
     // 종료시 일괄 정리
@@ -105,36 +105,38 @@ void UOctree::BuildRecursive(FOctreeNode* ChildNode, const TArray<AActor*>& InAc
         ChildNode->MicroBVH = nullptr;
     }
 }
-void UOctree::Render(FOctreeNode* ParentNode) {
-    if (ParentNode) {
-        ParentNode->AABoundingBoxComponent->SetLineColor({ 1.0f, 1.0f, 0.0f, 1.0f }); // 노란색);
-        ParentNode->AABoundingBoxComponent->Render(GetEngine()->GetWorld()->GetRenderer(), FMatrix::Identity(), FMatrix::Identity());
-
-        //// BVH 렌더링 추가
-        //if (ParentNode->MicroBVH && ParentNode->IsLeafNode()) {
-        //    //ParentNode->MicroBVH->AABoundingBoxComponent->SetLineColor({ 1.0f, 0.0f, 0.0f, 1.0f }); // 노란색);
-        //    RenderBVH(ParentNode->MicroBVH);
-        //}
+void UOctree::Render(FOctreeNode* ParentNode)
+{
+    FOctreeNode* StartNode = ParentNode ? ParentNode : Root;
+    if (!StartNode)
+    {
+        return;
     }
-    else {
-        if (!Root) {
-            return;
-        }
-        Root->AABoundingBoxComponent->Render(GetEngine()->GetWorld()->GetRenderer(), FMatrix::Identity(), FMatrix::Identity());
 
-        // 루트 노드의 BVH 렌더링
-        if (Root->MicroBVH && Root->IsLeafNode()) {
-            RenderBVH(Root->MicroBVH);
-        }
+    // 노드 박스를 모두 모아 한 번에 추가 (Persistent: 다시 그리기 전까지 매 프레임 재제출/재업로드 없음)
+    TArray<FBound> NodeBoxes;
+    CollectNodeBounds(StartNode, NodeBoxes);
+    GetEngine()->GetWorld()->GetRenderer()->AddBoxes(NodeBoxes, FVector4(1.0f, 1.0f, 0.0f, 1.0f), ELineBatchCategory::Persistent); // 노란색
 
-        ParentNode = Root;
+    // 루트 노드의 BVH 렌더링
+    if (!ParentNode && Root->MicroBVH && Root->IsLeafNode())
+    {
+        RenderBVH(Root->MicroBVH);
     }
-    for (auto ChildNode : ParentNode->Children) {
-        if (ChildNode) {
-            Render(ChildNode);
+}
+
+void UOctree::CollectNodeBounds(FOctreeNode* Node, TArray<FBound>& OutBounds) const
+{
+    OutBounds.Add(Node->Bounds);
+    for (FOctreeNode* ChildNode : Node->Children)
+    {
+        if (ChildNode)
+        {
+            CollectNodeBounds(ChildNode, OutBounds);
         }
     }
 }
+
 void UOctree::Query(const FRay& Ray, TArray<AActor*>& OutActors) const
 {
     QueryRecursive(Ray, Root, OutActors);
@@ -312,23 +314,17 @@ void UOctree::RenderBVH(FBVH* BVH)
 {
     if (!BVH) return;
 
-    const TArray<FBVHNode>& Nodes = BVH->GetNodes();
-
-    for (int i = 0; i < Nodes.Num(); ++i)
+    // 각 BVH 리프 노드의 바운딩 박스를 한 번에 추가
+    TArray<FBound> Boxes;
+    for (const FBVHNode& Node : BVH->GetNodes())
     {
-        const FBVHNode& Node = Nodes[i];
-
-        // 각 BVH 노드의 바운딩 박스를 렌더링
-        if (Node.ActorCount > 0) {
-            UAABoundingBoxComponent* BVHBoundingBox = NewObject<UAABoundingBoxComponent>();
-            BVHBoundingBox->SetMinMax(Node.BoundingBox);
-            BVHBoundingBox->SetLineColor((1.0f, 0.0f, 0.0f, 1.0f));
-           // BVHBoundingBox->Render(GetEngine()->GetWorld().GetRenderer(), FMatrix::Identity(), FMatrix::Identity());
-
-            // 메모리 정리
-            ObjectFactory::DeleteObject(BVHBoundingBox);
+        if (Node.ActorCount > 0)
+        {
+            Boxes.Add(Node.BoundingBox);
         }
     }
+
+    GetEngine()->GetWorld()->GetRenderer()->AddBoxes(Boxes, FVector4(1.0f, 0.0f, 0.0f, 1.0f), ELineBatchCategory::Persistent);
 }
 
 void UOctree::LogLeafNodeStatistics()
@@ -86,6 +86,7 @@ public:
     // 빌드 타임에 모든 리프 노드의 마이크로 BVH 미리 생성
     void PreBuildAllMicroBVH();
 
+    // 노드(및 루트 리프의 BVH) 박스를 Persistent 라인으로 추가 (다시 호출하기 전에 URenderer::ClearPersistentLines)
     void Render(FOctreeNode* Root);
 
     // BVH 렌더링
@@ -95,6 +96,8 @@ public:
     void Release();
 
 private:
+    void CollectNodeBounds(FOctreeNode* Node, TArray<FBound>& OutBounds) const;
+
     FOctreeNode* Root = nullptr;
     int32 MaxDepth = 5;//최대 깊이 조절해봐야하고
     // Leaf Node에 존재할 수 있는 최대 액터 수
@@ -1,5 +1,7 @@
 ﻿#include "pch.h"
 #include "OrientedBox.h"
+#include "Benchmark.h"
+#include <random>
 
 FOrientedBox::FOrientedBox()
     : Center(FVector())
@@ -81,14 +83,159 @@ FBound FOrientedBox::ToAABB() const
     return FBound(MinCorner, MaxCorner);
 }
 
+// ─────────────────────────────
+// SSE SAT 커널
+// - 회전 행렬 R(A 축 · B 축)과 |R| + ε 를 한 번만 계산해 15개 축을 5묶음(각 3레인)으로 검사
+// - ε는 거의 평행한 축에서 외적 축이 0이 되어 생기는 오판을 막는다
+// - 모든 벡터의 w 레인은 0으로 유지해 비교 결과에 영향을 주지 않도록 한다
+// ─────────────────────────────
+namespace
+{
+    constexpr float SATEpsilon = 1e-6f;
+
+    inline __m128 LoadVector3(const FVector& V)
+    {
+        return _mm_setr_ps(V.X, V.Y, V.Z, 0.0f);
+    }
+
+    template<int X, int Y, int Z>
+    inline __m128 Swizzle(__m128 V)
+    {
+        return _mm_shuffle_ps(V, V, _MM_SHUFFLE(3, Z, Y, X));
+    }
+
+    template<int I>
+    inline __m128 Splat(__m128 V)
+    {
+        return _mm_shuffle_ps(V, V, _MM_SHUFFLE(I, I, I, I));
+    }
+
+    inline __m128 Abs(__m128 V)
+    {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), V);
+    }
+
+    inline __m128 MulAdd3(__m128 A0, __m128 B0, __m128 A1, __m128 B1, __m128 A2, __m128 B2)
+    {
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(A0, B0), _mm_mul_ps(A1, B1)), _mm_mul_ps(A2, B2));
+    }
+
+    // 세 레인 중 하나라도 |Proj| > Radius 이면 분리 축 존재
+    inline bool IsSeparated(__m128 Proj, __m128 Radius)
+    {
+        return (_mm_movemask_ps(_mm_cmpgt_ps(Abs(Proj), Radius)) & 0x7) != 0;
+    }
+
+    struct FSATBox
+    {
+        __m128 Center;
+        __m128 Extents;
+        __m128 Axis[3];     // 월드 공간 로컬 축
+        __m128 AxisT[3];    // 전치: AxisT[k] = (Axis[0][k], Axis[1][k], Axis[2][k])
+    };
+
+    FSATBox MakeSATBox(const FOrientedBox& Box)
+    {
+        FSATBox Out;
+        Out.Center = LoadVector3(Box.Center);
+        Out.Extents = LoadVector3(Box.HalfExtents);
+        Out.Axis[0] = LoadVector3(Box.GetAxisX());
+        Out.Axis[1] = LoadVector3(Box.GetAxisY());
+        Out.Axis[2] = LoadVector3(Box.GetAxisZ());
+
+        __m128 R0 = Out.Axis[0], R1 = Out.Axis[1], R2 = Out.Axis[2], R3 = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(R0, R1, R2, R3);
+        Out.AxisT[0] = R0;
+        Out.AxisT[1] = R1;
+        Out.AxisT[2] = R2;
+        return Out;
+    }
+
+    // 교차 축 A_i x B_j (j = 0..2)의 B쪽 반경: 행 AbsRow_i에서 j를 제외한 두 성분 조합
+    inline __m128 CrossRadiusB(__m128 BeA, __m128 BeB, __m128 AbsRow)
+    {
+        return _mm_add_ps(_mm_mul_ps(BeA, Swizzle<2, 2, 1>(AbsRow)), _mm_mul_ps(BeB, Swizzle<1, 0, 0>(AbsRow)));
+    }
+
+    bool IntersectsSAT(const FSATBox& A, const FSATBox& B)
+    {
+        const __m128 Epsilon = _mm_setr_ps(SATEpsilon, SATEpsilon, SATEpsilon, 0.0f);
+
+        // Row[i][j] = A.Axis[i] · B.Axis[j]
+        __m128 Row[3];
+        __m128 AbsRow[3];
+        for (int32 i = 0; i < 3; ++i)
+        {
+            Row[i] = MulAdd3(Splat<0>(A.Axis[i]), B.AxisT[0], Splat<1>(A.Axis[i]), B.AxisT[1], Splat<2>(A.Axis[i]), B.AxisT[2]);
+            AbsRow[i] = _mm_add_ps(Abs(Row[i]), Epsilon);
+        }
+
+        // A 좌표계로 표현한 중심 차이
+        const __m128 D = _mm_sub_ps(B.Center, A.Center);
+        const __m128 T = MulAdd3(Splat<0>(D), A.AxisT[0], Splat<1>(D), A.AxisT[1], Splat<2>(D), A.AxisT[2]);
+
+        const __m128 Ae0 = Splat<0>(A.Extents), Ae1 = Splat<1>(A.Extents), Ae2 = Splat<2>(A.Extents);
+        const __m128 Be0 = Splat<0>(B.Extents), Be1 = Splat<1>(B.Extents), Be2 = Splat<2>(B.Extents);
+        const __m128 T0 = Splat<0>(T), T1 = Splat<1>(T), T2 = Splat<2>(T);
+
+        // 1-3: A의 면 법선 (|R|의 열 사용)
+        {
+            __m128 C0 = AbsRow[0], C1 = AbsRow[1], C2 = AbsRow[2], C3 = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(C0, C1, C2, C3);
+            const __m128 Rb = MulAdd3(Be0, C0, Be1, C1, Be2, C2);
+            if (IsSeparated(T, _mm_add_ps(A.Extents, Rb)))
+                return false;
+        }
+
+        // 4-6: B의 면 법선
+        {
+            const __m128 Ra = MulAdd3(Ae0, AbsRow[0], Ae1, AbsRow[1], Ae2, AbsRow[2]);
+            const __m128 Proj = MulAdd3(T0, Row[0], T1, Row[1], T2, Row[2]);
+            if (IsSeparated(Proj, _mm_add_ps(Ra, B.Extents)))
+                return false;
+        }
+
+        // 7-15: 외적 축 A_i x B_j
+        const __m128 BeA = Swizzle<1, 0, 0>(B.Extents);
+        const __m128 BeB = Swizzle<2, 2, 1>(B.Extents);
+
+        {
+            const __m128 Ra = _mm_add_ps(_mm_mul_ps(Ae1, AbsRow[2]), _mm_mul_ps(Ae2, AbsRow[1]));
+            const __m128 Proj = _mm_sub_ps(_mm_mul_ps(T2, Row[1]), _mm_mul_ps(T1, Row[2]));
+            if (IsSeparated(Proj, _mm_add_ps(Ra, CrossRadiusB(BeA, BeB, AbsRow[0]))))
+                return false;
+        }
+        {
+            const __m128 Ra = _mm_add_ps(_mm_mul_ps(Ae0, AbsRow[2]), _mm_mul_ps(Ae2, AbsRow[0]));
+            const __m128 Proj = _mm_sub_ps(_mm_mul_ps(T0, Row[2]), _mm_mul_ps(T2, Row[0]));
+            if (IsSeparated(Proj, _mm_add_ps(Ra, CrossRadiusB(BeA, BeB, AbsRow[1]))))
+                return false;
+        }
+        {
+            const __m128 Ra = _mm_add_ps(_mm_mul_ps(Ae0, AbsRow[1]), _mm_mul_ps(Ae1, AbsRow[0]));
+            const __m128 Proj = _mm_sub_ps(_mm_mul_ps(T1, Row[0]), _mm_mul_ps(T0, Row[1]));
+            if (IsSeparated(Proj, _mm_add_ps(Ra, CrossRadiusB(BeA, BeB, AbsRow[2]))))
+                return false;
+        }
+
+        // 모든 축에서 겹침 → 충돌 O
+        return true;
+    }
+}
+
 // OBB vs OBB 충돌 검사 (SAT)
 bool FOrientedBox::Intersects(const FOrientedBox& Other) const
+{
+    return IntersectsSAT(MakeSATBox(*this), MakeSATBox(Other));
+}
+
+// 스칼라 SAT (기준 구현)
+bool FOrientedBox::IntersectsScalar(const FOrientedBox& Other) const
 {
     // SAT: 15개 분리 축 검사
     // 1-3: this의 3개 축
     // 4-6: Other의 3개 축
     // 7-15: 3x3 외적 축
-
     FVector AxesA[3] = { GetAxisX(), GetAxisY(), GetAxisZ() };
     FVector AxesB[3] = { Other.GetAxisX(), Other.GetAxisY(), Other.GetAxisZ() };
 
@@ -102,7 +249,7 @@ bool FOrientedBox::Intersects(const FOrientedBox& Other) const
     // 4-6: B의 면 법선 (3개 축)
     for (int32 i = 0; i < 3; ++i)
     {
-        if (!OverlapOnAxis(AxesB[i], Other))    // Other가 아니라 *this 아닌가?
+        if (!OverlapOnAxis(AxesB[i], Other))
             return false;
     }
 
@@ -118,7 +265,6 @@ bool FOrientedBox::Intersects(const FOrientedBox& Other) const
                 continue;
 
             CrossAxis.Normalize();
-
             if (!OverlapOnAxis(CrossAxis, Other))
                 return false;
         }
@@ -148,12 +294,219 @@ void FOrientedBox::ProjectOntoAxis(const FVector& Axis, float& OutMin, float& Ou
     // 반경 계산 (각 로컬 축의 기여도)
     FVector Axes[3] = { GetAxisX(), GetAxisY(), GetAxisZ() };
     float Radius = 0.0f;
-
     for (int32 i = 0; i < 3; ++i)
     {
-        Radius += abs(Axes[i].Dot(Axis)) * HalfExtents[i];
+        Radius += std::abs(Axes[i].Dot(Axis)) * HalfExtents[i];
     }
 
     OutMin = CenterProj - Radius;
     OutMax = CenterProj + Radius;
 }
+
+int32 FOrientedBox::IntersectsMany(const FOrientedBox& Box, std::span<const FOrientedBox> Others, TArray<uint64>& OutMask)
+{
+    OutMask.SetNum((static_cast<int32>(Others.size()) + 63) / 64);
+    std::fill(OutMask.begin(), OutMask.end(), 0ull);
+
+    // 기준 박스의 축/전치는 한 번만 계산
+    const FSATBox A = MakeSATBox(Box);
+
+    int32 NumHits = 0;
+    for (size_t i = 0; i < Others.size(); ++i)
+    {
+        if (IntersectsSAT(A, MakeSATBox(Others[i])))
+        {
+            OutMask[i >> 6] |= 1ull << (i & 63);
+            ++NumHits;
+        }
+    }
+    return NumHits;
+}
+
+// ─────────────────────────────
+// FOrientedBoxBenchmark
+// - 고정 케이스(평행/동일 평면/점/선분)와 임의 쌍에서 세 경로의 결과를 교차 검증한 뒤 시간 측정
+// ─────────────────────────────
+namespace
+{
+    struct FOBBCheckCase
+    {
+        const char* Label;
+        FOrientedBox A;
+        FOrientedBox B;
+        bool bExpected;
+    };
+
+    // 두 박스를 스칼라/SSE/IntersectsMany 세 경로와 양방향으로 검사해 모두 같은 결과면 그 값을 반환
+    bool EvaluateAllPaths(const FOrientedBox& A, const FOrientedBox& B, bool& bOutConsistent)
+    {
+        TArray<uint64> Mask;
+        const bool bScalar = A.IntersectsScalar(B);
+        const bool bScalarSwapped = B.IntersectsScalar(A);
+        const bool bSIMD = A.Intersects(B);
+        const bool bSIMDSwapped = B.Intersects(A);
+        const bool bMany = FOrientedBox::IntersectsMany(A, std::span<const FOrientedBox>(&B, 1), Mask) == 1 && (Mask[0] & 1ull);
+
+        bOutConsistent = bScalar == bScalarSwapped && bScalar == bSIMD && bScalar == bSIMDSwapped && bScalar == bMany;
+        return bScalar;
+    }
+
+    FOrientedBox RandomBox(std::mt19937& Random, float CenterRange, float MinExtent, float MaxExtent)
+    {
+        std::uniform_real_distribution<float> Position(-CenterRange, CenterRange);
+        std::uniform_real_distribution<float> Extent(MinExtent, MaxExtent);
+        std::uniform_real_distribution<float> Angle(-PI, PI);
+        return FOrientedBox(
+            FVector(Position(Random), Position(Random), Position(Random)),
+            FVector(Extent(Random), Extent(Random), Extent(Random)),
+            FQuat::MakeFromEuler(FVector(Angle(Random), Angle(Random), Angle(Random))));
+    }
+}
+
+int32 FOrientedBoxBenchmark::RunConsistencyChecks(int32 NumRandomPairs)
+{
+    const FBenchmark Bench("OBB");
+
+    const FQuat Identity = FQuat::Identity();
+    const FQuat Tilted = FQuat::MakeFromEuler(FVector(0.3f, -0.7f, 1.1f));
+    const FQuat QuarterTurnZ = FQuat::MakeFromEuler(FVector(0.0f, 0.0f, PI * 0.5f));
+    const FQuat EighthTurnZ = FQuat::MakeFromEuler(FVector(0.0f, 0.0f, PI * 0.25f));
+    const FQuat NearlyIdentity = FQuat::MakeFromEuler(FVector(0.0f, 0.0f, 1e-4f));
+    const FQuat SegmentTilt = FQuat::MakeFromEuler(FVector(0.0f, PI / 6.0f, 0.0f));
+
+    const FVector Unit(1.0f, 1.0f, 1.0f);
+    const FVector Flat(1.0f, 1.0f, 0.0f);
+    const FVector Point(0.0f, 0.0f, 0.0f);
+    const FVector Segment(5.0f, 0.0f, 0.0f);
+    const FVector TiltedX = Tilted.RotateVector(FVector(1.0f, 0.0f, 0.0f));
+
+    // 외적 축이 0이 되는 평행 축, 한 축 크기가 0인 동일 평면 박스, 크기 0인 점/선분
+    const FOBBCheckCase Cases[] = {
+        { "identical",                FOrientedBox(FVector(), Unit, Tilted), FOrientedBox(FVector(), Unit, Tilted), true },
+        { "parallel separated",       FOrientedBox(FVector(), Unit, Identity), FOrientedBox(FVector(2.5f, 0.0f, 0.0f), Unit, Identity), false },
+        { "parallel touching",        FOrientedBox(FVector(), Unit, Identity), FOrientedBox(FVector(2.0f, 0.0f, 0.0f), Unit, Identity), true },
+        { "parallel tilted apart",    FOrientedBox(FVector(), Unit, Tilted), FOrientedBox(TiltedX * 2.5f, Unit, Tilted), false },
+        { "parallel tilted overlap",  FOrientedBox(FVector(), Unit, Tilted), FOrientedBox(TiltedX * 1.5f, Unit, Tilted), true },
+        { "quarter turn separated",   FOrientedBox(FVector(), Unit, Identity), FOrientedBox(FVector(0.0f, 2.5f, 0.0f), Unit, QuarterTurnZ), false },
+        { "quarter turn overlap",     FOrientedBox(FVector(), Unit, Identity), FOrientedBox(FVector(0.0f, 1.5f, 0.0f), Unit, QuarterTurnZ), true },
+        { "nearly parallel apart",    FOrientedBox(FVector(), Unit, Identity), FOrientedBox(FVector(2.5f, 0.0f, 0.0f), Unit, NearlyIdentity), false },
+        { "nearly parallel overlap",  FOrientedBox(FVector(), Unit, Identity), FOrientedBox(FVector(1.5f, 0.0f, 0.0f), Unit, NearlyIdentity), true },
+        { "coplanar overlap",         FOrientedBox(FVector(), Flat, Identity), FOrientedBox(FVector(1.5f, 0.5f, 0.0f), Flat, EighthTurnZ), true },
+        { "coplanar separated",       FOrientedBox(FVector(), Flat, Identity), FOrientedBox(FVector(2.0f + 1.5f, 0.0f, 0.0f), Flat, EighthTurnZ), false },
+        { "parallel planes",          FOrientedBox(FVector(), Flat, Identity), FOrientedBox(FVector(0.25f, 0.25f, 0.5f), Flat, Identity), false },
+        { "point inside",             FOrientedBox(FVector(), Unit, Tilted), FOrientedBox(FVector(0.2f, -0.3f, 0.1f), Point, Identity), true },
+        { "point outside",            FOrientedBox(FVector(), Unit, Identity), FOrientedBox(FVector(1.5f, 0.0f, 0.0f), Point, Identity), false },
+        { "point vs point",           FOrientedBox(FVector(1.0f, 2.0f, 3.0f), Point, Identity), FOrientedBox(FVector(1.0f, 2.0f, 3.0f), Point, Tilted), true },
+        { "segment crossing",         FOrientedBox(FVector(), Unit, Identity), FOrientedBox(FVector(), Segment, SegmentTilt), true },
+        { "segment beside edge",      FOrientedBox(FVector(), Unit, Identity), FOrientedBox(FVector(0.0f, 1.5f, 1.5f), Segment, Identity), false },
+    };
+
+    int32 NumFailures = 0;
+    for (const FOBBCheckCase& Case : Cases)
+    {
+        bool bConsistent = false;
+        const bool bResult = EvaluateAllPaths(Case.A, Case.B, bConsistent);
+        if (!bConsistent || bResult != Case.bExpected)
+        {
+            Bench.LogInfo("check FAILED %-24s expected %d scalar %d sse %d",
+                Case.Label, Case.bExpected, Case.A.IntersectsScalar(Case.B), Case.A.Intersects(Case.B));
+            ++NumFailures;
+        }
+    }
+
+    // 임의 박스 쌍: SSE 커널은 |R|에 ε를 더하고 스칼라는 거의 평행한 외적 축을 건너뛰므로
+    // 두 결과는 맞닿기 직전의 쌍에서만 달라질 수 있다. B를 ±0.1% 키우고 줄였을 때 두 경로가 모두
+    // 같은 결과로 돌아오면 경계 오차로 보고, 아니면 실패로 센다
+    std::mt19937 Random(12345);
+    int32 NumGrazing = 0;
+    for (int32 i = 0; i < NumRandomPairs; ++i)
+    {
+        const FOrientedBox A = RandomBox(Random, 4.0f, 0.0f, 2.0f);
+        const FOrientedBox B = RandomBox(Random, 4.0f, 0.0f, 2.0f);
+
+        bool bConsistent = false;
+        EvaluateAllPaths(A, B, bConsistent);
+        if (bConsistent)
+            continue;
+
+        const FOrientedBox Shrunk(B.Center, B.HalfExtents * 0.999f, B.Rotation);
+        const FOrientedBox Grown(B.Center, B.HalfExtents * 1.001f, B.Rotation);
+        bool bShrunkConsistent = false;
+        bool bGrownConsistent = false;
+        const bool bShrunk = EvaluateAllPaths(A, Shrunk, bShrunkConsistent);
+        const bool bGrown = EvaluateAllPaths(A, Grown, bGrownConsistent);
+        if (bShrunkConsistent && bGrownConsistent && !bShrunk && bGrown)
+        {
+            ++NumGrazing;
+            continue;
+        }
+
+        ++NumFailures;
+    }
+
+    Bench.LogInfo("check %d fixed cases, %d random pairs (%d grazing), %d failure(s)",
+        static_cast<int32>(std::size(Cases)), NumRandomPairs, NumGrazing, NumFailures);
+    return NumFailures;
+}
+
+void FOrientedBoxBenchmark::Run(int32 NumBoxes, int32 NumQueries)
+{
+    if (NumBoxes <= 0 || NumQueries <= 0)
+        return;
+
+    RunConsistencyChecks();
+
+    // 좁은 영역에 흩어 놓아 겹치는 쌍(모든 축 검사)과 조기 종료되는 쌍이 섞이도록 함
+    std::mt19937 Random(12345);
+    TArray<FOrientedBox> Boxes;
+    TArray<FOrientedBox> Queries;
+    Boxes.Reserve(NumBoxes);
+    Queries.Reserve(NumQueries);
+    for (int32 i = 0; i < NumBoxes; ++i)
+    {
+        Boxes.Add(RandomBox(Random, 6.0f, 0.5f, 4.0f));
+    }
+    for (int32 i = 0; i < NumQueries; ++i)
+    {
+        Queries.Add(RandomBox(Random, 6.0f, 0.5f, 4.0f));
+    }
+
+    TArray<uint64> Mask;
+    Mask.Reserve((NumBoxes + 63) / 64);
+
+    const int64 NumTests = static_cast<int64>(NumBoxes) * NumQueries;
+    const FBenchmark Bench("OBB");
+    Bench.LogInfo("%d boxes x %d queries = %lld tests", NumBoxes, NumQueries, NumTests);
+
+    auto Measure = [&Bench, NumTests](const char* Label, auto&& Body)
+    {
+        int64 NumHits = 0;
+        const double Ms = FBenchmark::MeasureMs([&]() { NumHits = Body(); });
+        Bench.LogResult(Label, Ms, "%7.2f ns/test  %6.2f%% hits",
+            Ms * 1000000.0 / NumTests, static_cast<double>(NumHits) * 100.0 / NumTests);
+    };
+
+    Measure("IntersectsScalar", [&]()
+    {
+        int64 Total = 0;
+        for (const FOrientedBox& Query : Queries)
+            for (const FOrientedBox& Box : Boxes)
+                Total += Query.IntersectsScalar(Box) ? 1 : 0;
+        return Total;
+    });
+    Measure("Intersects(SSE)", [&]()
+    {
+        int64 Total = 0;
+        for (const FOrientedBox& Query : Queries)
+            for (const FOrientedBox& Box : Boxes)
+                Total += Query.Intersects(Box) ? 1 : 0;
+        return Total;
+    });
+    Measure("IntersectsMany", [&]()
+    {
+        int64 Total = 0;
+        for (const FOrientedBox& Query : Queries)
+            Total += FOrientedBox::IntersectsMany(Query, Boxes, Mask);
+        return Total;
+    });
+}
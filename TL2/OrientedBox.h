@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <span>
 
  // FOrientedBox (Oriented Bounding Box)
  // - 회전 가능한 바운딩 박스
@@ -24,9 +25,15 @@ struct FOrientedBox
     // AABB로 변환 (보수적)
     FBound ToAABB() const;
 
-    // OBB vs OBB 충돌 검사 (SAT)
+    // OBB vs OBB 충돌 검사 (SAT, SSE로 3축씩 검사하며 분리 축을 찾으면 바로 종료)
     bool Intersects(const FOrientedBox& Other) const;
 
+    // 스칼라 SAT (15개 축을 하나씩 투영). SSE 커널 검증과 성능 비교용 기준 구현
+    bool IntersectsScalar(const FOrientedBox& Other) const;
+
+    // Box와 Others[i]가 겹치면 OutMask의 i번째 비트를 켠다 (64개씩 uint64 하나). 겹친 개수 반환
+    static int32 IntersectsMany(const FOrientedBox& Box, std::span<const FOrientedBox> Others, TArray<uint64>& OutMask);
+
 private:
     // 특정 축에 투영했을 때 겹치는지 검사
     bool OverlapOnAxis(const FVector& Axis, const FOrientedBox& Other) const;
@@ -34,3 +41,15 @@ private:
     // 축에 OBB 투영 시 최소/최대 값 계산
     void ProjectOntoAxis(const FVector& Axis, float& OutMin, float& OutMax) const;
 };
+
+/**
+ * FOrientedBoxBenchmark
+ * - 퇴화(크기 0)/동일 평면/평행 축 박스 쌍에서 스칼라 SAT, SSE 커널, IntersectsMany 결과를 비교 (콘솔 BENCH OBB)
+ * - 임의 박스 집합에 대해 세 경로의 검사 시간을 측정
+ */
+struct FOrientedBoxBenchmark
+{
+    // 기대값과 다르거나 경로끼리 어긋난 경우 수 반환 (0이면 통과)
+    static int32 RunConsistencyChecks(int32 NumRandomPairs = 100000);
+    static void Run(int32 NumBoxes = 10000, int32 NumQueries = 32);
+};
@@ -31,6 +31,11 @@
 #include "BillboardComponent.h"
 #include "DecalComponent.h"
 #include "HeightFogComponent.h"
+#include "TextRenderComponent.h"
+#include "Frustum.h"
+#include "TaskSystem.h"
+#include "IDBufferTile.h"
+#include "GizmoCollisionProxy.h"
 
 FRay MakeRayFromMouse(const FMatrix& InView,
                       const FMatrix& InProj)
@@ -288,6 +293,8 @@ bool IntersectRayBound(const FRay& InRay, const FBound& InBound, float* OutT)
     return true;
 }
 
+static bool IntersectTriangleBVHNode(const FRay& LocalRay, FNarrowPhaseBVHNode* Node, const FStaticMesh* MeshAsset, float& OutClosestHitDistance);
+
 /**
   * @brief 메시의 BVH(Bounding Volume Hierarchy)를 재귀적으로 순회하며, 주어진 광선과 가장 가까운 삼각형의 교차점을 찾는 헬퍼 함수
    *        '분할 정복' 전략을 사용하여 불필요한 삼각형 검사를 건너뛰어 성능을 크게 향상시킨다.
@@ -311,9 +318,15 @@ bool IntersectTriangleBVH(const FRay& LocalRay, FNarrowPhaseBVHNode* Node, const
     {
         return false;
     }
+    return IntersectTriangleBVHNode(LocalRay, Node, MeshAsset, OutClosestHitDistance);
+}
+
+// 바운드 검사를 이미 통과한 노드를 탐색 (자식은 광선이 먼저 닿는 쪽부터)
+static bool IntersectTriangleBVHNode(const FRay& LocalRay, FNarrowPhaseBVHNode* Node, const FStaticMesh* MeshAsset, float& OutClosestHitDistance)
+{
     // 현재 노드 or 자식 노드에서 충돌이 발생했는지 추적위한 플래그
     bool bHit = false;
-    
+
     // mesh BVH의 리프 노드에 도달했는지 확인
     if (Node->IsLeaf())
     {
@@ -324,12 +337,11 @@ bool IntersectTriangleBVH(const FRay& LocalRay, FNarrowPhaseBVHNode* Node, const
             const uint32 i0 = MeshAsset->Indices[Primitive.TriangleIndex * 3 + 0];
             const uint32 i1 = MeshAsset->Indices[Primitive.TriangleIndex * 3 + 1];
             const uint32 i2 = MeshAsset->Indices[Primitive.TriangleIndex * 3 + 2];
-    
+
             const FVector& v0 = MeshAsset->Vertices[i0].pos;
             const FVector& v1 = MeshAsset->Vertices[i1].pos;
             const FVector& v2 = MeshAsset->Vertices[i2].pos;
-    
-            
+
             // 가져온 정점으로 묄러트럼보어 실행 -> 실제 광선과 삼각형의 교차 검사
             float triangleHitDist;
             if (IntersectRayTriangleMT(LocalRay, v0, v1, v2, triangleHitDist))
@@ -343,21 +355,33 @@ bool IntersectTriangleBVH(const FRay& LocalRay, FNarrowPhaseBVHNode* Node, const
         }
         return bHit;
     }
-    
-    // 리프노드가 아닌 경우 재귀
-    if (IntersectTriangleBVH(LocalRay, Node->Left, MeshAsset, OutClosestHitDistance))
+
+    // 리프노드가 아닌 경우: 두 자식의 진입 거리를 구해 가까운 쪽부터 재귀
+    // 가까운 쪽에서 찾은 삼각형 거리보다 먼 쪽 자식의 진입 거리가 크면 먼 쪽은 아예 열지 않음
+    FNarrowPhaseBVHNode* Children[2] = { Node->Left, Node->Right };
+    float ChildDist[2] = { FLT_MAX, FLT_MAX };
+    for (int32 i = 0; i < 2; ++i)
+    {
+        float Dist;
+        if (Children[i] && Children[i]->Bounds.RayIntersects(LocalRay.Origin, LocalRay.Direction, Dist))
+        {
+            ChildDist[i] = Dist;
+        }
+    }
+
+    const int32 Near = ChildDist[1] < ChildDist[0] ? 1 : 0;
+    const int32 Far = 1 - Near;
+
+    if (ChildDist[Near] < OutClosestHitDistance && IntersectTriangleBVHNode(LocalRay, Children[Near], MeshAsset, OutClosestHitDistance))
     {
-        // 왼쪽 자식 노드에서 충돌 발생했다면 플래그 설정
-        // 더 가까운 삼각형을 찾아 OutClosestHitDistance가 갱신되었다면, 오른쪽 노드 탐색은 더 엄격한 거리 조건으로 탐색하게됨 -> 효율 상승
         bHit = true;
-    } 
-    if (IntersectTriangleBVH(LocalRay, Node->Right, MeshAsset, OutClosestHitDistance))
+    }
+    if (ChildDist[Far] < OutClosestHitDistance && IntersectTriangleBVHNode(LocalRay, Children[Far], MeshAsset, OutClosestHitDistance))
     {
         bHit = true;
     }
-    
+
     return bHit;
-    
 }
 
 AActor* CPickingSystem::PerformViewportPicking(const TArray<AActor*>& Actors,
@@ -426,6 +450,78 @@ AActor* CPickingSystem::PerformViewportPicking(const TArray<AActor*>& Actors,
     return finalHitActor;
 }
 
+// 현재 기즈모 모드의 X/Y/Z 핸들 (해당 모드가 없으면 모두 nullptr)
+static void GetGizmoAxisHandles(AGizmoActor* GizmoActor, UStaticMeshComponent* OutHandles[3])
+{
+    switch (GizmoActor->GetMode())
+    {
+    case EGizmoMode::Translate:
+        OutHandles[0] = GizmoActor->GetArrowX();
+        OutHandles[1] = GizmoActor->GetArrowY();
+        OutHandles[2] = GizmoActor->GetArrowZ();
+        break;
+    case EGizmoMode::Scale:
+        OutHandles[0] = GizmoActor->GetScaleX();
+        OutHandles[1] = GizmoActor->GetScaleY();
+        OutHandles[2] = GizmoActor->GetScaleZ();
+        break;
+    case EGizmoMode::Rotate:
+        OutHandles[0] = GizmoActor->GetRotateX();
+        OutHandles[1] = GizmoActor->GetRotateY();
+        OutHandles[2] = GizmoActor->GetRotateZ();
+        break;
+    default:
+        OutHandles[0] = OutHandles[1] = OutHandles[2] = nullptr;
+        break;
+    }
+}
+
+// 기즈모 축 그룹(X/Y/Z 핸들) 검사: 월드 레이를 핸들마다 로컬 공간으로 옮겨 레이 묶음의 레인에 넣고,
+// 같은 충돌 프록시를 쓰는 핸들끼리는 프록시 BVH를 한 번만 순회 (반환: 1~3 축, 없으면 0)
+static uint32 PickGizmoAxisGroup(UStaticMeshComponent* const Handles[3], const FRay& Ray, float& InOutClosestDistance)
+{
+    const FGizmoCollisionProxy* Proxies[3] = {};
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        UStaticMesh* Mesh = Handles[Axis] ? Handles[Axis]->GetStaticMesh() : nullptr;
+        Proxies[Axis] = Mesh ? FGizmoCollisionProxy::FindOrBake(Mesh->GetFilePath()) : nullptr;
+    }
+
+    uint32 ClosestAxis = 0;
+    bool bTested[3] = {};
+    for (int32 First = 0; First < 3; ++First)
+    {
+        if (bTested[First] || !Proxies[First]) continue;
+
+        FGizmoRayPacket Packet;
+        for (int32 Axis = First; Axis < 3; ++Axis)
+        {
+            if (Proxies[Axis] != Proxies[First]) continue;
+
+            // 로컬 방향은 정규화하지 않음 → 로컬 t가 그대로 월드 거리
+            const FMatrix InvWorld = Handles[Axis]->GetWorldMatrix().InverseAffine();
+            const FVector4 LocalOrigin = FVector4(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z, 1.0f) * InvWorld;
+            const FVector4 LocalDirection = FVector4(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z, 0.0f) * InvWorld;
+            Packet.SetLane(Axis, FVector(LocalOrigin.X, LocalOrigin.Y, LocalOrigin.Z),
+                FVector(LocalDirection.X, LocalDirection.Y, LocalDirection.Z), InOutClosestDistance);
+            bTested[Axis] = true;
+        }
+
+        float HitT[FGizmoRayPacket::Lanes];
+        if (!Proxies[First]->IntersectPacket(Packet, HitT)) continue;
+
+        for (int32 Axis = First; Axis < 3; ++Axis)
+        {
+            if (Proxies[Axis] == Proxies[First] && HitT[Axis] < InOutClosestDistance)
+            {
+                InOutClosestDistance = HitT[Axis];
+                ClosestAxis = static_cast<uint32>(Axis + 1);
+            }
+        }
+    }
+    return ClosestAxis;
+}
+
 uint32 CPickingSystem::IsHoveringGizmo(AGizmoActor* GizmoTransActor, const ACameraActor* Camera)
 {
     if (!GizmoTransActor || !Camera)
@@ -451,137 +547,70 @@ uint32 CPickingSystem::IsHoveringGizmo(AGizmoActor* GizmoTransActor, const ACame
 
     uint32 ClosestAxis = 0;
     float ClosestDistance = 1e9f;
-    float HitDistance;
-
-    // X축 화살표 검사
-    //Cast<UStaticMeshComponent>(GizmoTransActor->GetArrowX());
 
-    switch (GizmoTransActor->GetMode())
-    {
-        case EGizmoMode::Translate:
-            if (UStaticMeshComponent* ArrowX = Cast<UStaticMeshComponent>(GizmoTransActor->GetArrowX()))
-            {
-                if (CheckGizmoComponentPicking(ArrowX, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 1;
-                    }
-                }
-            }
+    // 모드별 축 그룹(X/Y/Z 핸들)을 한 번의 레이 묶음으로 검사
+    UStaticMeshComponent* Handles[3] = {};
+    GetGizmoAxisHandles(GizmoTransActor, Handles);
+    ClosestAxis = PickGizmoAxisGroup(Handles, Ray, ClosestDistance);
 
-            // Y축 화살표 검사
-            if (UStaticMeshComponent* ArrowY = Cast<UStaticMeshComponent>(GizmoTransActor->GetArrowY()))
-            {
-                if (CheckGizmoComponentPicking(ArrowY, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 2;
-                    }
-                }
-            }
 
-            // Z축 화살표 검사
-            if (UStaticMeshComponent* ArrowZ = Cast<UStaticMeshComponent>(GizmoTransActor->GetArrowZ()))
-            {
-                if (CheckGizmoComponentPicking(ArrowZ, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 3;
-                    }
-                }
-            }
-            break;
-        case EGizmoMode::Scale:
-            if (UStaticMeshComponent* ScaleX = Cast<UStaticMeshComponent>(GizmoTransActor->GetScaleX()))
-            {
-                if (CheckGizmoComponentPicking(ScaleX, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 1;
-                    }
-                }
-            }
 
-            // Y축 화살표 검사
-            if (UStaticMeshComponent* ScaleY = Cast<UStaticMeshComponent>(GizmoTransActor->GetScaleY()))
-            {
-                if (CheckGizmoComponentPicking(ScaleY, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 2;
-                    }
-                }
-            }
+    return ClosestAxis;
+}
 
-            // Z축 화살표 검사
-            if (UStaticMeshComponent* ScaleZ = Cast<UStaticMeshComponent>(GizmoTransActor->GetScaleZ()))
-            {
-                if (CheckGizmoComponentPicking(ScaleZ, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 3;
-                    }
-                }
-            }
-            break;
-        case EGizmoMode::Rotate:
-            if (UStaticMeshComponent* RotateX = Cast<UStaticMeshComponent>(GizmoTransActor->GetRotateX()))
-            {
-                if (CheckGizmoComponentPicking(RotateX, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 1;
-                    }
-                }
-            }
+TPickingCache<uint32> CPickingSystem::GizmoHoverCache;
+TPickingCache<USceneComponent*> CPickingSystem::ScenePickCache;
+bool CPickingSystem::bIDBufferPickingEnabled = false;
 
-            // Y축 화살표 검사
-            if (UStaticMeshComponent* RotateY = Cast<UStaticMeshComponent>(GizmoTransActor->GetRotateY()))
-            {
-                if (CheckGizmoComponentPicking(RotateY, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 2;
-                    }
-                }
-            }
+namespace
+{
+    // 커서 주변 ID 타일 (마지막으로 래스터화한 뷰포트 하나만 유지)
+    FIDBufferTile IDBufferTile;
+    FPickingCacheKey IDBufferTileKey;           // MousePos = 타일 좌상단 (뷰포트 로컬 픽셀)
+    FMatrix IDBufferInvTileViewProj;
+    TArray<USceneComponent*> IDBufferComponents;   // ID - 1 → 컴포넌트
+    bool bIDBufferTileValid = false;
+}
 
-            // Z축 화살표 검사
-            if (UStaticMeshComponent* RotateZ = Cast<UStaticMeshComponent>(GizmoTransActor->GetRotateZ()))
-            {
-                if (CheckGizmoComponentPicking(RotateZ, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 3;
-                    }
-                }
-            }
-            break;
-    default:
-        break;
-    }
+// 뷰포트 로컬 픽셀 사각형이 클립 공간 [-1, 1]을 채우도록 x/y를 다시 매핑한 ViewProj
+// x' = Sx * x + Tx * w (row-vector 규약이므로 스케일은 대각, 오프셋은 4행)
+static FMatrix MakeScreenRectViewProj(const FMatrix& ViewProj, float MinX, float MinY, float MaxX, float MaxY, const FVector2D& ViewportSize)
+{
+    const float NdcLeft = (2.0f * MinX / ViewportSize.X) - 1.0f;
+    const float NdcRight = (2.0f * MaxX / ViewportSize.X) - 1.0f;
+    const float NdcTop = 1.0f - (2.0f * MinY / ViewportSize.Y);
+    const float NdcBottom = 1.0f - (2.0f * MaxY / ViewportSize.Y);
+
+    const FMatrix RectRemap(
+        2.0f / (NdcRight - NdcLeft), 0.0f, 0.0f, 0.0f,
+        0.0f, 2.0f / (NdcTop - NdcBottom), 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        -(NdcRight + NdcLeft) / (NdcRight - NdcLeft), -(NdcTop + NdcBottom) / (NdcTop - NdcBottom), 0.0f, 1.0f);
+    return ViewProj * RectRemap;
+}
 
+FPickingCacheKey CPickingSystem::MakePickingCacheKey(FViewport* Viewport, const ACameraActor* Camera, const FMatrix& Proj,
+    const FVector2D& ViewportMousePos, const FVector2D& ViewportSize)
+{
+    FPickingCacheKey Key;
+    Key.Viewport = Viewport;
+    Key.Camera = Camera;
+    Key.CameraVersion = Camera ? Camera->GetTransformVersion() : 0;
+    Key.Projection = Proj;
+    Key.MousePos = ViewportMousePos;
+    Key.ViewportSize = ViewportSize;
+    return Key;
+}
 
+void CPickingSystem::InvalidatePickingCache()
+{
+    GizmoHoverCache.Invalidate();
+    ScenePickCache.Invalidate();
 
-    return ClosestAxis;
+    // ID 타일이 가리키는 컴포넌트도 해제되었을 수 있음
+    bIDBufferTileValid = false;
+    IDBufferTileKey = FPickingCacheKey();
+    IDBufferComponents.clear();
 }
 
 uint32 CPickingSystem::IsHoveringGizmoForViewport(AGizmoActor* GizmoTransActor, const ACameraActor* Camera,
@@ -593,9 +622,26 @@ uint32 CPickingSystem::IsHoveringGizmoForViewport(AGizmoActor* GizmoTransActor,
         return 0;
     float ViewportAspectRatio = ViewportSize.X / ViewportSize.Y;
     if (ViewportSize.Y == 0) ViewportAspectRatio = 1.0f; // 0으로 나누기 방지
+    const FMatrix Proj = Camera->GetProjectionMatrix(ViewportAspectRatio, Viewport);
+
+    // 마우스/카메라/기즈모 대상이 그대로면 이전 판정 재사용 (유휴 프레임에는 레이 생성/메시 검사 없음)
+    // 기즈모 트랜스폼 자체는 대상 액터 위치/회전과 뷰포트별 화면 고정 스케일로 정해지므로 대상 버전으로 대신함
+    FPickingCacheKey CacheKey = MakePickingCacheKey(Viewport, Camera, Proj, ViewportMousePos, ViewportSize);
+    const AActor* GizmoTarget = GizmoTransActor->GetTargetActor();
+    CacheKey.Target = GizmoTarget;
+    CacheKey.TargetVersion = GizmoTarget ? GizmoTarget->GetTransformVersion() : 0;
+    CacheKey.Mode = (static_cast<uint32>(GizmoTransActor->GetMode()) << 8) | static_cast<uint32>(GizmoTransActor->GetSpace());
+
+    uint32 CachedAxis = 0;
+    const bool bCacheHit = GizmoHoverCache.Find(CacheKey, CachedAxis);
+    URenderingStatsCollector::GetInstance().AddPickingCacheLookup(bCacheHit);
+    if (bCacheHit)
+    {
+        return CachedAxis;
+    }
+
     // 뷰포트별 레이 생성 - 전달받은 뷰포트 정보 사용
     const FMatrix View = Camera->GetViewMatrix();
-    const FMatrix Proj = Camera->GetProjectionMatrix(ViewportAspectRatio, Viewport);
     const FVector CameraWorldPos = Camera->GetActorLocation();
     const FVector CameraRight = Camera->GetRight();
     const FVector CameraUp = Camera->GetUp();
@@ -618,134 +664,13 @@ uint32 CPickingSystem::IsHoveringGizmoForViewport(AGizmoActor* GizmoTransActor,
     //UE_LOG(debugBuf);
     uint32 ClosestAxis = 0;
     float ClosestDistance = 1e9f;
-    float HitDistance;
-
-    // X축 화살표 검사
-    //Cast<UStaticMeshComponent>(GizmoTransActor->GetArrowX());
-
-    switch (GizmoTransActor->GetMode())
-    {
-        case EGizmoMode::Translate:
-            if (UStaticMeshComponent* ArrowX = Cast<UStaticMeshComponent>(GizmoTransActor->GetArrowX()))
-            {
-                if (CheckGizmoComponentPicking(ArrowX, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 1;
-                    }
-                }
-            }
-
-            // Y축 화살표 검사
-            if (UStaticMeshComponent* ArrowY = Cast<UStaticMeshComponent>(GizmoTransActor->GetArrowY()))
-            {
-                if (CheckGizmoComponentPicking(ArrowY, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 2;
-                    }
-                }
-            }
-
-            // Z축 화살표 검사
-            if (UStaticMeshComponent* ArrowZ = Cast<UStaticMeshComponent>(GizmoTransActor->GetArrowZ()))
-            {
-                if (CheckGizmoComponentPicking(ArrowZ, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 3;
-                    }
-                }
-            }
-            break;
-        case EGizmoMode::Scale:
-            if (UStaticMeshComponent* ScaleX = Cast<UStaticMeshComponent>(GizmoTransActor->GetScaleX()))
-            {
-                if (CheckGizmoComponentPicking(ScaleX, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 1;
-                    }
-                }
-            }
-
-            // Y축 화살표 검사
-            if (UStaticMeshComponent* ScaleY = Cast<UStaticMeshComponent>(GizmoTransActor->GetScaleY()))
-            {
-                if (CheckGizmoComponentPicking(ScaleY, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 2;
-                    }
-                }
-            }
-
-            // Z축 화살표 검사
-            if (UStaticMeshComponent* ScaleZ = Cast<UStaticMeshComponent>(GizmoTransActor->GetScaleZ()))
-            {
-                if (CheckGizmoComponentPicking(ScaleZ, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 3;
-                    }
-                }
-            }
-            break;
-        case EGizmoMode::Rotate:
-            if (UStaticMeshComponent* RotateX = Cast<UStaticMeshComponent>(GizmoTransActor->GetRotateX()))
-            {
-                if (CheckGizmoComponentPicking(RotateX, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 1;
-                    }
-                }
-            }
-
-            // Y축 화살표 검사
-            if (UStaticMeshComponent* RotateY = Cast<UStaticMeshComponent>(GizmoTransActor->GetRotateY()))
-            {
-                if (CheckGizmoComponentPicking(RotateY, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 2;
-                    }
-                }
-            }
 
-            // Z축 화살표 검사
-            if (UStaticMeshComponent* RotateZ = Cast<UStaticMeshComponent>(GizmoTransActor->GetRotateZ()))
-            {
-                if (CheckGizmoComponentPicking(RotateZ, Ray, HitDistance))
-                {
-                    if (HitDistance < ClosestDistance)
-                    {
-                        ClosestDistance = HitDistance;
-                        ClosestAxis = 3;
-                    }
-                }
-            }
-            break;
-    default:
-        break;
-    }
+    // 모드별 축 그룹(X/Y/Z 핸들)을 한 번의 레이 묶음으로 검사
+    UStaticMeshComponent* Handles[3] = {};
+    GetGizmoAxisHandles(GizmoTransActor, Handles);
+    ClosestAxis = PickGizmoAxisGroup(Handles, Ray, ClosestDistance);
 
+    GizmoHoverCache.Store(CacheKey, ClosestAxis);
     return ClosestAxis;
 }
 
@@ -764,91 +689,24 @@ void CPickingSystem::DragActorWithGizmo(AActor* Actor, AGizmoActor*  GizmoActor,
 
 bool CPickingSystem::CheckGizmoComponentPicking(const UStaticMeshComponent* Component, const FRay& Ray, float& OutDistance)
 {
-    if (!Component) return false;
-
-    // Gizmo 메시는 FStaticMesh(쿠킹된 데이터)를 사용
-    FStaticMesh* StaticMesh = FObjManager::LoadObjStaticMeshAsset(
-        Component->GetStaticMesh()->GetFilePath()
-    );
-    if (!StaticMesh) return false;
+    if (!Component || !Component->GetStaticMesh()) return false;
 
-    // 피킹 계산에는 컴포넌트의 월드 변환 행렬 사용
-    FMatrix WorldMatrix = Component->GetWorldMatrix();
-
-    auto TransformPoint = [&](float X, float Y, float Z) -> FVector
-        {
-            // row-vector (v^T) * M 방식으로 월드 변환 (translation 반영)
-            FVector4 V4(X, Y, Z, 1.0f);
-            FVector4 OutV4;
-            OutV4.X = V4.X * WorldMatrix.M[0][0] + V4.Y * WorldMatrix.M[1][0] + V4.Z * WorldMatrix.M[2][0] + V4.W * WorldMatrix.M[3][0];
-            OutV4.Y = V4.X * WorldMatrix.M[0][1] + V4.Y * WorldMatrix.M[1][1] + V4.Z * WorldMatrix.M[2][1] + V4.W * WorldMatrix.M[3][1];
-            OutV4.Z = V4.X * WorldMatrix.M[0][2] + V4.Y * WorldMatrix.M[1][2] + V4.Z * WorldMatrix.M[2][2] + V4.W * WorldMatrix.M[3][2];
-            OutV4.W = V4.X * WorldMatrix.M[0][3] + V4.Y * WorldMatrix.M[1][3] + V4.Z * WorldMatrix.M[2][3] + V4.W * WorldMatrix.M[3][3];
-            return FVector(OutV4.X, OutV4.Y, OutV4.Z);
-        };
-
-    float ClosestT = 1e9f;
-    bool bHasHit = false;
-
-    // 인덱스가 있는 경우: 인덱스 삼각형 집합 검사
-    if (StaticMesh->Indices.Num() >= 3)
-    {
-        uint32 IndexNum = StaticMesh->Indices.Num();
-        for (uint32 Idx = 0; Idx + 2 < IndexNum; Idx += 3)
-        {
-            const FNormalVertex& V0N = StaticMesh->Vertices[StaticMesh->Indices[Idx + 0]];
-            const FNormalVertex& V1N = StaticMesh->Vertices[StaticMesh->Indices[Idx + 1]];
-            const FNormalVertex& V2N = StaticMesh->Vertices[StaticMesh->Indices[Idx + 2]];
-
-            FVector A = TransformPoint(V0N.pos.X, V0N.pos.Y, V0N.pos.Z);
-            FVector B = TransformPoint(V1N.pos.X, V1N.pos.Y, V1N.pos.Z);
-            FVector C = TransformPoint(V2N.pos.X, V2N.pos.Y, V2N.pos.Z);
-
-            float THit;
-            if (IntersectRayTriangleMT(Ray, A, B, C, THit))
-            {
-                if (THit < ClosestT)
-                {
-                    ClosestT = THit;
-                    bHasHit = true;
-                }
-            }
-        }
-    }
-    // 인덱스가 없는 경우: 정점 배열을 순차적 삼각형으로 간주
-    else if (StaticMesh->Vertices.Num() >= 3)
-    {
-        uint32 VertexNum = StaticMesh->Vertices.Num();
-        for (uint32 Idx = 0; Idx + 2 < VertexNum; Idx += 3)
-        {
-            const FNormalVertex& V0N = StaticMesh->Vertices[Idx + 0];
-            const FNormalVertex& V1N = StaticMesh->Vertices[Idx + 1];
-            const FNormalVertex& V2N = StaticMesh->Vertices[Idx + 2];
+    // 핸들 메시를 한 번 구운 충돌 프록시로 검사 (레인 하나만 사용)
+    const FGizmoCollisionProxy* Proxy = FGizmoCollisionProxy::FindOrBake(Component->GetStaticMesh()->GetFilePath());
+    if (!Proxy) return false;
 
-            FVector A = TransformPoint(V0N.pos.X, V0N.pos.Y, V0N.pos.Z);
-            FVector B = TransformPoint(V1N.pos.X, V1N.pos.Y, V1N.pos.Z);
-            FVector C = TransformPoint(V2N.pos.X, V2N.pos.Y, V2N.pos.Z);
+    const FMatrix InvWorld = Component->GetWorldMatrix().InverseAffine();
+    const FVector4 LocalOrigin = FVector4(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z, 1.0f) * InvWorld;
+    const FVector4 LocalDirection = FVector4(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z, 0.0f) * InvWorld;
 
-            float THit;
-            if (IntersectRayTriangleMT(Ray, A, B, C, THit))
-            {
-                if (THit < ClosestT)
-                {
-                    ClosestT = THit;
-                    bHasHit = true;
-                }
-            }
-        }
-    }
+    FGizmoRayPacket Packet;
+    Packet.SetLane(0, FVector(LocalOrigin.X, LocalOrigin.Y, LocalOrigin.Z), FVector(LocalDirection.X, LocalDirection.Y, LocalDirection.Z));
 
-    // 가장 가까운 교차가 있으면 거리 반환
-    if (bHasHit)
-    {
-        OutDistance = ClosestT;
-        return true;
-    }
+    float HitT[FGizmoRayPacket::Lanes];
+    if (!Proxy->IntersectPacket(Packet, HitT)) return false;
 
-    return false;
+    OutDistance = HitT[0];
+    return true;
 }
 
 bool CPickingSystem::CheckActorPicking(AActor* Actor, USceneComponent*& OutComponent, const FRay& Ray, float& OutDistance)
@@ -913,7 +771,38 @@ bool CPickingSystem::CheckActorPicking(AActor* Actor, USceneComponent*& OutCompo
         }
     }
 
-    // 2. BillboardComponent 검사
+    // 2. 메시가 아닌 컴포넌트(빌보드/텍스트/데칼/포그) 검사
+    float ProxyDistance;
+    USceneComponent* ProxyComponent = nullptr;
+    if (CheckActorProxyPicking(Actor, ProxyComponent, Ray, ProxyDistance) && ProxyDistance < ClosestDistance)
+    {
+        ClosestDistance = ProxyDistance;
+        ClosestComponent = ProxyComponent;
+        bHit = true;
+    }
+
+    // 가장 가까운 컴포넌트 반환
+    if (bHit)
+    {
+        OutDistance = ClosestDistance;
+        OutComponent = ClosestComponent;
+        return true;
+    }
+
+    OutDistance = -1;
+    return false;
+}
+
+
+bool CPickingSystem::CheckActorProxyPicking(AActor* Actor, USceneComponent*& OutComponent, const FRay& Ray, float& OutDistance)
+{
+    if (!Actor) return false;
+
+    float ClosestDistance = FLT_MAX;
+    USceneComponent* ClosestComponent = nullptr;
+    bool bHit = false;
+
+    // 1. BillboardComponent 검사
     const TSet<UBillboardComponent*> BillboardComponents = Actor->GetComponents<UBillboardComponent>();
     for (UBillboardComponent* BillboardComponent : BillboardComponents)
     {
@@ -929,6 +818,22 @@ bool CPickingSystem::CheckActorPicking(AActor* Actor, USceneComponent*& OutCompo
         }
     }
 
+    // 2. TextRenderComponent 검사
+    const TSet<UTextRenderComponent*> TextComponents = Actor->GetComponents<UTextRenderComponent>();
+    for (UTextRenderComponent* TextComponent : TextComponents)
+    {
+        float HitDistance;
+        if (CheckTextComponentPicking(TextComponent, Ray, HitDistance))
+        {
+            if (HitDistance < ClosestDistance)
+            {
+                ClosestDistance = HitDistance;
+                ClosestComponent = TextComponent;
+                bHit = true;
+            }
+        }
+    }
+
     // 3. DecalComponent 검사
     const TSet<UDecalComponent*> DecalComponents = Actor->GetComponents<UDecalComponent>();
     for (UDecalComponent* DecalComponent : DecalComponents)
@@ -961,7 +866,6 @@ bool CPickingSystem::CheckActorPicking(AActor* Actor, USceneComponent*& OutCompo
         }
     }
 
-    // 가장 가까운 컴포넌트 반환
     if (bHit)
     {
         OutDistance = ClosestDistance;
@@ -973,6 +877,20 @@ bool CPickingSystem::CheckActorPicking(AActor* Actor, USceneComponent*& OutCompo
     return false;
 }
 
+bool CPickingSystem::HasProxyPickComponents(AActor* Actor)
+{
+    if (!Actor) return false;
+
+    for (UActorComponent* Component : Actor->GetComponents())
+    {
+        if (Cast<UBillboardComponent>(Component) || Cast<UTextRenderComponent>(Component) ||
+            Cast<UDecalComponent>(Component) || Cast<UHeightFogComponent>(Component))
+        {
+            return true;
+        }
+    }
+    return false;
+}
 
 float CPickingSystem::GetAdaptiveThreshold(float cameraDistance)
 {
@@ -984,6 +902,37 @@ float CPickingSystem::GetAdaptiveThreshold(float cameraDistance)
     return 10.0f;  // 10m (매우 먼 거리)
 }
 
+// TLAS/ID 타일에 들어가지 않는 컴포넌트를 프록시 도형으로 검사해 더 가까우면 결과를 교체
+// - 메시가 없는 액터: 모든 컴포넌트 / 메시가 있는 액터: 메시가 아닌 컴포넌트만
+static void PickProxyComponents(const FBVH& BVH, const FRay& Ray, USceneComponent*& InOutComponent, float& InOutDistance)
+{
+    for (AActor* Actor : BVH.GetUnboundedActors())
+    {
+        if (!Actor || Actor->GetActorHiddenInGame()) continue;
+
+        float HitDistance;
+        USceneComponent* HitComponent = nullptr;
+        if (CPickingSystem::CheckActorPicking(Actor, HitComponent, Ray, HitDistance) && HitDistance < InOutDistance)
+        {
+            InOutDistance = HitDistance;
+            InOutComponent = HitComponent;
+        }
+    }
+
+    for (AActor* Actor : BVH.GetProxyPickActors())
+    {
+        if (!Actor || Actor->GetActorHiddenInGame()) continue;
+
+        float HitDistance;
+        USceneComponent* HitComponent = nullptr;
+        if (CPickingSystem::CheckActorProxyPicking(Actor, HitComponent, Ray, HitDistance) && HitDistance < InOutDistance)
+        {
+            InOutDistance = HitDistance;
+            InOutComponent = HitComponent;
+        }
+    }
+}
+
 USceneComponent* CPickingSystem::PerformGlobalBVHPicking(const TArray<AActor*>& Actors,
     ACameraActor* Camera,
     const FVector2D& ViewportMousePos,
@@ -996,8 +945,22 @@ USceneComponent* CPickingSystem::PerformGlobalBVHPicking(const TArray<AActor*>&
 
     if (!Camera) return nullptr;
 
-    const FMatrix View = Camera->GetViewMatrix();
     const FMatrix Proj = Camera->GetProjectionMatrix(ViewportAspectRatio, Viewport);
+
+    // 같은 픽셀/카메라/씬 버전이면 이전 결과 재사용 (액터 추가·삭제·숨김·이동은 씬 버전을 올림)
+    FPickingCacheKey CacheKey = MakePickingCacheKey(Viewport, Camera, Proj, ViewportMousePos, ViewportSize);
+    CacheKey.Target = GWorld;
+    CacheKey.TargetVersion = GWorld ? GWorld->GetSceneVersion() : 0;
+
+    USceneComponent* CachedComponent = nullptr;
+    const bool bCacheHit = ScenePickCache.Find(CacheKey, CachedComponent);
+    URenderingStatsCollector::GetInstance().AddPickingCacheLookup(bCacheHit);
+    if (bCacheHit)
+    {
+        return CachedComponent;
+    }
+
+    const FMatrix View = Camera->GetViewMatrix();
     const FVector CameraWorldPos = Camera->GetActorLocation();
     const FVector CameraRight = Camera->GetRight();
     const FVector CameraUp = Camera->GetUp();
@@ -1007,58 +970,53 @@ USceneComponent* CPickingSystem::PerformGlobalBVHPicking(const TArray<AActor*>&
         ViewportMousePos, ViewportSize, ViewportOffset);
 
     float closestDistance = FLT_MAX;
+    USceneComponent* SelectedComponent = nullptr;
 
-    // 적응형 임계값 계산
-    float cameraDistanceEstimate = (CameraWorldPos - FVector(0, 0, 0)).Size();
-    float adaptiveThreshold = GetAdaptiveThreshold(cameraDistanceEstimate);
-
-    // Global BVH 우선 사용
     FBVH* BVH = GWorld ? GWorld->GetBVH() : nullptr;
-    if (BVH)
+    if (BVH && bIDBufferPickingEnabled)
     {
-        //float hitDistance;
-        //AActor* HitActor = BVH->Intersect(ray.Origin, ray.Direction, hitDistance);
-
-        //if (HitActor && !HitActor->GetActorHiddenInGame())
-        //{
-        //    uint64_t GlobalBVHCycleDiff = GlobalBVHPickingTimer.Finish();
-        //    double GlobalBVHPickingTimeMs = FPlatformTime::ToMilliseconds(GlobalBVHCycleDiff);
-        //    URenderingStatsCollector::GetInstance().UpdatePickingStats(GlobalBVHPickingTimeMs);
-        //    char buf[256];
-        //    sprintf_s(buf, "[Global BVH Pick] Hit actor at distance %.3f (Time: %.3fms)\n", hitDistance, GlobalBVHPickingTimeMs);
-        //    UE_LOG(buf);
-        //    return HitActor;
-        //}
+        // 커서 주변 ID 타일에서 픽셀 조회 (메시 없는 액터 검사 포함)
+        SelectedComponent = PerformIDBufferPicking(Camera, ViewportMousePos, ViewportSize, ViewportOffset, ViewportAspectRatio, Viewport, &closestDistance);
     }
-
-    USceneComponent* SelectedComponent = nullptr;
-    // BVH 실패 시 브루트 포스 백업
-    for (int i = 0; i < Actors.Num(); ++i)
+    else if (BVH)
     {
-        AActor* Actor = Actors[i];
-        if (!Actor || Actor->GetActorHiddenInGame()) continue;
+        // 마지막 프레임 이후 움직인 액터의 바운드/역행렬을 먼저 반영
+        GWorld->FlushBVHUpdates();
 
-        float hitDistance;
-        USceneComponent* OutHitComponent = nullptr;
-        if (CheckActorPicking(Actor, OutHitComponent, ray, hitDistance) && hitDistance < closestDistance)
+        // 1. TLAS(컴포넌트 바운드) → BLAS(메시 삼각형 BVH): 가까운 노드부터, 첫 정확한 히트 이후는 가지치기
+        SelectedComponent = BVH->IntersectComponents(ray, closestDistance);
+
+        // 2. TLAS에 없는 컴포넌트(빌보드/텍스트/데칼/포그 등)는 프록시 도형으로 검사
+        PickProxyComponents(*BVH, ray, SelectedComponent, closestDistance);
+    }
+    else
+    {
+        // BVH가 아직 없으면 (월드 초기화 전) 전체 액터 검사
+        for (AActor* Actor : Actors)
         {
-            closestDistance = hitDistance;
-            SelectedComponent = OutHitComponent;
-            if (closestDistance < adaptiveThreshold)
+            if (!Actor || Actor->GetActorHiddenInGame()) continue;
+
+            float hitDistance;
+            USceneComponent* OutHitComponent = nullptr;
+            if (CheckActorPicking(Actor, OutHitComponent, ray, hitDistance) && hitDistance < closestDistance)
             {
-                break;
+                closestDistance = hitDistance;
+                SelectedComponent = OutHitComponent;
             }
         }
     }
 
-
     uint64_t GlobalBVHCycleDiff = GlobalBVHPickingTimer.Finish();
     double GlobalBVHPickingTimeMs = FPlatformTime::ToMilliseconds(GlobalBVHCycleDiff);
 
+    // FlushBVHUpdates가 씬 버전을 올렸을 수 있으므로 갱신된 버전으로 저장
+    CacheKey.TargetVersion = GWorld ? GWorld->GetSceneVersion() : 0;
+    ScenePickCache.Store(CacheKey, SelectedComponent);
+
     if (SelectedComponent)
     {
         char buf[256];
-        sprintf_s(buf, "[Global BVH Pick Fallback] Hit actor at distance %.3f (Time: %.3fms)\n", closestDistance, GlobalBVHPickingTimeMs);
+        sprintf_s(buf, "[Global BVH Pick] Hit component at distance %.3f (Time: %.3fms)\n", closestDistance, GlobalBVHPickingTimeMs);
         UE_LOG(buf);
         return SelectedComponent;
     }
@@ -1071,6 +1029,268 @@ USceneComponent* CPickingSystem::PerformGlobalBVHPicking(const TArray<AActor*>&
     }
 }
 
+// 메시 삼각형 BVH를 메시 로컬 절두체로 탐색해 겹치는 삼각형이 하나라도 있으면 true
+// 노드 바운드가 절두체 안에 완전히 들어가면 그 아래 삼각형은 검사하지 않고 바로 true
+static bool FrustumOverlapsTriangleBVH(const FFrustum& LocalFrustum, const FNarrowPhaseBVHNode* Node, const FStaticMesh* MeshAsset, uint32 PlaneMask)
+{
+    if (!Node) return false;
+
+    const EFrustumContainment Containment = LocalFrustum.ClassifyBox(Node->Bounds, PlaneMask);
+    if (Containment == EFrustumContainment::Outside) return false;
+    if (Containment == EFrustumContainment::Inside) return true;
+
+    if (Node->IsLeaf())
+    {
+        for (const auto& Primitive : Node->Primitives)
+        {
+            const FVector& v0 = MeshAsset->Vertices[MeshAsset->Indices[Primitive.TriangleIndex * 3 + 0]].pos;
+            const FVector& v1 = MeshAsset->Vertices[MeshAsset->Indices[Primitive.TriangleIndex * 3 + 1]].pos;
+            const FVector& v2 = MeshAsset->Vertices[MeshAsset->Indices[Primitive.TriangleIndex * 3 + 2]].pos;
+            if (LocalFrustum.IntersectsTriangle(v0, v1, v2, PlaneMask))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    return FrustumOverlapsTriangleBVH(LocalFrustum, Node->Left, MeshAsset, PlaneMask)
+        || FrustumOverlapsTriangleBVH(LocalFrustum, Node->Right, MeshAsset, PlaneMask);
+}
+
+// 경계에 걸친 액터의 컴포넌트별 정밀 검사 (워커 스레드에서 호출, 읽기 전용)
+static bool MarqueeOverlapsActorTriangles(AActor* Actor, const FBVH& BVH, const FFrustum& WorldFrustum, const FMatrix& MarqueeViewProj)
+{
+    for (const FComponentBounds& Entry : BVH.GetComponentBounds(Actor))
+    {
+        uint32 PlaneMask = FFrustum::AllPlanesMask;
+        const EFrustumContainment Containment = WorldFrustum.ClassifyBox(Entry.Bounds, PlaneMask);
+        if (Containment == EFrustumContainment::Outside) continue;
+        if (Containment == EFrustumContainment::Inside) return true;
+
+        UStaticMesh* Mesh = Entry.Component->GetStaticMesh();
+        FNarrowPhaseBVHNode* MeshBVH = Mesh ? Mesh->GetMeshBVH() : nullptr;
+        const FStaticMesh* MeshAsset = Mesh ? Mesh->GetStaticMeshAsset() : nullptr;
+        if (!MeshBVH || !MeshAsset)
+        {
+            // 삼각형 BVH가 없으면 바운드 판정을 그대로 사용
+            return true;
+        }
+
+        // World * ViewProj에서 평면을 뽑으면 메시 로컬 공간 절두체 (정점을 월드로 옮기지 않음)
+        // 월드 AABB에서 완전히 안쪽으로 판정된 평면은 메시의 모든 점에 대해서도 안쪽이므로 마스크를 이어서 사용
+        FFrustum LocalFrustum;
+        LocalFrustum.Update(Entry.Component->GetWorldMatrix() * MarqueeViewProj);
+        if (FrustumOverlapsTriangleBVH(LocalFrustum, MeshBVH, MeshAsset, PlaneMask))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CPickingSystem::PerformMarqueeSelection(ACameraActor* Camera,
+    const FVector2D& RectStart,
+    const FVector2D& RectEnd,
+    const FVector2D& ViewportSize,
+    float ViewportAspectRatio, FViewport* Viewport,
+    bool bTriangleAccurate,
+    TArray<AActor*>& OutActors)
+{
+    TStatId MarqueeStatId;
+    FScopeCycleCounter MarqueeTimer(MarqueeStatId);
+
+    if (!Camera || !GWorld || ViewportSize.X <= 0.0f || ViewportSize.Y <= 0.0f) return;
+
+    // 1. 픽셀 사각형 (너무 얇으면 무시)
+    const float MinX = std::min(RectStart.X, RectEnd.X);
+    const float MaxX = std::max(RectStart.X, RectEnd.X);
+    const float MinY = std::min(RectStart.Y, RectEnd.Y);
+    const float MaxY = std::max(RectStart.Y, RectEnd.Y);
+    if (MaxX - MinX < 1.0f || MaxY - MinY < 1.0f) return;
+
+    // 2. 사각형이 클립 공간 [-1, 1]을 채우는 ViewProj → 하위 절두체
+    const FMatrix View = Camera->GetViewMatrix();
+    const FMatrix Proj = Camera->GetProjectionMatrix(ViewportAspectRatio, Viewport);
+    const FMatrix MarqueeViewProj = MakeScreenRectViewProj(View * Proj, MinX, MinY, MaxX, MaxY, ViewportSize);
+
+    FFrustum MarqueeFrustum;
+    MarqueeFrustum.Update(MarqueeViewProj);
+
+    FBVH* BVH = GWorld->GetBVH();
+    if (!BVH) return;
+    GWorld->FlushBVHUpdates();
+
+    // 3. BVH 계층 쿼리: 완전 포함 / 경계 걸침 분리
+    TArray<AActor*> Contained;
+    TArray<AActor*> Intersecting;
+    BVH->QueryFrustum(MarqueeFrustum, Contained, Intersecting);
+
+    OutActors.Reserve(OutActors.Num() + Contained.Num() + Intersecting.Num());
+    for (AActor* Actor : Contained)
+    {
+        if (Actor && !Actor->GetActorHiddenInGame())
+        {
+            OutActors.Add(Actor);
+        }
+    }
+
+    // 4. 경계 걸침 액터: 정밀 검사는 액터마다 독립이므로 워커 스레드로 나눠 판정만 기록
+    if (bTriangleAccurate && !Intersecting.IsEmpty())
+    {
+        TArray<uint8> bOverlaps;
+        bOverlaps.SetNum(Intersecting.Num(), 0);
+
+        FTaskSystem::GetInstance().ParallelFor(Intersecting.Num(), [&](int32 Index)
+        {
+            AActor* Actor = Intersecting[Index];
+            if (Actor && !Actor->GetActorHiddenInGame())
+            {
+                bOverlaps[Index] = MarqueeOverlapsActorTriangles(Actor, *BVH, MarqueeFrustum, MarqueeViewProj) ? 1 : 0;
+            }
+        });
+
+        for (int32 i = 0; i < Intersecting.Num(); ++i)
+        {
+            if (bOverlaps[i])
+            {
+                OutActors.Add(Intersecting[i]);
+            }
+        }
+    }
+    else
+    {
+        for (AActor* Actor : Intersecting)
+        {
+            if (Actor && !Actor->GetActorHiddenInGame())
+            {
+                OutActors.Add(Actor);
+            }
+        }
+    }
+
+    // 5. 메시가 없는 액터는 위치 한 점으로 판정
+    for (AActor* Actor : BVH->GetUnboundedActors())
+    {
+        if (!Actor || Actor->GetActorHiddenInGame()) continue;
+
+        const FVector Location = Actor->GetActorLocation();
+        uint32 PlaneMask = FFrustum::AllPlanesMask;
+        if (MarqueeFrustum.ClassifyBox(FBound(Location, Location), PlaneMask) != EFrustumContainment::Outside)
+        {
+            OutActors.Add(Actor);
+        }
+    }
+
+    uint64_t MarqueeCycleDiff = MarqueeTimer.Finish();
+    char buf[256];
+    sprintf_s(buf, "[Marquee Select] %d actors (contained %d, boundary %d) (Time: %.3fms)\n",
+        OutActors.Num(), Contained.Num(), Intersecting.Num(), FPlatformTime::ToMilliseconds(MarqueeCycleDiff));
+    UE_LOG(buf);
+}
+
+USceneComponent* CPickingSystem::PerformIDBufferPicking(ACameraActor* Camera,
+    const FVector2D& ViewportMousePos,
+    const FVector2D& ViewportSize,
+    const FVector2D& ViewportOffset,
+    float ViewportAspectRatio, FViewport* Viewport,
+    float* OutDistance)
+{
+    if (!Camera || !GWorld || ViewportSize.X <= 0.0f || ViewportSize.Y <= 0.0f) return nullptr;
+
+    FBVH* BVH = GWorld->GetBVH();
+    if (!BVH) return nullptr;
+
+    // 씬 버전을 올릴 수 있으므로 키를 만들기 전에 반영
+    GWorld->FlushBVHUpdates();
+
+    const FMatrix View = Camera->GetViewMatrix();
+    const FMatrix Proj = Camera->GetProjectionMatrix(ViewportAspectRatio, Viewport);
+    const int32 LocalX = static_cast<int32>(std::floor(ViewportMousePos.X - ViewportOffset.X));
+    const int32 LocalY = static_cast<int32>(std::floor(ViewportMousePos.Y - ViewportOffset.Y));
+
+    // 1. 기존 타일 재사용 여부: 타일 위치를 뺀 나머지 키가 같고 이번 클릭이 타일 안이면 그대로 조회
+    FPickingCacheKey TileKey = MakePickingCacheKey(Viewport, Camera, Proj, IDBufferTileKey.MousePos, ViewportSize);
+    TileKey.Target = GWorld;
+    TileKey.TargetVersion = GWorld->GetSceneVersion();
+
+    int32 TileX = LocalX - static_cast<int32>(IDBufferTileKey.MousePos.X);
+    int32 TileY = LocalY - static_cast<int32>(IDBufferTileKey.MousePos.Y);
+    const bool bReuseTile = bIDBufferTileValid && TileKey == IDBufferTileKey
+        && TileX >= 0 && TileY >= 0 && TileX < FIDBufferTile::Size && TileY < FIDBufferTile::Size;
+    URenderingStatsCollector::GetInstance().AddPickingCacheLookup(bReuseTile);
+
+    if (!bReuseTile)
+    {
+        // 2. 커서 중심 타일 → 타일 하위 절두체로 BVH 질의 (타일에 걸친 액터/컴포넌트만)
+        const int32 OriginX = LocalX - FIDBufferTile::Size / 2;
+        const int32 OriginY = LocalY - FIDBufferTile::Size / 2;
+        const FMatrix TileViewProj = MakeScreenRectViewProj(View * Proj,
+            static_cast<float>(OriginX), static_cast<float>(OriginY),
+            static_cast<float>(OriginX + FIDBufferTile::Size), static_cast<float>(OriginY + FIDBufferTile::Size), ViewportSize);
+
+        FFrustum TileFrustum;
+        TileFrustum.Update(TileViewProj);
+
+        TArray<AActor*> TileActors;
+        BVH->QueryFrustum(TileFrustum, TileActors);
+
+        // 3. 컴포넌트마다 ID를 매겨 타일에 래스터화 (깊이 테스트로 가장 가까운 ID만 남음)
+        IDBufferTile.Begin(TileViewProj);
+        IDBufferComponents.clear();
+        for (AActor* Actor : TileActors)
+        {
+            if (!Actor || Actor->GetActorHiddenInGame()) continue;
+
+            for (const FComponentBounds& Entry : BVH->GetComponentBounds(Actor))
+            {
+                uint32 PlaneMask = FFrustum::AllPlanesMask;
+                if (TileFrustum.ClassifyBox(Entry.Bounds, PlaneMask) == EFrustumContainment::Outside) continue;
+
+                UStaticMesh* Mesh = Entry.Component->GetStaticMesh();
+                const FStaticMesh* MeshAsset = Mesh ? Mesh->GetStaticMeshAsset() : nullptr;
+                if (!MeshAsset) continue;
+
+                IDBufferComponents.Add(Entry.Component);
+                IDBufferTile.RasterizeMesh(*MeshAsset, Mesh->GetMeshBVH(), Entry.Component->GetWorldMatrix(),
+                    static_cast<uint32>(IDBufferComponents.Num()));
+            }
+        }
+
+        IDBufferInvTileViewProj = TileViewProj.Inverse();
+        TileKey.MousePos = FVector2D(static_cast<float>(OriginX), static_cast<float>(OriginY));
+        IDBufferTileKey = TileKey;
+        bIDBufferTileValid = true;
+        TileX = LocalX - OriginX;
+        TileY = LocalY - OriginY;
+    }
+
+    // 4. 픽셀 조회 → 월드 거리 (타일 ViewProj 역행렬로 픽셀 중심 + 깊이를 월드로 되돌림)
+    const FRay Ray = MakeRayFromViewport(View, Proj, Camera->GetActorLocation(), Camera->GetRight(), Camera->GetUp(), Camera->GetForward(),
+        ViewportMousePos, ViewportSize, ViewportOffset);
+
+    USceneComponent* ClosestComponent = nullptr;
+    float ClosestDistance = FLT_MAX;
+
+    const uint32 Id = IDBufferTile.GetId(TileX, TileY);
+    if (Id != FIDBufferTile::InvalidId && Id <= static_cast<uint32>(IDBufferComponents.Num()))
+    {
+        const float NdcX = (static_cast<float>(TileX) + 0.5f) / FIDBufferTile::Size * 2.0f - 1.0f;
+        const float NdcY = 1.0f - (static_cast<float>(TileY) + 0.5f) / FIDBufferTile::Size * 2.0f;
+        const FVector4 World4 = FVector4(NdcX, NdcY, IDBufferTile.GetDepth(TileX, TileY), 1.0f) * IDBufferInvTileViewProj;
+        const FVector HitPoint(World4.X / World4.W, World4.Y / World4.W, World4.Z / World4.W);
+
+        ClosestComponent = IDBufferComponents[Id - 1];
+        ClosestDistance = (HitPoint - Ray.Origin).Size();
+    }
+
+    // 5. 메시가 아닌 컴포넌트는 타일에 없으므로 레이 프록시로 검사
+    PickProxyComponents(*BVH, Ray, ClosestComponent, ClosestDistance);
+
+    if (OutDistance) *OutDistance = ClosestDistance;
+    return ClosestComponent;
+}
+
 bool CPickingSystem::CheckBillboardComponentPicking(const UBillboardComponent* Component, const FRay& Ray, float& OutDistance)
 {
     if (!Component) return false;
@@ -1101,6 +1321,34 @@ bool CPickingSystem::CheckBillboardComponentPicking(const UBillboardComponent* C
     return false;
 }
 
+bool CPickingSystem::CheckTextComponentPicking(UTextRenderComponent* Component, const FRay& Ray, float& OutDistance)
+{
+    if (!Component) return false;
+
+    // 월드 공간 글리프 쿼드(좌상, 우상, 좌하, 우하)를 삼각형 두 개로 검사
+    const TArray<FBillboardVertexInfo_GPU>& Vertices = Component->GetWorldGlyphVertices();
+    float ClosestDistance = FLT_MAX;
+    for (size_t Base = 0; Base + 3 < Vertices.size(); Base += 4)
+    {
+        FVector Corners[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            const float* Position = Vertices[Base + i].Position;
+            Corners[i] = FVector(Position[0], Position[1], Position[2]);
+        }
+
+        float HitDistance;
+        if (IntersectRayTriangleMT(Ray, Corners[0], Corners[1], Corners[2], HitDistance) && HitDistance < ClosestDistance)
+            ClosestDistance = HitDistance;
+        if (IntersectRayTriangleMT(Ray, Corners[2], Corners[1], Corners[3], HitDistance) && HitDistance < ClosestDistance)
+            ClosestDistance = HitDistance;
+    }
+
+    if (ClosestDistance == FLT_MAX) return false;
+    OutDistance = ClosestDistance;
+    return true;
+}
+
 bool CPickingSystem::CheckDecalComponentPicking(const UDecalComponent* Component, const FRay& Ray, float& OutDistance)
 {
     if (!Component) return false;
@@ -59,6 +59,77 @@ bool IntersectRayTriangleMT(const FRay& InRay,
 
 bool IntersectRayBound(const FRay& InRay, const FBound& InBound, float* OutT = nullptr);
 
+// 메시 로컬 공간 광선으로 메시 공유 삼각형 BVH(BLAS)를 탐색 (자식은 가까운 쪽부터)
+// OutClosestHitDistance보다 먼 노드는 열지 않으며, 더 가까운 삼각형을 찾으면 갱신하고 true
+bool IntersectTriangleBVH(const FRay& LocalRay, FNarrowPhaseBVHNode* Node, const FStaticMesh* MeshAsset, float& OutClosestHitDistance);
+
+// 피킹/호버 결과 캐시 키 - 모든 필드가 같으면 이전 결과가 그대로 유효
+// 카메라/대상의 트랜스폼은 버전 카운터로, 트랜스폼이 아닌 투영(FOV/줌/종횡비)은 행렬 값으로 비교
+struct FPickingCacheKey
+{
+    const FViewport* Viewport = nullptr;
+    const ACameraActor* Camera = nullptr;
+    uint64 CameraVersion = 0;       // 카메라 액터 트랜스폼 버전 (뷰 행렬)
+    FMatrix Projection;
+    FVector2D MousePos;             // 전역 픽셀 좌표
+    FVector2D ViewportSize;
+    const void* Target = nullptr;   // 씬 피킹: UWorld / 기즈모 호버: 기즈모 대상 액터
+    uint64 TargetVersion = 0;       // 씬 피킹: UWorld 씬 버전 / 기즈모 호버: 대상 액터 트랜스폼 버전
+    uint32 Mode = 0;                // 기즈모 모드/공간
+
+    bool operator==(const FPickingCacheKey& Other) const
+    {
+        return Viewport == Other.Viewport && Camera == Other.Camera && CameraVersion == Other.CameraVersion
+            && Projection == Other.Projection
+            && MousePos.X == Other.MousePos.X && MousePos.Y == Other.MousePos.Y
+            && ViewportSize.X == Other.ViewportSize.X && ViewportSize.Y == Other.ViewportSize.Y
+            && Target == Other.Target && TargetVersion == Other.TargetVersion && Mode == Other.Mode;
+    }
+};
+
+// 뷰포트마다 마지막 결과 하나를 보관하는 캐시 (뷰포트 수가 적으므로 선형 탐색)
+template<typename TResult>
+class TPickingCache
+{
+public:
+    bool Find(const FPickingCacheKey& Key, TResult& OutResult) const
+    {
+        for (const FEntry& Entry : Entries)
+        {
+            if (Entry.Key == Key)
+            {
+                OutResult = Entry.Result;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Store(const FPickingCacheKey& Key, const TResult& Result)
+    {
+        for (FEntry& Entry : Entries)
+        {
+            if (Entry.Key.Viewport == Key.Viewport)
+            {
+                Entry.Key = Key;
+                Entry.Result = Result;
+                return;
+            }
+        }
+        Entries.Add({ Key, Result });
+    }
+
+    void Invalidate() { Entries.clear(); }
+
+private:
+    struct FEntry
+    {
+        FPickingCacheKey Key;
+        TResult Result;
+    };
+    TArray<FEntry> Entries;
+};
+
 /**
  * PickingSystem
  * - 액터 피킹 관련 로직을 담당하는 클래스
@@ -115,16 +186,58 @@ public:
                                                     const FVector2D& ViewportOffset,
                                                     float ViewportAspectRatio, FViewport* Viewport);
 
+    // CPU ID 버퍼 피킹: 커서 중심 FIDBufferTile(64x64)에 타일과 겹치는 메시 삼각형을 래스터화해 픽셀의 컴포넌트를 반환
+    // - 현재 호출자는 클릭 피킹뿐: 카메라/씬 버전이 같고 다음 클릭이 같은 타일 안이면 재래스터화 없이 픽셀 조회만
+    //   (같은 픽셀 재클릭은 그 전에 ScenePickCache에서 끝남)
+    // - 메시가 아닌 컴포넌트(빌보드/텍스트/데칼 등)는 레이 프록시로 검사해 더 가까운 쪽 반환
+    static USceneComponent* PerformIDBufferPicking(ACameraActor* Camera,
+                                                   const FVector2D& ViewportMousePos,
+                                                   const FVector2D& ViewportSize,
+                                                   const FVector2D& ViewportOffset,
+                                                   float ViewportAspectRatio, FViewport* Viewport,
+                                                   float* OutDistance = nullptr);
+
+    // PerformGlobalBVHPicking이 레이 BVH 대신 ID 버퍼 타일을 사용할지 (콘솔: PICKING IDBUFFER / PICKING RAY)
+    static void SetIDBufferPickingEnabled(bool bEnabled) { bIDBufferPickingEnabled = bEnabled; }
+    static bool IsIDBufferPickingEnabled() { return bIDBufferPickingEnabled; }
+
+    // 마퀴(박스) 선택: 뷰포트 로컬 픽셀 사각형을 하위 절두체로 만들어 월드 BVH를 계층 검사
+    // - 바운드가 절두체 안에 완전히 들어간 액터는 그대로 선택
+    // - bTriangleAccurate면 경계에 걸친 액터만 워커 스레드에서 메시 삼각형 BVH로 다시 검사
+    // - 메시가 없는 액터(라이트/데칼 등)는 액터 위치가 사각형 안에 있으면 선택
+    static void PerformMarqueeSelection(ACameraActor* Camera,
+                                        const FVector2D& RectStart,
+                                        const FVector2D& RectEnd,
+                                        const FVector2D& ViewportSize,
+                                        float ViewportAspectRatio, FViewport* Viewport,
+                                        bool bTriangleAccurate,
+                                        TArray<AActor*>& OutActors);
+
     /** === 헬퍼 함수들 === */
     static bool CheckActorPicking(AActor* Actor, USceneComponent*& OutComponent, const FRay& Ray, float& OutDistance);
+    // 메시가 아닌 컴포넌트(빌보드/텍스트/데칼/포그)만 프록시 도형으로 검사 (TLAS/ID 타일에 들어가지 않는 컴포넌트)
+    static bool CheckActorProxyPicking(AActor* Actor, USceneComponent*& OutComponent, const FRay& Ray, float& OutDistance);
+    static bool HasProxyPickComponents(AActor* Actor);
 
     // 거리 기반 적응형 조기 종료 임계값
     static float GetAdaptiveThreshold(float cameraDistance);
 
+    // 호버/피킹 결과 캐시 비우기 (월드 교체 등 버전으로 잡히지 않는 변경용)
+    static void InvalidatePickingCache();
+
 private:
+    // 뷰포트/카메라/마우스 공통 키
+    static FPickingCacheKey MakePickingCacheKey(FViewport* Viewport, const ACameraActor* Camera, const FMatrix& Proj,
+                                                const FVector2D& ViewportMousePos, const FVector2D& ViewportSize);
+
+    static TPickingCache<uint32> GizmoHoverCache;
+    static TPickingCache<USceneComponent*> ScenePickCache;
+    static bool bIDBufferPickingEnabled;
+
     /** === 내부 헬퍼 함수들 === */
     static bool CheckGizmoComponentPicking(const UStaticMeshComponent* Component, const FRay& Ray, float& OutDistance);
     static bool CheckBillboardComponentPicking(const class UBillboardComponent* Component, const FRay& Ray, float& OutDistance);
+    static bool CheckTextComponentPicking(class UTextRenderComponent* Component, const FRay& Ray, float& OutDistance);
     static bool CheckDecalComponentPicking(const class UDecalComponent* Component, const FRay& Ray, float& OutDistance);
     static bool CheckHeightFogComponentPicking(const class UHeightFogComponent* Component, const FRay& Ray, float& OutDistance);
 };
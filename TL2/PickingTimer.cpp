@@ -1,4 +1,4 @@
-#include "pch.h"
+// Compiled without pch.h: linked into the headless RHI core as well as the editor
 #include "PickingTimer.h"
 
 // Static member initialization
@@ -1,5 +1,14 @@
 #pragma once
+#include <cstdint>
+#if defined(_WIN32)
+// pch-free TUs (headless RHI core) get Windows.h from here; keep min/max macros away from std::min/std::max
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
 #include <Windows.h>
+#else
+#include <chrono>
+#endif
 
 class FWindowsPlatformTime
 {
@@ -32,9 +41,14 @@ public:
     }
     static uint64_t GetFrequency()
     {
+#if defined(_WIN32)
         LARGE_INTEGER Frequency;
         QueryPerformanceFrequency(&Frequency);
         return Frequency.QuadPart;
+#else
+        // Headless (non-Windows) builds count steady_clock ticks instead of QPC
+        return static_cast<uint64_t>(std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num);
+#endif
     }
     static double ToMilliseconds(uint64_t CycleDiff)
     {
@@ -47,9 +61,13 @@ public:
 
     static uint64_t Cycles64()
     {
+#if defined(_WIN32)
         LARGE_INTEGER CycleCount;
         QueryPerformanceCounter(&CycleCount);
         return (uint64_t)CycleCount.QuadPart;
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
     }
 };
 
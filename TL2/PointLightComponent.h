@@ -10,7 +10,7 @@ public:
 	UObject* Duplicate(FObjectDuplicationParameters Parameters) override;
 	
 	float GetFalloff() { return LightFalloffExponent; } 
-	void SetFalloff(float InFalloff) { LightFalloffExponent = InFalloff; }
+	void SetFalloff(float InFalloff) { LightFalloffExponent = InFalloff; MarkLightDirty(); }
 protected:
 	~UPointLightComponent();
 
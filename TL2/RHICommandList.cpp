@@ -0,0 +1,292 @@
+﻿// pch.h(windows.h/d3d11.h)를 쓰지 않는 TU: RHI 코어가 특정 그래픽스 API에 묶이지 않았는지 컴파일 단계에서 보장
+#include "RHICommandList.h"
+#include <cstring>
+#include <new>
+
+// ============================================================================
+// FRHICommandArena
+// ============================================================================
+
+FRHICommandArena::FRHICommandArena(uint32 InBlockSize)
+	: BlockSize(InBlockSize)
+{
+}
+
+void* FRHICommandArena::Allocate(uint32 Size, uint32 Alignment)
+{
+	while (true)
+	{
+		if (CurrentBlock < Blocks.Num())
+		{
+			FBlock& Block = Blocks[CurrentBlock];
+			const uintptr_t Base = reinterpret_cast<uintptr_t>(Block.Data.get());
+			const uintptr_t Aligned = (Base + Block.Used + (Alignment - 1)) & ~static_cast<uintptr_t>(Alignment - 1);
+			const uint32 NewUsed = static_cast<uint32>(Aligned - Base) + Size;
+
+			if (NewUsed <= Block.Size)
+			{
+				UsedBytes += NewUsed - Block.Used;
+				Block.Used = NewUsed;
+				return reinterpret_cast<void*>(Aligned);
+			}
+
+			// 남은 블록이 있으면 다음 블록으로, 없으면 새로 추가
+			++CurrentBlock;
+			continue;
+		}
+
+		FBlock NewBlock;
+		NewBlock.Size = std::max(BlockSize, Size + Alignment);
+		NewBlock.Data = std::make_unique<uint8[]>(NewBlock.Size);
+		Blocks.push_back(std::move(NewBlock));
+	}
+}
+
+void FRHICommandArena::Reset()
+{
+	for (FBlock& Block : Blocks)
+	{
+		Block.Used = 0;
+	}
+	CurrentBlock = 0;
+	UsedBytes = 0;
+}
+
+uint64 FRHICommandArena::GetReservedBytes() const
+{
+	uint64 Total = 0;
+	for (const FBlock& Block : Blocks)
+	{
+		Total += Block.Size;
+	}
+	return Total;
+}
+
+// ============================================================================
+// 커맨드 페이로드
+// ============================================================================
+
+namespace
+{
+	struct FRHICmdSetShader { FRHIShaderHandle Shader; };
+	struct FRHICmdSetVertexIndexBuffers { FRHIBufferHandle VertexBuffer; FRHIBufferHandle IndexBuffer; uint32 Stride; };
+	struct FRHICmdSetPrimitiveTopology { ERHIPrimitiveTopology Topology; };
+	struct FRHICmdSetDefaultSampler { uint32 Slot; };
+	struct FRHICmdSetShaderResource { uint32 Slot; FRHITextureHandle Texture; };
+	struct FRHICmdSetPixelConstants { const FObjMaterialInfo* MaterialInfo; bool bHasTexture; };
+	struct FRHICmdSetObjectConstants { uint32 ConstantIndex; FMatrix ViewMatrix; FMatrix ProjMatrix; };	// 월드 행렬은 ObjectWorldMatrices[ConstantIndex]
+	struct FRHICmdSetHighlightConstants { uint32 ConstantIndex; };	// HighlightConstants[ConstantIndex]
+	struct alignas(16) FRHICmdSetInstanceData { uint32 NumInstances; };	// 뒤에 FMatrix[NumInstances]
+	struct FRHICmdDrawIndexed { uint32 IndexCount; uint32 StartIndex; int32 BaseVertex; };
+	struct FRHICmdDrawIndexedInstanced { uint32 IndexCount; uint32 StartIndex; uint32 NumInstances; };
+
+	template<typename TCommand>
+	const TCommand& GetPayload(const void* Header, uint32 HeaderSize)
+	{
+		return *reinterpret_cast<const TCommand*>(static_cast<const uint8*>(Header) + HeaderSize);
+	}
+}
+
+// ============================================================================
+// FRHICommandList
+// ============================================================================
+
+void FRHICommandList::Reset()
+{
+	Arena.Reset();
+	Head = nullptr;
+	Tail = nullptr;
+	NumCommands = 0;
+	std::fill(std::begin(CommandCounts), std::end(CommandCounts), 0u);
+	ObjectWorldMatrices.clear();
+	HighlightConstants.clear();
+}
+
+void FRHICommandList::Link(FCommandHeader* Header)
+{
+	if (Tail)
+	{
+		Tail->Next = Header;
+	}
+	else
+	{
+		Head = Header;
+	}
+	Tail = Header;
+
+	++NumCommands;
+	++CommandCounts[static_cast<uint32>(Header->Type)];
+}
+
+void FRHICommandList::SetShader(FRHIShaderHandle Shader)
+{
+	Record<FRHICmdSetShader>(ERHICommandType::SetShader)->Shader = Shader;
+}
+
+void FRHICommandList::SetVertexIndexBuffers(FRHIBufferHandle VertexBuffer, FRHIBufferHandle IndexBuffer, uint32 Stride)
+{
+	FRHICmdSetVertexIndexBuffers* Command = Record<FRHICmdSetVertexIndexBuffers>(ERHICommandType::SetVertexIndexBuffers);
+	Command->VertexBuffer = VertexBuffer;
+	Command->IndexBuffer = IndexBuffer;
+	Command->Stride = Stride;
+}
+
+void FRHICommandList::SetPrimitiveTopology(ERHIPrimitiveTopology Topology)
+{
+	Record<FRHICmdSetPrimitiveTopology>(ERHICommandType::SetPrimitiveTopology)->Topology = Topology;
+}
+
+void FRHICommandList::SetDefaultSampler(uint32 Slot)
+{
+	Record<FRHICmdSetDefaultSampler>(ERHICommandType::SetDefaultSampler)->Slot = Slot;
+}
+
+void FRHICommandList::SetShaderResource(uint32 Slot, FRHITextureHandle Texture)
+{
+	FRHICmdSetShaderResource* Command = Record<FRHICmdSetShaderResource>(ERHICommandType::SetShaderResource);
+	Command->Slot = Slot;
+	Command->Texture = Texture;
+}
+
+void FRHICommandList::SetPixelConstants(const FObjMaterialInfo* MaterialInfo, bool bHasTexture)
+{
+	FRHICmdSetPixelConstants* Command = Record<FRHICmdSetPixelConstants>(ERHICommandType::SetPixelConstants);
+	Command->MaterialInfo = MaterialInfo;
+	Command->bHasTexture = bHasTexture;
+}
+
+void FRHICommandList::SetObjectConstants(const FMatrix& WorldMatrix, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix)
+{
+	FRHICmdSetObjectConstants* Command = Record<FRHICmdSetObjectConstants>(ERHICommandType::SetObjectConstants);
+	Command->ConstantIndex = static_cast<uint32>(ObjectWorldMatrices.size());
+	ObjectWorldMatrices.push_back(WorldMatrix);
+	Command->ViewMatrix = ViewMatrix;
+	Command->ProjMatrix = ProjMatrix;
+}
+
+void FRHICommandList::SetHighlightConstants(uint32 Picked, const FVector& Color, uint32 X, uint32 Y, uint32 Z, uint32 Gizmo)
+{
+	FRHIHighlightConstants Constants;
+	Constants.Picked = Picked;
+	Constants.Color = Color;
+	Constants.X = X;
+	Constants.Y = Y;
+	Constants.Z = Z;
+	Constants.Gizmo = Gizmo;
+
+	// 하이라이트는 대부분 선택 여부만 바뀌므로 직전 값과 같으면 같은 상수를 다시 참조
+	if (HighlightConstants.empty() || !(HighlightConstants.back() == Constants))
+	{
+		HighlightConstants.push_back(Constants);
+	}
+
+	Record<FRHICmdSetHighlightConstants>(ERHICommandType::SetHighlightConstants)->ConstantIndex = static_cast<uint32>(HighlightConstants.size() - 1);
+}
+
+void FRHICommandList::SetInstanceData(const FMatrix* WorldMatrices, uint32 NumInstances)
+{
+	FRHICmdSetInstanceData* Command = Record<FRHICmdSetInstanceData>(ERHICommandType::SetInstanceData, NumInstances * sizeof(FMatrix));
+	Command->NumInstances = NumInstances;
+	if (NumInstances > 0)
+	{
+		std::memcpy(Command + 1, WorldMatrices, NumInstances * sizeof(FMatrix));
+	}
+}
+
+void FRHICommandList::DrawIndexedInstanced(uint32 IndexCount, uint32 StartIndex, uint32 NumInstances)
+{
+	FRHICmdDrawIndexedInstanced* Command = Record<FRHICmdDrawIndexedInstanced>(ERHICommandType::DrawIndexedInstanced);
+	Command->IndexCount = IndexCount;
+	Command->StartIndex = StartIndex;
+	Command->NumInstances = NumInstances;
+}
+
+void FRHICommandList::DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex)
+{
+	FRHICmdDrawIndexed* Command = Record<FRHICmdDrawIndexed>(ERHICommandType::DrawIndexed);
+	Command->IndexCount = IndexCount;
+	Command->StartIndex = StartIndex;
+	Command->BaseVertex = BaseVertex;
+}
+
+void FRHICommandList::Execute(IRHICommandContext& Context) const
+{
+	constexpr uint32 HeaderSize = sizeof(FCommandHeader);
+
+	// 오브젝트 상수를 먼저 일괄 업로드하고, 아래 커맨드는 인덱스로 참조
+	Context.StageObjectConstants(ObjectWorldMatrices, HighlightConstants);
+
+	for (const FCommandHeader* Header = Head; Header; Header = Header->Next)
+	{
+		switch (Header->Type)
+		{
+		case ERHICommandType::SetShader:
+		{
+			const FRHICmdSetShader& Command = GetPayload<FRHICmdSetShader>(Header, HeaderSize);
+			Context.SetShader(Command.Shader);
+			break;
+		}
+		case ERHICommandType::SetVertexIndexBuffers:
+		{
+			const FRHICmdSetVertexIndexBuffers& Command = GetPayload<FRHICmdSetVertexIndexBuffers>(Header, HeaderSize);
+			Context.SetVertexIndexBuffers(Command.VertexBuffer, Command.IndexBuffer, Command.Stride);
+			break;
+		}
+		case ERHICommandType::SetPrimitiveTopology:
+		{
+			Context.SetPrimitiveTopology(GetPayload<FRHICmdSetPrimitiveTopology>(Header, HeaderSize).Topology);
+			break;
+		}
+		case ERHICommandType::SetDefaultSampler:
+		{
+			Context.SetDefaultSampler(GetPayload<FRHICmdSetDefaultSampler>(Header, HeaderSize).Slot);
+			break;
+		}
+		case ERHICommandType::SetShaderResource:
+		{
+			const FRHICmdSetShaderResource& Command = GetPayload<FRHICmdSetShaderResource>(Header, HeaderSize);
+			Context.SetShaderResource(Command.Slot, Command.Texture);
+			break;
+		}
+		case ERHICommandType::SetPixelConstants:
+		{
+			const FRHICmdSetPixelConstants& Command = GetPayload<FRHICmdSetPixelConstants>(Header, HeaderSize);
+			Context.SetPixelConstants(Command.MaterialInfo, Command.bHasTexture);
+			break;
+		}
+		case ERHICommandType::SetObjectConstants:
+		{
+			const FRHICmdSetObjectConstants& Command = GetPayload<FRHICmdSetObjectConstants>(Header, HeaderSize);
+			Context.SetObjectConstants(Command.ConstantIndex, ObjectWorldMatrices[Command.ConstantIndex], Command.ViewMatrix, Command.ProjMatrix);
+			break;
+		}
+		case ERHICommandType::SetHighlightConstants:
+		{
+			const FRHICmdSetHighlightConstants& Command = GetPayload<FRHICmdSetHighlightConstants>(Header, HeaderSize);
+			Context.SetHighlightConstants(Command.ConstantIndex, HighlightConstants[Command.ConstantIndex]);
+			break;
+		}
+		case ERHICommandType::SetInstanceData:
+		{
+			const FRHICmdSetInstanceData& Command = GetPayload<FRHICmdSetInstanceData>(Header, HeaderSize);
+			Context.SetInstanceData(reinterpret_cast<const FMatrix*>(&Command + 1), Command.NumInstances);
+			break;
+		}
+		case ERHICommandType::DrawIndexedInstanced:
+		{
+			const FRHICmdDrawIndexedInstanced& Command = GetPayload<FRHICmdDrawIndexedInstanced>(Header, HeaderSize);
+			Context.DrawIndexedInstanced(Command.IndexCount, Command.StartIndex, Command.NumInstances);
+			break;
+		}
+		case ERHICommandType::DrawIndexed:
+		{
+			const FRHICmdDrawIndexed& Command = GetPayload<FRHICmdDrawIndexed>(Header, HeaderSize);
+			Context.DrawIndexed(Command.IndexCount, Command.StartIndex, Command.BaseVertex);
+			break;
+		}
+		default:
+			assert(false && "Unknown RHI command");
+			break;
+		}
+	}
+}
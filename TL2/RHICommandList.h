@@ -0,0 +1,165 @@
+﻿#pragma once
+#include "RHIResources.h"
+#include <type_traits>
+#include <span>
+
+struct FObjMaterialInfo;
+
+/**
+ * FRHICommandArena
+ * - 커맨드 기록용 선형 할당기 (블록 단위로 늘어나고 Reset 시 블록은 재사용)
+ * - 개별 해제는 없으며, 기록된 커맨드는 다음 Reset까지만 유효
+ */
+class FRHICommandArena
+{
+public:
+	explicit FRHICommandArena(uint32 InBlockSize = 64 * 1024);
+
+	void* Allocate(uint32 Size, uint32 Alignment);
+	void Reset();
+
+	uint64 GetUsedBytes() const { return UsedBytes; }
+	uint64 GetReservedBytes() const;
+
+private:
+	struct FBlock
+	{
+		std::unique_ptr<uint8[]> Data;
+		uint32 Size = 0;
+		uint32 Used = 0;
+	};
+
+	TArray<FBlock> Blocks;
+	int32 CurrentBlock = 0;
+	uint32 BlockSize;
+	uint64 UsedBytes = 0;
+};
+
+// HLSL HighLightBuffer(b2)와 같은 배치의 오브젝트 단위 하이라이트 상수
+struct FRHIHighlightConstants
+{
+	uint32 Picked = 0;
+	FVector Color;
+	uint32 X = 0;
+	uint32 Y = 0;
+	uint32 Z = 0;
+	uint32 Gizmo = 0;
+
+	bool operator==(const FRHIHighlightConstants& Other) const
+	{
+		return Picked == Other.Picked && Color == Other.Color && X == Other.X && Y == Other.Y && Z == Other.Z && Gizmo == Other.Gizmo;
+	}
+};
+
+enum class ERHICommandType : uint8
+{
+	SetShader,
+	SetVertexIndexBuffers,
+	SetPrimitiveTopology,
+	SetDefaultSampler,
+	SetShaderResource,
+	SetPixelConstants,
+	SetObjectConstants,
+	SetHighlightConstants,
+	SetInstanceData,
+	DrawIndexed,
+	DrawIndexedInstanced,
+
+	Count
+};
+
+/**
+ * IRHICommandContext
+ * - 기록된 커맨드를 실제로 실행하는 백엔드
+ * - D3D11(FD3D11CommandContext) 또는 GPU 없이 호출 수만 세는 Null 백엔드(FNullRHICommandContext)
+ * - 리소스는 RHI 핸들로만 받으며 실제 타입으로의 변환은 각 백엔드가 담당
+ */
+class IRHICommandContext
+{
+public:
+	virtual ~IRHICommandContext() = default;
+
+	virtual void SetShader(FRHIShaderHandle Shader) = 0;
+	virtual void SetVertexIndexBuffers(FRHIBufferHandle VertexBuffer, FRHIBufferHandle IndexBuffer, uint32 Stride) = 0;
+	virtual void SetPrimitiveTopology(ERHIPrimitiveTopology Topology) = 0;
+	virtual void SetDefaultSampler(uint32 Slot) = 0;
+	virtual void SetShaderResource(uint32 Slot, FRHITextureHandle Texture) = 0;
+	// MaterialInfo가 nullptr이면 머티리얼 없는 메시 (백엔드 기본 픽셀 상수)
+	virtual void SetPixelConstants(const FObjMaterialInfo* MaterialInfo, bool bHasTexture) = 0;
+	// Execute 시작 시 한 번 호출: 리스트가 참조하는 오브젝트 상수 전체를 미리 (한 번에) 올릴 기회
+	virtual void StageObjectConstants(std::span<const FMatrix> WorldMatrices, std::span<const FRHIHighlightConstants> Highlights) {}
+	// ConstantIndex는 StageObjectConstants로 넘긴 배열의 인덱스
+	virtual void SetObjectConstants(uint32 ConstantIndex, const FMatrix& WorldMatrix, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix) = 0;
+	virtual void SetHighlightConstants(uint32 ConstantIndex, const FRHIHighlightConstants& Constants) = 0;
+	// 인스턴스별 월드 행렬을 인스턴스 스트림(슬롯 1)으로 올림
+	virtual void SetInstanceData(const FMatrix* WorldMatrices, uint32 NumInstances) = 0;
+	virtual void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) = 0;
+	virtual void DrawIndexedInstanced(uint32 IndexCount, uint32 StartIndex, uint32 NumInstances) = 0;
+};
+
+/**
+ * FRHICommandList
+ * - 렌더러가 디바이스 컨텍스트 대신 기록하는 커맨드 버퍼 (현재는 정적 메시 패스만 기록)
+ * - 커맨드는 아레나에 [헤더 + 페이로드]로 쌓이고 Execute에서 기록 순서대로 재생
+ * - 타입별 기록 횟수/바이트를 세므로 Null 백엔드와 함께 쓰면 헤드리스 환경에서 프레임 비용을 측정할 수 있다
+ * - 오브젝트 상수(월드 행렬/하이라이트)는 별도 배열에 모아 두고 커맨드는 인덱스만 가짐
+ *   → 실행 백엔드가 프레임 상수를 한 번에 올리고 드로우에서는 오프셋만 바인딩할 수 있음
+ */
+class FRHICommandList
+{
+public:
+	void Reset();
+
+	void SetShader(FRHIShaderHandle Shader);
+	void SetVertexIndexBuffers(FRHIBufferHandle VertexBuffer, FRHIBufferHandle IndexBuffer, uint32 Stride);
+	void SetPrimitiveTopology(ERHIPrimitiveTopology Topology);
+	void SetDefaultSampler(uint32 Slot);
+	void SetShaderResource(uint32 Slot, FRHITextureHandle Texture);
+	// MaterialInfo는 Execute 시점까지 살아 있어야 함 (머티리얼 소유 데이터, nullptr이면 기본 픽셀 상수)
+	void SetPixelConstants(const FObjMaterialInfo* MaterialInfo, bool bHasTexture);
+	void SetObjectConstants(const FMatrix& WorldMatrix, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix);
+	void SetHighlightConstants(uint32 Picked, const FVector& Color, uint32 X, uint32 Y, uint32 Z, uint32 Gizmo);
+	// 행렬은 아레나로 복사되므로 호출 직후 원본을 버려도 됨
+	void SetInstanceData(const FMatrix* WorldMatrices, uint32 NumInstances);
+	void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex = 0);
+	void DrawIndexedInstanced(uint32 IndexCount, uint32 StartIndex, uint32 NumInstances);
+
+	// 기록된 커맨드를 순서대로 실행 (기록 내용은 Reset 전까지 유지되어 재실행 가능)
+	void Execute(IRHICommandContext& Context) const;
+
+	uint32 GetNumCommands() const { return NumCommands; }
+	uint32 GetNumObjectConstants() const { return static_cast<uint32>(ObjectWorldMatrices.size() + HighlightConstants.size()); }
+	uint32 GetNumCommands(ERHICommandType Type) const { return CommandCounts[static_cast<uint32>(Type)]; }
+	uint64 GetUsedBytes() const { return Arena.GetUsedBytes(); }
+
+private:
+	struct alignas(16) FCommandHeader
+	{
+		FCommandHeader* Next = nullptr;
+		ERHICommandType Type = ERHICommandType::Count;
+	};
+
+	template<typename TCommand>
+	TCommand* Record(ERHICommandType Type, uint32 ExtraBytes = 0)
+	{
+		static_assert(std::is_trivially_destructible_v<TCommand>, "RHI 커맨드는 아레나에서 소멸자 없이 버려진다");
+
+		void* Memory = Arena.Allocate(sizeof(FCommandHeader) + sizeof(TCommand) + ExtraBytes, alignof(FCommandHeader));
+		FCommandHeader* Header = new (Memory) FCommandHeader();
+		Header->Type = Type;
+		Link(Header);
+		return new (Header + 1) TCommand();
+	}
+
+	void Link(FCommandHeader* Header);
+
+	FRHICommandArena Arena;
+	FCommandHeader* Head = nullptr;
+	FCommandHeader* Tail = nullptr;
+
+	TArray<FMatrix> ObjectWorldMatrices;
+	TArray<FRHIHighlightConstants> HighlightConstants;	// 연속으로 같은 값이면 재사용
+
+	uint32 NumCommands = 0;
+	uint32 CommandCounts[static_cast<uint32>(ERHICommandType::Count)] = {};
+};
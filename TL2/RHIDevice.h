@@ -51,8 +51,6 @@ public:
     virtual void UpdateColorConstantBuffers(const FVector4& InColor) = 0;
     virtual void UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeSec) = 0;
     virtual void UpdateInvWorldConstantBuffer(const FMatrix& InvWorldMatrix, const FMatrix& InvViewProjMatrix) = 0;
-    // Lighting
-    virtual void UpdateLightConstantBuffers(const TArray<FLightInfo>& InLights) = 0;
     virtual void UpdateFXAAConstantBuffers(const FXAAInfo& InFXAA) = 0;
     virtual void UpdateHeatConstantBuffer(const FHeatInfo& HeatCB) = 0;
 
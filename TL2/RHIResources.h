@@ -0,0 +1,66 @@
+﻿#pragma once
+
+// RHI 코어 공용 타입
+// - windows.h/d3d11.h에 의존하지 않음: RHI 커맨드 리스트와 Null 컨텍스트는 pch 없이 이 헤더만으로 컴파일된다
+// - 백엔드 리소스는 불투명 핸들로만 주고받고, 실제 타입으로의 변환은 각 백엔드 컨텍스트가 담당
+
+// UEContainer.h보다 먼저 (pch.h와 같은 순서)
+#include <cstdint>
+#include <cfloat>
+#include <cassert>
+#include <vector>
+#include <map>
+#include <set>
+#include <unordered_set>
+#include <unordered_map>
+#include <queue>
+#include <stack>
+#include <list>
+#include <deque>
+#include <string>
+#include <array>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <iterator>
+
+#include "UEContainer.h"
+#include "Vector.h"
+
+/**
+ * TRHIHandle
+ * - 백엔드 리소스 포인터를 담는 불투명 핸들 (RHI 코어는 역참조하지 않음)
+ * - 태그 타입으로 버퍼/텍스처/셰이더 핸들이 서로 섞이지 않도록 구분
+ * - D3D11 백엔드는 FD3D11CommandContext::Make*Handle로 만들고, Null 백엔드는 값을 식별자로만 사용
+ */
+template<typename TTag>
+struct TRHIHandle
+{
+	void* Resource = nullptr;
+
+	TRHIHandle() = default;
+	explicit TRHIHandle(void* InResource) : Resource(InResource) {}
+
+	// 벤치마크 등에서 실제 리소스 없이 구분 가능한 핸들을 만들 때 사용 (0은 무효 핸들)
+	static TRHIHandle FromId(uint64 Id) { return TRHIHandle(reinterpret_cast<void*>(static_cast<uintptr_t>(Id))); }
+
+	bool IsValid() const { return Resource != nullptr; }
+	bool operator==(const TRHIHandle& Other) const { return Resource == Other.Resource; }
+	bool operator!=(const TRHIHandle& Other) const { return Resource != Other.Resource; }
+};
+
+using FRHIShaderHandle = TRHIHandle<struct FRHIShaderTag>;		// 정점/픽셀 셰이더 + 입력 레이아웃 묶음
+using FRHIBufferHandle = TRHIHandle<struct FRHIBufferTag>;		// 정점/인덱스 버퍼
+using FRHITextureHandle = TRHIHandle<struct FRHITextureTag>;	// 픽셀 셰이더에서 읽는 텍스처 뷰
+
+enum class ERHIPrimitiveTopology : uint8
+{
+	TriangleList,
+	TriangleStrip,
+	LineList,
+	LineStrip,
+	PointList,
+};
@@ -9,19 +9,21 @@
 #include "RenderingStats.h"
 #include "UI/StatsOverlayD2D.h"
 #include "D3D11RHI.h"
+#include "Material.h"
 
-
-URenderer::URenderer(URHIDevice* InDevice) : RHIDevice(InDevice)
+URenderer::URenderer(URHIDevice* InDevice) : RHIDevice(InDevice), D3D11CommandContext(InDevice)
 {
     InitializeLineBatch();
+
+    // 기본 정적 메시 셰이더는 같은 메시끼리 인스턴싱
+    UShader* StaticMeshShader = UResourceManager::GetInstance().Load<UShader>("StaticMeshShader.hlsl");
+    UShader* StaticMeshInstancedShader = UResourceManager::GetInstance().Load<UShader>("StaticMeshInstanced.hlsl");
+    MeshDrawCommands.SetInstancedShader(FD3D11CommandContext::MakeShaderHandle(StaticMeshShader), FD3D11CommandContext::MakeShaderHandle(StaticMeshInstancedShader));
 }
 
 URenderer::~URenderer()
 {
-    if (LineBatchData)
-    {
-        delete LineBatchData;
-    }
+    LineBatcher.Release();
 }
 
 void URenderer::BeginFrame()
@@ -31,6 +33,9 @@ void URenderer::BeginFrame()
     
     // 상태 추적 리셋
     ResetRenderStateTracking();
+
+    // 프레임 상수 링을 처음부터 다시 사용
+    static_cast<D3D11RHI*>(RHIDevice)->BeginConstantFrame();
     
     // 백버퍼/깊이버퍼를 클리어
     RHIDevice->ClearBackBuffer();  // 배경색
@@ -134,6 +139,37 @@ void URenderer::UpdateInvWorldBuffer(const FMatrix& InvWorldMatrix, const FMatri
     RHIDevice->UpdateInvWorldConstantBuffer(InvWorldMatrix, InvViewProjMatrix);
 }
 
+bool URenderer::UploadModelConstants(const TArray<FMatrix>& ModelMatrices, TArray<FConstantSlice>& OutSlices)
+{
+    D3D11RHI* D3D11Device = static_cast<D3D11RHI*>(RHIDevice);
+    if (ModelMatrices.empty() || !D3D11Device->IsConstantRingEnabled())
+    {
+        return false;
+    }
+
+    if (!D3D11Device->BeginConstantBatch(static_cast<uint32>(ModelMatrices.size()) * FConstantBufferRing::SliceAlignment))
+    {
+        return false;
+    }
+
+    OutSlices.SetNum(static_cast<int32>(ModelMatrices.size()));
+    bool bSucceeded = true;
+    for (size_t Index = 0; Index < ModelMatrices.size() && bSucceeded; ++Index)
+    {
+        bSucceeded = D3D11Device->AllocateModelConstants(ModelMatrices[Index], OutSlices[Index]);
+    }
+
+    D3D11Device->EndConstantBatch();
+    return bSucceeded;
+}
+
+void URenderer::BindModelConstants(const FConstantSlice& Slice, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix)
+{
+    D3D11RHI* D3D11Device = static_cast<D3D11RHI*>(RHIDevice);
+    D3D11Device->UpdateViewConstantBuffers(ViewMatrix, ProjMatrix);
+    D3D11Device->BindModelConstants(Slice);
+}
+
 void URenderer::UpdateViewportBuffer(float StartX, float StartY, float SizeX, float SizeY)
 {
     static_cast<D3D11RHI*>(RHIDevice)->UpdateViewportConstantBuffer(StartX, StartY, SizeX, SizeY);
@@ -191,46 +227,30 @@ void URenderer::UpdateHeatConstantBuffer(const FHeatInfo& HeatCB)
     RHIDevice->UpdateHeatConstantBuffer(HeatCB);
 }
 
-void URenderer::DrawIndexedPrimitiveComponent(UStaticMesh* InMesh, D3D11_PRIMITIVE_TOPOLOGY InTopology, const TArray<FMaterialSlot>& InComponentMaterialSlots)
+void URenderer::DrawIndexedPrimitiveComponent(UStaticMesh* InMesh, ERHIPrimitiveTopology InTopology, const TArray<FMaterialSlot>& InComponentMaterialSlots)
 {
     URenderingStatsCollector& StatsCollector = URenderingStatsCollector::GetInstance();
     
     // 디버그: StaticMesh 렌더링 통계
     
-    UINT stride = 0;
-    switch (InMesh->GetVertexType())
+    uint32 stride = GetVertexStride(InMesh->GetVertexType());
+    if (stride == 0)
     {
-    case EVertexLayoutType::PositionColor:
-        stride = sizeof(FVertexSimple);
-        break;
-    case EVertexLayoutType::PositionColorTexturNormal:
-        stride = sizeof(FVertexDynamic);
-        break;
-    case EVertexLayoutType::PositionBillBoard:
-        stride = sizeof(FBillboardVertexInfo_GPU);
-        break;
-    default:
         // Handle unknown or unsupported vertex types
         assert(false && "Unknown vertex type!");
         return; // or log an error
     }
-    UINT offset = 0;
 
-    ID3D11Buffer* VertexBuffer = InMesh->GetVertexBuffer();
-    ID3D11Buffer* IndexBuffer = InMesh->GetIndexBuffer();
-    uint32 VertexCount = InMesh->GetVertexCount();
     uint32 IndexCount = InMesh->GetIndexCount();
 
-    RHIDevice->GetDeviceContext()->IASetVertexBuffers(
-        0, 1, &VertexBuffer, &stride, &offset
-    );
-
-    RHIDevice->GetDeviceContext()->IASetIndexBuffer(
-        IndexBuffer, DXGI_FORMAT_R32_UINT, 0
-    );
-
-    RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(InTopology);
-    RHIDevice->PSSetDefaultSampler(0);
+    // 셰이더/오브젝트 상수는 호출자가 이미 바인딩했으므로 메시/머티리얼/드로우만 기록
+    ImmediateRHICommands.Reset();
+    ImmediateRHICommands.SetVertexIndexBuffers(
+        FD3D11CommandContext::MakeBufferHandle(InMesh->GetVertexBuffer()),
+        FD3D11CommandContext::MakeBufferHandle(InMesh->GetIndexBuffer()),
+        stride);
+    ImmediateRHICommands.SetPrimitiveTopology(InTopology);
+    ImmediateRHICommands.SetDefaultSampler(0);
 
     if (InMesh->HasMaterial())
     {
@@ -262,130 +282,58 @@ void URenderer::DrawIndexedPrimitiveComponent(UStaticMesh* InMesh, D3D11_PRIMITI
                     LastTexture = CurrentTexture;
                 }
                 
-                RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, &(TextureData->TextureSRV));
+                ImmediateRHICommands.SetShaderResource(0, FD3D11CommandContext::MakeTextureHandle(TextureData->TextureSRV));
             }
             
-            RHIDevice->UpdatePixelConstantBuffers(MaterialInfo, true, bHasTexture); // PSSet도 해줌
+            ImmediateRHICommands.SetPixelConstants(&MaterialInfo, bHasTexture);
             
             // DrawCall 수실행 및 통계 추가
-            RHIDevice->GetDeviceContext()->DrawIndexed(MeshGroupInfos[i].IndexCount, MeshGroupInfos[i].StartIndex, 0);
+            ImmediateRHICommands.DrawIndexed(MeshGroupInfos[i].IndexCount, MeshGroupInfos[i].StartIndex);
             StatsCollector.IncrementDrawCalls();
         }
     }
     else
     {
-        FObjMaterialInfo ObjMaterialInfo;
-        RHIDevice->UpdatePixelConstantBuffers(ObjMaterialInfo, false, false); // PSSet도 해줌
-        RHIDevice->GetDeviceContext()->DrawIndexed(IndexCount, 0, 0);
+        ImmediateRHICommands.SetPixelConstants(nullptr, false);
+        ImmediateRHICommands.DrawIndexed(IndexCount, 0);
         StatsCollector.IncrementDrawCalls();
     }
+
+    ImmediateRHICommands.Execute(GetCommandContext());
 }
 
-void URenderer::DrawIndexedPrimitiveComponent(UTextRenderComponent* Comp, D3D11_PRIMITIVE_TOPOLOGY InTopology)
-{
-    URenderingStatsCollector& StatsCollector = URenderingStatsCollector::GetInstance();
-    
-    // 디버그: TextRenderComponent 렌더링 통계
-    
-    UINT Stride = sizeof(FBillboardVertexInfo_GPU);
-    ID3D11Buffer* VertexBuff = Comp->GetStaticMesh()->GetVertexBuffer();
-    ID3D11Buffer* IndexBuff = Comp->GetStaticMesh()->GetIndexBuffer();
 
-    // 매테리얼 변경 추적
-    UMaterial* CompMaterial = Comp->GetMaterial();
-    if (LastMaterial != CompMaterial)
-    {
-        StatsCollector.IncrementMaterialChanges();
-        LastMaterial = CompMaterial;
-    }
-    
-    UShader* CompShader = CompMaterial->GetShader();
-    // 셰이더 변경 추적
-    if (LastShader != CompShader)
+void URenderer::SubmitMeshDrawCommands(const FMatrix& ViewMatrix, const FMatrix& ProjMatrix, const FVector& HighlightColor)
+{
+    if (MeshDrawCommands.IsEmpty())
     {
-        StatsCollector.IncrementShaderChanges();
-        LastShader = CompShader;
+        return;
     }
-    
-    RHIDevice->GetDeviceContext()->IASetInputLayout(CompShader->GetInputLayout());
 
-    
-    UINT offset = 0;
-    RHIDevice->GetDeviceContext()->IASetVertexBuffers(
-        0, 1, &VertexBuff, &Stride, &offset
-    );
-    RHIDevice->GetDeviceContext()->IASetIndexBuffer(
-        IndexBuff, DXGI_FORMAT_R32_UINT, 0
-    );
+    auto SortStartTime = std::chrono::high_resolution_clock::now();
+    MeshDrawCommands.Sort();
+    std::chrono::duration<float, std::milli> SortDuration = std::chrono::high_resolution_clock::now() - SortStartTime;
 
-    // 텍스처 변경 추적 (텍스처 비교)
-    UTexture* CompTexture = CompMaterial->GetTexture();
-    if (LastTexture != CompTexture)
-    {
-        StatsCollector.IncrementTextureChanges();
-        LastTexture = CompTexture;
-    }
-    
-    ID3D11ShaderResourceView* TextureSRV = CompTexture->GetShaderResourceView();
-    RHIDevice->PSSetDefaultSampler(0);
-    RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, &TextureSRV);
-    RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(InTopology);
-    RHIDevice->GetDeviceContext()->DrawIndexed(Comp->GetStaticMesh()->GetIndexCount(), 0, 0);
-    StatsCollector.IncrementDrawCalls();
-}
+    // 정렬된 커맨드를 RHI 커맨드 리스트로 기록한 뒤 현재 컨텍스트(D3D11 또는 Null)에서 실행
+    RHICommands.Reset();
+    RHICommands.SetPrimitiveTopology(ERHIPrimitiveTopology::TriangleList);
+    RHICommands.SetDefaultSampler(0);
 
+    FRHIMeshDrawBackend Backend(RHICommands, ViewMatrix, ProjMatrix, HighlightColor);
+    const FMeshDrawSubmitResult Result = MeshDrawCommands.Submit(Backend);
 
-void URenderer::DrawIndexedPrimitiveComponent(UBillboardComponent* Comp, D3D11_PRIMITIVE_TOPOLOGY InTopology)
-{
-    URenderingStatsCollector& StatsCollector = URenderingStatsCollector::GetInstance();
-    
-    // 디버그: TextRenderComponent 렌더링 통계
-    
-    UINT Stride = sizeof(FBillboardVertexInfo_GPU);
-    ID3D11Buffer* VertexBuff = Comp->GetStaticMesh()->GetVertexBuffer();
-    ID3D11Buffer* IndexBuff = Comp->GetStaticMesh()->GetIndexBuffer();
-
-    // 매테리얼 변경 추적
-    UMaterial* CompMaterial = Comp->GetMaterial();
-    if (LastMaterial != CompMaterial)
-    {
-        StatsCollector.IncrementMaterialChanges();
-        LastMaterial = CompMaterial;
-    }
-    
-    UShader* CompShader = CompMaterial->GetShader();
-    // 셰이더 변경 추적
-    if (LastShader != CompShader)
-    {
-        StatsCollector.IncrementShaderChanges();
-        LastShader = CompShader;
-    }
-    
-    RHIDevice->GetDeviceContext()->IASetInputLayout(CompShader->GetInputLayout());
+    RHICommands.Execute(GetCommandContext());
 
-    
-    UINT offset = 0;
-    RHIDevice->GetDeviceContext()->IASetVertexBuffers(
-        0, 1, &VertexBuff, &Stride, &offset
-    );
-    RHIDevice->GetDeviceContext()->IASetIndexBuffer(
-        IndexBuff, DXGI_FORMAT_R32_UINT, 0
-    );
+    URenderingStatsCollector& StatsCollector = URenderingStatsCollector::GetInstance();
+    StatsCollector.AddMeshDrawCommandStats(Result.DrawCalls, Result.ShaderChanges, Result.MaterialChanges, Result.TextureChanges);
+    StatsCollector.AddRHICommandStats(RHICommands.GetNumCommands(), RHICommands.GetUsedBytes());
+    StatsCollector.AddMeshDrawSortTime(SortDuration.count());
 
-    // 텍스처 변경 추적 (텍스처 비교)
-    UTexture* CompTexture = CompMaterial->GetTexture();
-    if (LastTexture != CompTexture)
-    {
-        StatsCollector.IncrementTextureChanges();
-        LastTexture = CompTexture;
-    }
-    
-    ID3D11ShaderResourceView* TextureSRV = CompTexture->GetShaderResourceView();
-    RHIDevice->PSSetDefaultSampler(0);
-    RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, &TextureSRV);
-    RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(InTopology);
-    RHIDevice->GetDeviceContext()->DrawIndexed(Comp->GetStaticMesh()->GetIndexCount(), 0, 0);
-    StatsCollector.IncrementDrawCalls();
+    // 이후 개별 드로우 경로의 변경 추적이 실제 바인딩 상태와 맞도록 동기화
+    // (커맨드는 머티리얼/텍스처를 핸들로만 알므로 다음 개별 드로우에서 변경으로 집계)
+    LastShader = FD3D11CommandContext::GetShader(Result.LastShader);
+    LastMaterial = nullptr;
+    LastTexture = nullptr;
 }
 
 void URenderer::SetViewModeType(EViewModeIndex ViewModeIndex)
@@ -419,6 +367,8 @@ void URenderer::EndFrame()
 {
     // 렌더링 통계 수집 종료
     URenderingStatsCollector& StatsCollector = URenderingStatsCollector::GetInstance();
+    const FConstantUploadStats ConstantStats = static_cast<D3D11RHI*>(RHIDevice)->GetConstantUploadStats();
+    StatsCollector.AddConstantUploadStats(ConstantStats.NumMaps, ConstantStats.NumUnmaps, ConstantStats.BytesUploaded);
     StatsCollector.EndFrame();
     
     // 현재 프레임 통계를 업데이트
@@ -484,14 +434,10 @@ const TArray<FLightInfo>& URenderer::GetWorldLights() const
     return WorldLights;
 }
 
-void URenderer::UpdateLightBuffer()
+void URenderer::UpdateLightBuffer(const FMatrix& ViewMatrix, const FMatrix& ProjMatrix, const FVector4& ViewportRect)
 {
-    RHIDevice->UpdateLightConstantBuffers(WorldLights);
-}
-
-void URenderer::UpdateLightBuffer(const TArray<FLightInfo>& InLights)
-{
-    RHIDevice->UpdateLightConstantBuffers(InLights);
+    LightClusters.Build(WorldLights, ViewMatrix, ProjMatrix, ViewportRect);
+    static_cast<D3D11RHI*>(RHIDevice)->UpdateClusteredLightBuffers(LightClusters);
 }
 
 void URenderer::SetFXAAEnabled(bool bEnabled)
@@ -566,123 +512,62 @@ void URenderer::EndSceneRendering()
 
 void URenderer::InitializeLineBatch()
 {
-    // Create UDynamicMesh for efficient line batching
-    DynamicLineMesh = UResourceManager::GetInstance().Load<ULineDynamicMesh>("Line");
-    
-    // Initialize with maximum capacity (MAX_LINES * 2 vertices, MAX_LINES * 2 indices)
-    uint32 maxVertices = MAX_LINES * 2;
-    uint32 maxIndices = MAX_LINES * 2;
-    DynamicLineMesh->Load(maxVertices, maxIndices, RHIDevice->GetDevice());
-
-    // Create FMeshData for accumulating line data
-    LineBatchData = new FMeshData();
-    
     // Load line shader
     LineShader = UResourceManager::GetInstance().Load<UShader>("ShaderLine.hlsl");
 }
 
 void URenderer::BeginLineBatch()
 {
-    if (!LineBatchData) return;
-    
     bLineBatchActive = true;
-    
-    // Clear previous batch data
-    LineBatchData->Vertices.clear();
-    LineBatchData->Color.clear();
-    LineBatchData->Indices.clear();
+
+    // Clear previous transient lines (Persistent 라인은 유지)
+    LineBatcher.ResetTransient();
 }
 
-void URenderer::AddLine(const FVector& Start, const FVector& End, const FVector4& Color)
+void URenderer::AddLine(const FVector& Start, const FVector& End, const FVector4& Color, ELineBatchCategory Category)
 {
-    if (!bLineBatchActive || !LineBatchData) return;
-    
-    uint32 startIndex = static_cast<uint32>(LineBatchData->Vertices.size());
-    
-    // Add vertices
-    LineBatchData->Vertices.push_back(Start);
-    LineBatchData->Vertices.push_back(End);
-    
-    // Add colors
-    LineBatchData->Color.push_back(Color);
-    LineBatchData->Color.push_back(Color);
-    
-    // Add indices for line (2 vertices per line)
-    LineBatchData->Indices.push_back(startIndex);
-    LineBatchData->Indices.push_back(startIndex + 1);
+    // Persistent 라인은 배치 구간 밖에서도 추가 가능
+    if (!bLineBatchActive && Category == ELineBatchCategory::Transient) return;
+
+    LineBatcher.AddLine(Start, End, Color, Category);
 }
 
-void URenderer::AddLines(const TArray<FVector>& StartPoints, const TArray<FVector>& EndPoints, const TArray<FVector4>& Colors)
+void URenderer::AddLines(const TArray<FVector>& StartPoints, const TArray<FVector>& EndPoints, const TArray<FVector4>& Colors, ELineBatchCategory Category)
 {
-    if (!bLineBatchActive || !LineBatchData) return;
-    
-    // Validate input arrays have same size
-    if (StartPoints.size() != EndPoints.size() || StartPoints.size() != Colors.size())
-        return;
-    
-    uint32 startIndex = static_cast<uint32>(LineBatchData->Vertices.size());
-    
-    // Reserve space for efficiency
-    size_t lineCount = StartPoints.size();
-    LineBatchData->Vertices.reserve(LineBatchData->Vertices.size() + lineCount * 2);
-    LineBatchData->Color.reserve(LineBatchData->Color.size() + lineCount * 2);
-    LineBatchData->Indices.reserve(LineBatchData->Indices.size() + lineCount * 2);
-    
-    // Add all lines at once
-    for (size_t i = 0; i < lineCount; ++i)
-    {
-        uint32 currentIndex = startIndex + static_cast<uint32>(i * 2);
-        
-        // Add vertices
-        LineBatchData->Vertices.push_back(StartPoints[i]);
-        LineBatchData->Vertices.push_back(EndPoints[i]);
-        
-        // Add colors
-        LineBatchData->Color.push_back(Colors[i]);
-        LineBatchData->Color.push_back(Colors[i]);
-        
-        // Add indices for line (2 vertices per line)
-        LineBatchData->Indices.push_back(currentIndex);
-        LineBatchData->Indices.push_back(currentIndex + 1);
-    }
+    if (!bLineBatchActive && Category == ELineBatchCategory::Transient) return;
+
+    LineBatcher.AddLines(StartPoints, EndPoints, Colors, Category);
+}
+
+void URenderer::AddBoxes(std::span<const FBound> Boxes, const FVector4& Color, ELineBatchCategory Category)
+{
+    if (!bLineBatchActive && Category == ELineBatchCategory::Transient) return;
+
+    LineBatcher.AddBoxes(Boxes, Color, Category);
 }
 
 void URenderer::EndLineBatch(const FMatrix& ModelMatrix, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix)
 {
-    if (!bLineBatchActive || !LineBatchData || !DynamicLineMesh || LineBatchData->Vertices.empty())
+    if (!bLineBatchActive || LineBatcher.IsEmpty() || !LineShader)
     {
         bLineBatchActive = false;
         return;
     }
-    
-    // Efficiently update dynamic mesh data (no buffer recreation!)
-    if (!DynamicLineMesh->UpdateData(LineBatchData, RHIDevice->GetDeviceContext()))
-    {
-        bLineBatchActive = false;
-        return;
-    } 
+
     // Set up rendering state
     UpdateConstantBuffer(ModelMatrix, ViewMatrix, ProjectionMatrix);
     PrepareShader(LineShader);
-    
-    // Render using dynamic mesh
-    if (DynamicLineMesh->GetCurrentVertexCount() > 0 && DynamicLineMesh->GetCurrentIndexCount() > 0)
+
+    // 바뀐 청크만 업로드하고 청크마다 Draw
+    const uint32 NumDraws = LineBatcher.Draw(RHIDevice->GetDevice(), RHIDevice->GetDeviceContext());
+
+    // 라인 렌더링에 대한 DrawCall 통계 추가
+    URenderingStatsCollector& StatsCollector = URenderingStatsCollector::GetInstance();
+    for (uint32 i = 0; i < NumDraws; ++i)
     {
-        UINT stride = sizeof(FVertexSimple);
-        UINT offset = 0;
-        
-        ID3D11Buffer* vertexBuffer = DynamicLineMesh->GetVertexBuffer();
-        ID3D11Buffer* indexBuffer = DynamicLineMesh->GetIndexBuffer();
-        
-        RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &vertexBuffer, &stride, &offset);
-        RHIDevice->GetDeviceContext()->IASetIndexBuffer(indexBuffer, DXGI_FORMAT_R32_UINT, 0);
-        RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
-        RHIDevice->GetDeviceContext()->DrawIndexed(DynamicLineMesh->GetCurrentIndexCount(), 0, 0);
-        
-        // 라인 렌더링에 대한 DrawCall 통계 추가
-        URenderingStatsCollector::GetInstance().IncrementDrawCalls();
+        StatsCollector.IncrementDrawCalls();
     }
-    
+
     bLineBatchActive = false;
 }
 
@@ -695,13 +580,14 @@ void URenderer::ResetRenderStateTracking()
 
 void URenderer::ClearLineBatch()
 {
-    if (!LineBatchData) return;
-    
-    LineBatchData->Vertices.clear();
-    LineBatchData->Color.clear();
-    LineBatchData->Indices.clear();
-    
+    LineBatcher.ResetTransient();
+
     bLineBatchActive = false;
 }
 
+void URenderer::ClearPersistentLines()
+{
+    LineBatcher.ClearPersistent();
+}
+
 
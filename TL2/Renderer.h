@@ -1,7 +1,14 @@
 ﻿#pragma once
 #include "BillboardComponent.h"
 #include "RHIDevice.h"
-#include "LineDynamicMesh.h"
+#include "LineBatcher.h"
+#include "MeshDrawCommand.h"
+#include "D3D11CommandContext.h"
+#include "NullRHICommandContext.h"
+#include "ClusteredLightCulling.h"
+#include "TextBatcher.h"
+#include "BillboardBatcher.h"
+#include "TranslucentQueue.h"
 
 class UStaticMeshComponent;
 class UTextRenderComponent;
@@ -49,6 +56,12 @@ public:
 
     void UpdateInvWorldBuffer(const FMatrix& InvWorldMatrix, const FMatrix& InvViewProjMatrix);
 
+    // 여러 오브젝트의 모델 행렬을 프레임 상수 링에 Map 한 번으로 기록 (링 미지원/용량 부족이면 false → UpdateConstantBuffer 사용)
+    bool UploadModelConstants(const TArray<FMatrix>& ModelMatrices, TArray<FConstantSlice>& OutSlices);
+
+    // UploadModelConstants로 올린 슬라이스를 b0에 오프셋 바인딩
+    void BindModelConstants(const FConstantSlice& Slice, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix);
+
     void UpdateViewportBuffer(float StartX, float StartY, float SizeX, float SizeY);
 
     void UpdateViewportBuffer(float ViewportX, float ViewportY, float ViewportWidth, float ViewportHeight, float ScreenWidth, float ScreenHeight);
@@ -63,23 +76,45 @@ public:
 
     void UpdateCopyShaderViewportBuffer(float ViewportX, float ViewportY, float ViewportWidth, float ViewportHeight, float ScreenWidth, float ScreenHeight);
 
-    void DrawIndexedPrimitiveComponent(UStaticMesh* InMesh, D3D11_PRIMITIVE_TOPOLOGY InTopology, const TArray<FMaterialSlot>& InComponentMaterialSlots);
+    // 정렬 커맨드를 거치지 않는 메시(기즈모 등)도 RHI 커맨드 리스트에 기록해 현재 컨텍스트에서 바로 실행
+    void DrawIndexedPrimitiveComponent(UStaticMesh* InMesh, ERHIPrimitiveTopology InTopology, const TArray<FMaterialSlot>& InComponentMaterialSlots);
 
     void UpdateUVScroll(const FVector2D& Speed, float TimeSec);
 
     void UpdateHeatConstantBuffer(const FHeatInfo& HeatCB);
 
-    void DrawIndexedPrimitiveComponent(UTextRenderComponent* Comp, D3D11_PRIMITIVE_TOPOLOGY InTopology);
-    void DrawIndexedPrimitiveComponent(UBillboardComponent* Comp,
-                                       D3D11_PRIMITIVE_TOPOLOGY InTopology);
 
     void SetViewModeType(EViewModeIndex ViewModeIndex);
-    // Batch Line Rendering System
+
+    // 정렬 드로우 커맨드: 뷰마다 Reset → 기록 → Submit
+    FMeshDrawCommandList& GetMeshDrawCommands() { return MeshDrawCommands; }
+    void SubmitMeshDrawCommands(const FMatrix& ViewMatrix, const FMatrix& ProjMatrix, const FVector& HighlightColor);
+
+    // RHI 커맨드 실행 대상 교체 (nullptr이면 기본 D3D11 컨텍스트)
+    // - 정적 메시 패스와 DrawIndexedPrimitiveComponent가 커맨드 리스트를 거치므로 Null 컨텍스트에서는 메시만 그려지지 않고 호출 수가 집계됨 (콘솔 RHI NULL)
+    void SetCommandContext(IRHICommandContext* InContext) { CommandContextOverride = InContext; }
+    IRHICommandContext& GetCommandContext() { return CommandContextOverride ? *CommandContextOverride : D3D11CommandContext; }
+    FNullRHICommandContext& GetNullCommandContext() { return NullCommandContext; }
+    const FRHICommandList& GetRHICommands() const { return RHICommands; }
+
+    // 텍스트 라벨: FTranslucentQueue가 정렬된 구간마다 Add 후 Flush
+    FTextBatcher& GetTextBatcher() { return TextBatcher; }
+
+    // 빌보드/에디터 아이콘: FTranslucentQueue가 정렬된 구간마다 Add 후 Flush
+    FBillboardBatcher& GetBillboardBatcher() { return BillboardBatcher; }
+
+    // 반투명 큐: 텍스트/빌보드/데칼을 뷰마다 모아 불투명 이후 뒤→앞으로 제출
+    FTranslucentQueue& GetTranslucentQueue() { return TranslucentQueue; }
+
+    // Batch Line Rendering System (청크 단위로 늘어나며 바뀐 청크만 업로드)
     void BeginLineBatch();
-    void AddLine(const FVector& Start, const FVector& End, const FVector4& Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f));
-    void AddLines(const TArray<FVector>& StartPoints, const TArray<FVector>& EndPoints, const TArray<FVector4>& Colors);
+    void AddLine(const FVector& Start, const FVector& End, const FVector4& Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f), ELineBatchCategory Category = ELineBatchCategory::Transient);
+    void AddLines(const TArray<FVector>& StartPoints, const TArray<FVector>& EndPoints, const TArray<FVector4>& Colors, ELineBatchCategory Category = ELineBatchCategory::Transient);
+    void AddBoxes(std::span<const FBound> Boxes, const FVector4& Color, ELineBatchCategory Category = ELineBatchCategory::Transient);
     void EndLineBatch(const FMatrix& ModelMatrix, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix);
     void ClearLineBatch();
+    // 여러 프레임 유지되는 디버그 라인(옥트리/BVH 시각화 등) 제거
+    void ClearPersistentLines();
 
 	void EndFrame();
 
@@ -90,8 +125,9 @@ public:
     // Lighting: per-frame visible lights cache and upload
     void SetWorldLights(const TArray<FLightInfo>& InLights);
     const TArray<FLightInfo>& GetWorldLights() const;
-    void UpdateLightBuffer();
-    void UpdateLightBuffer(const TArray<FLightInfo>& InLights);
+    // 월드 라이트를 이 뷰의 클러스터에 배정하고 GPU 버퍼(b9, t10~t12)를 갱신
+    void UpdateLightBuffer(const FMatrix& ViewMatrix, const FMatrix& ProjMatrix, const FVector4& ViewportRect);
+    const FClusteredLightCulling& GetLightClusters() const { return LightClusters; }
      
     // Anti-aliasing toggles
     void SetFXAAEnabled(bool bEnabled);
@@ -117,12 +153,10 @@ public:
 private:
     URHIDevice* RHIDevice;
 
-    // Batch Line Rendering System using UDynamicMesh for efficiency
-    ULineDynamicMesh* DynamicLineMesh = nullptr;
-    FMeshData* LineBatchData = nullptr;
+    // Batch Line Rendering System
+    FLineBatcher LineBatcher;
     UShader* LineShader = nullptr;
     bool bLineBatchActive = false;
-    static const uint32 MAX_LINES = 10000;  // Maximum lines per batch
     
     // 렌더링 통계를 위한 상태 추적
     UMaterial* LastMaterial = nullptr;
@@ -140,8 +174,27 @@ private:
     void InitializeLineBatch();
     void ResetRenderStateTracking();
 
+    // 정적 메시 섹션 커맨드 (정렬 후 중복 바인딩 없이 제출)
+    FMeshDrawCommandList MeshDrawCommands;
+
+    // 드로우 제출은 커맨드 리스트에 기록 후 컨텍스트에서 실행
+    FRHICommandList RHICommands;
+    FRHICommandList ImmediateRHICommands;	// DrawIndexedPrimitiveComponent 한 번 분량 (기록 직후 실행)
+    FD3D11CommandContext D3D11CommandContext;
+    FNullRHICommandContext NullCommandContext;
+    IRHICommandContext* CommandContextOverride = nullptr;
+
+    // 모든 텍스트 라벨이 공유하는 글리프 배처
+    FTextBatcher TextBatcher;
+
+    // 모든 빌보드 스프라이트가 공유하는 배처
+    FBillboardBatcher BillboardBatcher;
+
+    FTranslucentQueue TranslucentQueue;
+
     // Visible Light
     TArray<FLightInfo> WorldLights;
+    FClusteredLightCulling LightClusters;
 
     // 마지막 설정된 FXAA 파라미터 캐싱
     struct FFXAAParams
@@ -177,6 +177,17 @@ void URenderingStatsCollector::CalculateAverageStats()
         AverageStats.TranslucentPassDrawCalls += Frame.TranslucentPassDrawCalls;
         AverageStats.DebugPassDrawCalls += Frame.DebugPassDrawCalls;
         AverageStats.TotalRenderTime += Frame.TotalRenderTime;
+        AverageStats.FrustumCulledActors += Frame.FrustumCulledActors;
+        AverageStats.FrustumCullTime += Frame.FrustumCullTime;
+        AverageStats.OcclusionCulledPrimitives += Frame.OcclusionCulledPrimitives;
+        AverageStats.OccluderTriangles += Frame.OccluderTriangles;
+        AverageStats.OcclusionCullTime += Frame.OcclusionCullTime;
+        AverageStats.SortTime += Frame.SortTime;
+        AverageStats.RHICommands += Frame.RHICommands;
+        AverageStats.RHICommandBytes += Frame.RHICommandBytes;
+        AverageStats.ConstantBufferMaps += Frame.ConstantBufferMaps;
+        AverageStats.ConstantBufferUnmaps += Frame.ConstantBufferUnmaps;
+        AverageStats.ConstantBytesUploaded += Frame.ConstantBytesUploaded;
     }
     
     // 평균 계산
@@ -190,4 +201,15 @@ void URenderingStatsCollector::CalculateAverageStats()
     AverageStats.TranslucentPassDrawCalls = static_cast<uint32>(AverageStats.TranslucentPassDrawCalls * InvCount);
     AverageStats.DebugPassDrawCalls = static_cast<uint32>(AverageStats.DebugPassDrawCalls * InvCount);
     AverageStats.TotalRenderTime *= InvCount;
+    AverageStats.FrustumCulledActors = static_cast<uint32>(AverageStats.FrustumCulledActors * InvCount);
+    AverageStats.FrustumCullTime *= InvCount;
+    AverageStats.OcclusionCulledPrimitives = static_cast<uint32>(AverageStats.OcclusionCulledPrimitives * InvCount);
+    AverageStats.OccluderTriangles = static_cast<uint32>(AverageStats.OccluderTriangles * InvCount);
+    AverageStats.OcclusionCullTime *= InvCount;
+    AverageStats.SortTime *= InvCount;
+    AverageStats.RHICommands = static_cast<uint32>(AverageStats.RHICommands * InvCount);
+    AverageStats.RHICommandBytes = static_cast<uint32>(AverageStats.RHICommandBytes * InvCount);
+    AverageStats.ConstantBufferMaps = static_cast<uint32>(AverageStats.ConstantBufferMaps * InvCount);
+    AverageStats.ConstantBufferUnmaps = static_cast<uint32>(AverageStats.ConstantBufferUnmaps * InvCount);
+    AverageStats.ConstantBytesUploaded = static_cast<uint32>(AverageStats.ConstantBytesUploaded * InvCount);
 }
\ No newline at end of file
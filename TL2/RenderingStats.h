@@ -20,11 +20,28 @@ struct FRenderingStats
     // 성능 통계
     float TotalRenderTime = 0.0f;      // ms (전체 프레임 시간)
     // float BasePassTime = 0.0f;         // ms (미사용 - RenderPass 시스템 미구현)
-    // float SortTime = 0.0f;             // ms (미사용 - DrawCall 정렬 미구현)
+    float SortTime = 0.0f;             // ms (정적 메시 드로우 커맨드 정렬)
 
     // 피킹 시간 통계
     float PickingTime = 0.0f;
 
+    // Frustum Culling 통계 (모든 뷰포트 합계)
+    uint32 FrustumCulledActors = 0;
+    float FrustumCullTime = 0.0f;      // ms
+
+    // Software Occlusion Culling 통계 (모든 뷰포트 합계)
+    uint32 OcclusionCulledPrimitives = 0;
+    uint32 OccluderTriangles = 0;
+    float OcclusionCullTime = 0.0f;    // ms
+
+    // RHI 커맨드 리스트 통계 (기록된 커맨드 수 / 아레나 사용량)
+    uint32 RHICommands = 0;
+    uint32 RHICommandBytes = 0;
+
+    // 상수 버퍼 업로드 통계 (Map/Unmap 횟수, 업로드 바이트)
+    uint32 ConstantBufferMaps = 0;
+    uint32 ConstantBufferUnmaps = 0;
+    uint32 ConstantBytesUploaded = 0;
 
     void Reset()
     {
@@ -38,8 +55,18 @@ struct FRenderingStats
         DebugPassDrawCalls = 0;
         TotalRenderTime = 0.0f;
         PickingTime = 0.0f;
+        FrustumCulledActors = 0;
+        FrustumCullTime = 0.0f;
+        OcclusionCulledPrimitives = 0;
+        OccluderTriangles = 0;
+        OcclusionCullTime = 0.0f;
+        RHICommands = 0;
+        RHICommandBytes = 0;
+        ConstantBufferMaps = 0;
+        ConstantBufferUnmaps = 0;
+        ConstantBytesUploaded = 0;
         // BasePassTime = 0.0f;
-        // SortTime = 0.0f;
+        SortTime = 0.0f;
     }
 };
 
@@ -113,8 +140,58 @@ public:
         if (bEnabled) CurrentFrameStats.TranslucentPassDrawCalls++;
     }
 
+    void AddTranslucentPassDrawCalls(uint32 InDrawCalls)
+    {
+        if (bEnabled) CurrentFrameStats.TranslucentPassDrawCalls += InDrawCalls;
+    }
+
     void IncrementDebugPassDrawCalls() { if (bEnabled) CurrentFrameStats.DebugPassDrawCalls++; }
 
+    void AddFrustumCullStats(uint32 InCulledActors, float InCullTimeMs)
+    {
+        if (!bEnabled) return;
+        CurrentFrameStats.FrustumCulledActors += InCulledActors;
+        CurrentFrameStats.FrustumCullTime += InCullTimeMs;
+    }
+
+    void AddOcclusionCullStats(uint32 InCulledPrimitives, uint32 InOccluderTriangles, float InCullTimeMs)
+    {
+        if (!bEnabled) return;
+        CurrentFrameStats.OcclusionCulledPrimitives += InCulledPrimitives;
+        CurrentFrameStats.OccluderTriangles += InOccluderTriangles;
+        CurrentFrameStats.OcclusionCullTime += InCullTimeMs;
+    }
+
+    void AddMeshDrawCommandStats(uint32 InDrawCalls, uint32 InShaderChanges, uint32 InMaterialChanges, uint32 InTextureChanges)
+    {
+        if (!bEnabled) return;
+        CurrentFrameStats.TotalDrawCalls += InDrawCalls;
+        CurrentFrameStats.ShaderChanges += InShaderChanges;
+        CurrentFrameStats.MaterialChanges += InMaterialChanges;
+        CurrentFrameStats.TextureChanges += InTextureChanges;
+    }
+
+    void AddMeshDrawSortTime(float InSortTimeMs)
+    {
+        if (!bEnabled) return;
+        CurrentFrameStats.SortTime += InSortTimeMs;
+    }
+
+    void AddRHICommandStats(uint32 InNumCommands, uint64 InUsedBytes)
+    {
+        if (!bEnabled) return;
+        CurrentFrameStats.RHICommands += InNumCommands;
+        CurrentFrameStats.RHICommandBytes += static_cast<uint32>(InUsedBytes);
+    }
+
+    void AddConstantUploadStats(uint32 InNumMaps, uint32 InNumUnmaps, uint64 InBytesUploaded)
+    {
+        if (!bEnabled) return;
+        CurrentFrameStats.ConstantBufferMaps += InNumMaps;
+        CurrentFrameStats.ConstantBufferUnmaps += InNumUnmaps;
+        CurrentFrameStats.ConstantBytesUploaded += static_cast<uint32>(InBytesUploaded);
+    }
+
     // 통계 접근
     const FRenderingStats& GetCurrentFrameStats() const { return CurrentFrameStats; }
     const FRenderingStats& GetAverageStats() const { return AverageStats; }
@@ -125,6 +202,19 @@ public:
     uint64_t GetNumPickingAttempts() const;
     double GetAccumulatedPickingTime() const;
 
+    // 호버/피킹 결과 캐시 적중률
+    void AddPickingCacheLookup(bool bHit)
+    {
+        ++PickingCacheLookups;
+        if (bHit) ++PickingCacheHits;
+    }
+    uint64 GetPickingCacheLookups() const { return PickingCacheLookups; }
+    uint64 GetPickingCacheHits() const { return PickingCacheHits; }
+    float GetPickingCacheHitRate() const
+    {
+        return PickingCacheLookups > 0 ? static_cast<float>(PickingCacheHits) / static_cast<float>(PickingCacheLookups) : 0.0f;
+    }
+
     // 설정
     void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
     bool IsEnabled() const { return bEnabled; }
@@ -171,6 +261,8 @@ private:
     double   LastPickingTimeMs;        // 가장 마지막 피킹 시간
     uint64 NumPickingAttempts;       // 누적 피킹 시도 횟수
     double   AccumulatedPickingTimeMs; // 누적 피킹 시간
+    uint64 PickingCacheLookups = 0;
+    uint64 PickingCacheHits = 0;
 
     // 타이머 시스템
     std::chrono::high_resolution_clock::time_point FrameStartTime;
@@ -389,6 +389,13 @@ void UResourceManager::InitShaderILMap()
     ShaderToInputLayoutMap["Fireball.hlsl"] = layout;
     ShaderToInputLayoutMap["DecalShader.hlsl"] = layout;
     ShaderToInputLayoutMap["ProjectionDecal.hlsl"] = layout;
+
+    // 인스턴싱: 슬롯 1에 인스턴스마다 월드 행렬 (float4 x 4)
+    layout.Add({ "INSTANCEWORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+    layout.Add({ "INSTANCEWORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+    layout.Add({ "INSTANCEWORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 32, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+    layout.Add({ "INSTANCEWORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 48, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+    ShaderToInputLayoutMap["StaticMeshInstanced.hlsl"] = layout;
     layout.clear();
 
     layout.Add({ "WORLDPOSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 });
@@ -396,6 +403,7 @@ void UResourceManager::InitShaderILMap()
     layout.Add({ "UVRECT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 });
     ShaderToInputLayoutMap["TextBillboard.hlsl"] = layout;
     ShaderToInputLayoutMap["Billboard.hlsl"] = layout;
+    ShaderToInputLayoutMap["BillboardBatch.hlsl"] = layout;
     layout.clear();
 
     layout.Add({ "WORLDPOSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 });
@@ -77,6 +77,17 @@ void SViewportWindow::OnRender()
 	if (ViewportClient)
 	{
 		ViewportClient->Draw(Viewport);
+
+		// 드래그 중인 마퀴 선택 사각형
+		FVector2D MarqueeStart, MarqueeEnd;
+		if (ViewportClient->GetMarqueeRect(MarqueeStart, MarqueeEnd))
+		{
+			const ImVec2 RectMin(Rect.Left + std::min(MarqueeStart.X, MarqueeEnd.X), Rect.Top + std::min(MarqueeStart.Y, MarqueeEnd.Y));
+			const ImVec2 RectMax(Rect.Left + std::max(MarqueeStart.X, MarqueeEnd.X), Rect.Top + std::max(MarqueeStart.Y, MarqueeEnd.Y));
+			ImDrawList* DrawList = ImGui::GetForegroundDrawList();
+			DrawList->AddRectFilled(RectMin, RectMax, IM_COL32(80, 140, 255, 40));
+			DrawList->AddRect(RectMin, RectMax, IM_COL32(80, 140, 255, 200));
+		}
 	}
 	
 	Viewport->EndRenderFrame();
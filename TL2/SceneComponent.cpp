@@ -94,19 +94,20 @@ FTransform USceneComponent::GetWorldTransform() const
 }
 void USceneComponent::SetWorldTransform(const FTransform& W)
 {
-    if (AttachParent)
-    {
-        const FTransform ParentWorld = AttachParent->GetWorldTransform();
-        RelativeTransform = ParentWorld.Inverse() * W;
-    }
-    else
+    const FTransform NewRelative = AttachParent ? AttachParent->GetWorldTransform().Inverse() * W : W;
+
+    // 매 프레임 같은 값을 다시 설정하는 경우(기즈모 추적, 직교 카메라 등)는 변경 통지 생략
+    if (IsSameTransform(NewRelative, RelativeTransform))
     {
-        RelativeTransform = W;
+        return;
     }
+    RelativeTransform = NewRelative;
 
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
+
+    NotifyTransformChanged();
 }
  
 void USceneComponent::SetWorldLocation(const FVector& L)
@@ -260,9 +261,38 @@ void USceneComponent::DetachFromParent(bool bKeepWorld)
 // ──────────────────────────────
 // 내부 유틸
 // ──────────────────────────────
+bool USceneComponent::IsSameTransform(const FTransform& A, const FTransform& B)
+{
+    // 오차 허용 비교(FVector::operator==)가 아니라 비트 단위로 같은 값인지 확인
+    return A.Translation.X == B.Translation.X && A.Translation.Y == B.Translation.Y && A.Translation.Z == B.Translation.Z
+        && A.Rotation.X == B.Rotation.X && A.Rotation.Y == B.Rotation.Y && A.Rotation.Z == B.Rotation.Z && A.Rotation.W == B.Rotation.W
+        && A.Scale3D.X == B.Scale3D.X && A.Scale3D.Y == B.Scale3D.Y && A.Scale3D.Z == B.Scale3D.Z;
+}
+
 void USceneComponent::UpdateRelativeTransform()
 {
-    RelativeTransform = FTransform(RelativeLocation, RelativeRotation, RelativeScale);
+    const FTransform NewRelative(RelativeLocation, RelativeRotation, RelativeScale);
+    if (IsSameTransform(NewRelative, RelativeTransform))
+    {
+        return;
+    }
+    RelativeTransform = NewRelative;
+    NotifyTransformChanged();
+}
+
+void USceneComponent::NotifyTransformChanged()
+{
+    if (!Owner)
+    {
+        return;
+    }
+
+    Owner->BumpTransformVersion();
+
+    if (UWorld* World = Owner->GetWorld())
+    {
+        World->MarkActorBoundsDirty(Owner);
+    }
 }
 
 // Duplicate function
@@ -311,8 +341,6 @@ void USceneComponent::DuplicateSubObjects()
         USceneComponent* Child = Cast<USceneComponent>(Component->Duplicate());
         Child->AttachParent = this;
 
-        UE_LOG("Child Name is %s", Child->GetName().c_str());
-
         DuplicatedChildren.push_back(Child);
     }
     AttachChildren = DuplicatedChildren;
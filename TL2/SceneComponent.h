@@ -88,6 +88,10 @@ public:
 protected:
     void UpdateRelativeTransform();
 
+    // 트랜스폼 변경을 월드에 알림 (BVH 바운드 Refit 예약)
+    void NotifyTransformChanged();
+    static bool IsSameTransform(const FTransform& A, const FTransform& B);
+
     // Duplicate 헬퍼: 공통 속성 복사 (Transform, AttachChildren)
     void CopyCommonProperties(USceneComponent* Target);
 
@@ -0,0 +1,302 @@
+﻿#include "pch.h"
+#include "SceneVisibility.h"
+#include "BVH.h"
+#include "Frustum.h"
+#include "TaskSystem.h"
+#include "PrimitiveComponent.h"
+#include "StaticMeshComponent.h"
+#include "TextRenderComponent.h"
+#include "DecalComponent.h"
+#include "HeightFogComponent.h"
+#include "StaticMesh.h"
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+	// 오클루더 선택 기준
+	constexpr int32 MaxOccluders = 16;
+	constexpr int32 MaxOccluderTriangles = 4096;
+	constexpr float MinOccluderScreenArea =
+		FSoftwareOcclusionBuffer::Width * FSoftwareOcclusionBuffer::Height * 0.02f; // 화면의 2%
+
+	struct FOcclusionCandidate
+	{
+		int32 PrimitiveIndex;
+		FBound Bounds;
+		float ScreenArea;
+		bool bIsOccluder;
+	};
+}
+
+void FSceneVisibility::BeginFrame(const TArray<AActor*>& LevelActors)
+{
+	NumViews = 0;
+	GatherSceneLists(LevelActors);
+}
+
+void FSceneVisibility::EndFrame()
+{
+	NumViews = 0;
+	bSceneListsValid = false;
+}
+
+void FSceneVisibility::AddView(FViewport* Viewport, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix)
+{
+	if (NumViews >= Views.Num())
+	{
+		Views.Add(std::make_unique<FViewVisibility>());
+	}
+
+	FViewVisibility& View = *Views[NumViews++];
+	View.Viewport = Viewport;
+	View.ViewMatrix = ViewMatrix;
+	View.ProjectionMatrix = ProjectionMatrix;
+}
+
+void FSceneVisibility::ComputeViews(const FBVH* BVH, const TArray<AActor*>& LevelActors)
+{
+	FTaskSystem::GetInstance().ParallelFor(NumViews, [&](int32 ViewIndex)
+	{
+		ComputeView(*Views[ViewIndex], BVH, LevelActors);
+	});
+}
+
+const FViewVisibility* FSceneVisibility::FindView(const FViewport* Viewport, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix) const
+{
+	for (int32 i = 0; i < NumViews; ++i)
+	{
+		const FViewVisibility& View = *Views[i];
+		if (View.Viewport == Viewport &&
+			std::memcmp(&View.ViewMatrix, &ViewMatrix, sizeof(FMatrix)) == 0 &&
+			std::memcmp(&View.ProjectionMatrix, &ProjectionMatrix, sizeof(FMatrix)) == 0)
+		{
+			return &View;
+		}
+	}
+	return nullptr;
+}
+
+const FViewVisibility& FSceneVisibility::ComputeViewImmediate(FViewport* Viewport, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix,
+	const FBVH* BVH, const TArray<AActor*>& LevelActors)
+{
+	AddView(Viewport, ViewMatrix, ProjectionMatrix);
+	FViewVisibility& View = *Views[NumViews - 1];
+	ComputeView(View, BVH, LevelActors);
+	return View;
+}
+
+void FSceneVisibility::Invalidate()
+{
+	NumViews = 0;
+	bSceneListsValid = false;
+}
+
+void FSceneVisibility::EnsureSceneLists(const TArray<AActor*>& LevelActors)
+{
+	if (!bSceneListsValid)
+	{
+		GatherSceneLists(LevelActors);
+	}
+}
+
+void FSceneVisibility::GatherSceneLists(const TArray<AActor*>& LevelActors)
+{
+	Decals.clear();
+
+	for (AActor* Actor : LevelActors)
+	{
+		if (!Actor || Actor->GetActorHiddenInGame())
+			continue;
+
+		for (UActorComponent* Component : Actor->GetComponents())
+		{
+			if (UDecalComponent* DecalComp = Cast<UDecalComponent>(Component))
+			{
+				Decals.Add(DecalComp);
+			}
+		}
+	}
+
+	bSceneListsValid = true;
+}
+
+void FSceneVisibility::ComputeView(FViewVisibility& View, const FBVH* BVH, const TArray<AActor*>& LevelActors) const
+{
+	auto StartTime = std::chrono::high_resolution_clock::now();
+
+	View.VisibleActors.clear();
+	View.Primitives.clear();
+	View.Decals.clear();
+	View.CulledActorCount = 0;
+	View.OcclusionCulledCount = 0;
+	View.OccluderTriangleCount = 0;
+	View.OcclusionTimeMs = 0.0f;
+
+	// 1. BVH 계층 질의로 절두체 안의 액터 수집
+	if (BVH && BVH->GetNodeCount() > 0)
+	{
+		FFrustum ViewFrustum;
+		ViewFrustum.Update(View.ViewMatrix * View.ProjectionMatrix);
+
+		BVH->QueryFrustum(ViewFrustum, View.VisibleActors);
+		View.CulledActorCount = BVH->GetActorCount() - View.VisibleActors.Num();
+
+		// 바운드가 없는 액터는 컬링 대상이 아님
+		View.VisibleActors.Append(BVH->GetUnboundedActors());
+	}
+	else
+	{
+		View.VisibleActors.Append(LevelActors);
+	}
+
+	// 2. 컴포넌트 캐스트를 여기서 끝내고 평탄화된 드로우 목록 생성
+	for (AActor* Actor : View.VisibleActors)
+	{
+		if (!Actor || Actor->GetActorHiddenInGame())
+			continue;
+
+		for (UActorComponent* Component : Actor->GetComponents())
+		{
+			if (!Component || !Component->IsActive())
+				continue;
+
+			// Decal Component는 Editor Visuals만 렌더링
+			if (UDecalComponent* DecalComp = Cast<UDecalComponent>(Component))
+			{
+				View.Decals.Add(DecalComp);
+				continue;
+			}
+
+			if (Cast<UHeightFogComponent>(Component))
+				continue;
+
+			UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component);
+			if (!Primitive)
+				continue;
+
+			FVisiblePrimitive Item;
+			Item.Primitive = Primitive;
+			Item.Owner = Actor;
+			Item.ViewDepth = View.ViewMatrix.TransformPosition(Primitive->GetWorldLocation()).Z;
+
+			if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Primitive))
+			{
+				Item.Type = EVisiblePrimitiveType::StaticMesh;
+				Item.MeshKey = StaticMeshComp->GetStaticMesh();
+			}
+			else if (Cast<UTextRenderComponent>(Primitive))
+			{
+				Item.Type = EVisiblePrimitiveType::Text;
+			}
+
+			View.Primitives.Add(Item);
+		}
+	}
+
+	// 3. 절두체를 통과한 정적 메시 중 오클루더 뒤에 가려진 것 제거
+	if (bOcclusionCullingEnabled)
+	{
+		ApplyOcclusionCulling(View);
+	}
+
+	// 4. 정렬: 불투명은 메시별 + 앞→뒤 (Early-Z), 블렌딩 대상은 뒤→앞
+	View.Primitives.Sort([](const FVisiblePrimitive& A, const FVisiblePrimitive& B)
+	{
+		if (A.Type != B.Type)
+			return A.Type < B.Type;
+
+		if (A.Type == EVisiblePrimitiveType::Text)
+			return A.ViewDepth > B.ViewDepth;
+
+		if (A.MeshKey != B.MeshKey)
+			return A.MeshKey < B.MeshKey;
+
+		return A.ViewDepth < B.ViewDepth;
+	});
+
+	std::chrono::duration<float, std::milli> Duration = std::chrono::high_resolution_clock::now() - StartTime;
+	View.CullTimeMs = Duration.count() - View.OcclusionTimeMs;
+}
+
+void FSceneVisibility::ApplyOcclusionCulling(FViewVisibility& View)
+{
+	auto StartTime = std::chrono::high_resolution_clock::now();
+
+	if (!View.OcclusionBuffer)
+	{
+		View.OcclusionBuffer = std::make_unique<FSoftwareOcclusionBuffer>();
+	}
+	FSoftwareOcclusionBuffer& Buffer = *View.OcclusionBuffer;
+	Buffer.Begin(View.ViewMatrix * View.ProjectionMatrix);
+
+	// 1. 후보 수집: 정적 메시 프리미티브의 월드 AABB와 화면 면적
+	TArray<FOcclusionCandidate> Candidates;
+	for (int32 i = 0; i < View.Primitives.Num(); ++i)
+	{
+		const FVisiblePrimitive& Item = View.Primitives[i];
+		if (Item.Type != EVisiblePrimitiveType::StaticMesh)
+			continue;
+
+		UStaticMeshComponent* StaticMeshComp = static_cast<UStaticMeshComponent*>(Item.Primitive);
+		FOcclusionCandidate Candidate;
+		Candidate.PrimitiveIndex = i;
+		Candidate.Bounds = StaticMeshComp->GetWorldBoundingBox();
+		Candidate.ScreenArea = Buffer.GetScreenArea(Candidate.Bounds);
+		Candidate.bIsOccluder = false;
+		Candidates.Add(Candidate);
+	}
+
+	if (Candidates.Num() < 2)
+		return;
+
+	// 2. 화면을 가장 크게 덮는 후보부터 오클루더로 래스터화
+	Candidates.Sort([](const FOcclusionCandidate& A, const FOcclusionCandidate& B)
+	{
+		return A.ScreenArea > B.ScreenArea;
+	});
+
+	int32 NumOccluders = 0;
+	for (int32 i = 0; i < Candidates.Num() && NumOccluders < MaxOccluders; ++i)
+	{
+		FOcclusionCandidate& Candidate = Candidates[i];
+		if (Candidate.ScreenArea < MinOccluderScreenArea)
+			break;
+
+		UStaticMeshComponent* StaticMeshComp = static_cast<UStaticMeshComponent*>(View.Primitives[Candidate.PrimitiveIndex].Primitive);
+		UStaticMesh* StaticMesh = StaticMeshComp->GetStaticMesh();
+		FStaticMesh* MeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (!MeshAsset || MeshAsset->Indices.Num() / 3 > MaxOccluderTriangles)
+			continue;
+
+		View.OccluderTriangleCount += Buffer.RasterizeMesh(*MeshAsset, StaticMeshComp->GetWorldMatrix());
+		Candidate.bIsOccluder = true;
+		++NumOccluders;
+	}
+
+	if (NumOccluders > 0)
+	{
+		Buffer.BuildHierarchy();
+
+		// 3. 나머지 후보 검사 (오클루더 자신은 검사하지 않음)
+		for (const FOcclusionCandidate& Candidate : Candidates)
+		{
+			if (!Candidate.bIsOccluder && Buffer.IsOccluded(Candidate.Bounds))
+			{
+				View.Primitives[Candidate.PrimitiveIndex].Primitive = nullptr;
+				++View.OcclusionCulledCount;
+			}
+		}
+
+		if (View.OcclusionCulledCount > 0)
+		{
+			View.Primitives.erase(
+				std::remove_if(View.Primitives.begin(), View.Primitives.end(),
+					[](const FVisiblePrimitive& Item) { return Item.Primitive == nullptr; }),
+				View.Primitives.end());
+		}
+	}
+
+	std::chrono::duration<float, std::milli> Duration = std::chrono::high_resolution_clock::now() - StartTime;
+	View.OcclusionTimeMs = Duration.count();
+}
@@ -0,0 +1,104 @@
+﻿#pragma once
+#include <memory>
+#include "SoftwareOcclusion.h"
+
+class AActor;
+class FBVH;
+class FViewport;
+class UPrimitiveComponent;
+class UDecalComponent;
+
+// 가시 프리미티브 분류 (그리기 순서 = 값 순서)
+enum class EVisiblePrimitiveType : uint8
+{
+	StaticMesh,	// 불투명 메시: 메시별로 묶고 앞→뒤 정렬
+	Other,		// 라인/바운딩 박스 등
+	Text		// 블렌딩 사용: 뒤→앞 정렬, SF_BillboardText로 걸러냄
+};
+
+struct FVisiblePrimitive
+{
+	UPrimitiveComponent* Primitive = nullptr;
+	AActor* Owner = nullptr;
+	const void* MeshKey = nullptr;	// 같은 메시끼리 연속으로 그려 VB/IB 재바인딩을 줄임
+	float ViewDepth = 0.0f;
+	EVisiblePrimitiveType Type = EVisiblePrimitiveType::Other;
+};
+
+/**
+ * FViewVisibility
+ * - 한 뷰포트의 컬링 + 정렬 결과
+ * - 워커 스레드에서 채워지고, 메인 스레드의 드로우 제출 단계에서 읽기만 한다
+ */
+struct FViewVisibility
+{
+	FViewport* Viewport = nullptr;
+	FMatrix ViewMatrix;
+	FMatrix ProjectionMatrix;
+
+	TArray<AActor*> VisibleActors;
+	TArray<FVisiblePrimitive> Primitives;
+	TArray<UDecalComponent*> Decals;	// 보이는 액터의 데칼 (에디터 시각화용)
+
+	uint32 CulledActorCount = 0;
+	float CullTimeMs = 0.0f;
+
+	// Software Occlusion Culling (뷰마다 버퍼를 따로 두어 워커 스레드끼리 공유하지 않음)
+	std::unique_ptr<FSoftwareOcclusionBuffer> OcclusionBuffer;
+	uint32 OcclusionCulledCount = 0;
+	uint32 OccluderTriangleCount = 0;
+	float OcclusionTimeMs = 0.0f;
+};
+
+/**
+ * FSceneVisibility
+ * - 활성 뷰포트 전체의 가시성을 프레임 시작에 한 번에 계산
+ * - BVH는 계산 전에 메인 스레드에서 갱신(Flush)되고, 계산 중에는 읽기 전용으로만 접근한다
+ * - 데칼 목록은 뷰와 무관하므로 프레임당 한 번만 수집한다 (라이트는 UWorld의 FLightRegistry)
+ */
+class FSceneVisibility
+{
+public:
+	// 프레임 시작: 뷰 목록 초기화 + 레벨 전체를 한 번 훑어 데칼 수집
+	void BeginFrame(const TArray<AActor*>& LevelActors);
+	void EndFrame();
+
+	void AddView(FViewport* Viewport, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix);
+
+	// 등록된 모든 뷰를 워커 스레드에서 병렬로 컬링/정렬
+	void ComputeViews(const FBVH* BVH, const TArray<AActor*>& LevelActors);
+
+	// 같은 뷰포트/카메라 행렬로 계산된 결과가 있으면 반환 (없으면 nullptr)
+	const FViewVisibility* FindView(const FViewport* Viewport, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix) const;
+
+	// 미리 계산되지 않은 뷰를 즉시(메인 스레드) 계산해 캐시에 추가
+	const FViewVisibility& ComputeViewImmediate(FViewport* Viewport, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix,
+		const FBVH* BVH, const TArray<AActor*>& LevelActors);
+
+	// 액터 추가/삭제 등 구조 변경 시 캐시된 결과를 버림
+	void Invalidate();
+
+	// 데칼 목록이 무효화되었으면 다시 수집
+	void EnsureSceneLists(const TArray<AActor*>& LevelActors);
+
+	const TArray<UDecalComponent*>& GetDecals() const { return Decals; }
+
+	void SetOcclusionCullingEnabled(bool bEnabled) { bOcclusionCullingEnabled = bEnabled; }
+	bool IsOcclusionCullingEnabled() const { return bOcclusionCullingEnabled; }
+
+private:
+	void ComputeView(FViewVisibility& View, const FBVH* BVH, const TArray<AActor*>& LevelActors) const;
+
+	// 화면을 크게 덮는 정적 메시를 오클루더로 래스터화하고, 가려진 정적 메시를 목록에서 제거
+	static void ApplyOcclusionCulling(FViewVisibility& View);
+	void GatherSceneLists(const TArray<AActor*>& LevelActors);
+
+	// 뷰 결과는 프레임 간 재사용 (배열 재할당 방지)
+	TArray<std::unique_ptr<FViewVisibility>> Views;
+	int32 NumViews = 0;
+
+	TArray<UDecalComponent*> Decals;
+	bool bSceneListsValid = false;
+
+	bool bOcclusionCullingEnabled = true;
+};
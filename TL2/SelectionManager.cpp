@@ -12,6 +12,155 @@ USelectionManager& USelectionManager::GetInstance()
     return *Instance;
 }
 
+// ──────────────────────────────
+// FSelectionSet
+// ──────────────────────────────
+
+bool FSelectionSet::Add(AActor* Actor)
+{
+    if (!Actor || Contains(Actor)) return false;
+
+    // 부하율 1/2 초과 전에 테이블 확장
+    if ((NumActors + 1) * 2 > Slots.Num())
+    {
+        Rehash(std::max(16, Slots.Num() * 2));
+    }
+
+    const uint32 Mask = static_cast<uint32>(Slots.Num() - 1);
+    uint32 Index = HashPointer(Actor) & Mask;
+    while (Slots[Index].Actor)
+    {
+        Index = (Index + 1) & Mask;
+    }
+
+    Slots[Index].Actor = Actor;
+    Slots[Index].DenseIndex = Dense.Num();
+    Dense.Add(Actor);
+    ++NumActors;
+    return true;
+}
+
+bool FSelectionSet::Remove(AActor* Actor)
+{
+    int32 SlotIndex = FindSlot(Actor);
+    if (SlotIndex < 0) return false;
+
+    Dense[Slots[SlotIndex].DenseIndex] = nullptr;
+    ++NumHoles;
+    --NumActors;
+
+    // 백워드 시프트 삭제: 삭제 표식 없이 뒤따르는 클러스터를 당겨 탐사 체인을 유지
+    const uint32 Mask = static_cast<uint32>(Slots.Num() - 1);
+    uint32 Hole = static_cast<uint32>(SlotIndex);
+    uint32 Next = (Hole + 1) & Mask;
+    while (Slots[Next].Actor)
+    {
+        const uint32 Home = HashPointer(Slots[Next].Actor) & Mask;
+        // Home이 (Hole, Next] 구간 밖이면 Hole로 옮겨도 탐사로 찾을 수 있음
+        if (((Next - Home) & Mask) >= ((Next - Hole) & Mask))
+        {
+            Slots[Hole] = Slots[Next];
+            Hole = Next;
+        }
+        Next = (Next + 1) & Mask;
+    }
+    Slots[Hole] = FSlot();
+
+    if (NumActors == 0)
+    {
+        Dense.clear();
+        NumHoles = 0;
+    }
+    return true;
+}
+
+void FSelectionSet::Reset()
+{
+    for (FSlot& Slot : Slots)
+    {
+        Slot = FSlot();
+    }
+    Dense.clear();
+    NumHoles = 0;
+    NumActors = 0;
+}
+
+void FSelectionSet::Reserve(int32 Count)
+{
+    int32 Capacity = std::max(16, Slots.Num());
+    while (Count * 2 > Capacity)
+    {
+        Capacity *= 2;
+    }
+    if (Capacity != Slots.Num())
+    {
+        Rehash(Capacity);
+    }
+    Dense.Reserve(Count);
+}
+
+const TArray<AActor*>& FSelectionSet::GetActors() const
+{
+    if (NumHoles > 0)
+    {
+        Compact();
+    }
+    return Dense;
+}
+
+int32 FSelectionSet::FindSlot(const AActor* Actor) const
+{
+    if (!Actor || Slots.IsEmpty()) return -1;
+
+    const uint32 Mask = static_cast<uint32>(Slots.Num() - 1);
+    uint32 Index = HashPointer(Actor) & Mask;
+    while (Slots[Index].Actor)
+    {
+        if (Slots[Index].Actor == Actor)
+        {
+            return static_cast<int32>(Index);
+        }
+        Index = (Index + 1) & Mask;
+    }
+    return -1;
+}
+
+void FSelectionSet::Rehash(int32 NewCapacity) const
+{
+    // 빈 자리를 먼저 정리하면 Dense 순서 그대로 다시 넣기만 하면 됨
+    if (NumHoles > 0)
+    {
+        auto It = std::remove(Dense.begin(), Dense.end(), nullptr);
+        Dense.erase(It, Dense.end());
+        NumHoles = 0;
+    }
+
+    Slots.clear();
+    Slots.SetNum(NewCapacity);
+
+    const uint32 Mask = static_cast<uint32>(NewCapacity - 1);
+    for (int32 i = 0; i < Dense.Num(); ++i)
+    {
+        uint32 Index = HashPointer(Dense[i]) & Mask;
+        while (Slots[Index].Actor)
+        {
+            Index = (Index + 1) & Mask;
+        }
+        Slots[Index].Actor = Dense[i];
+        Slots[Index].DenseIndex = i;
+    }
+}
+
+void FSelectionSet::Compact() const
+{
+    // 용량은 그대로 두고 Dense 인덱스만 새로 매김
+    Rehash(Slots.Num());
+}
+
+// ──────────────────────────────
+// USelectionManager
+// ──────────────────────────────
+
 void USelectionManager::SelectActor(AActor* Actor)
 {
     if (!Actor) return;
@@ -24,42 +173,65 @@ void USelectionManager::SelectActor(AActor* Actor)
     
     // 새 액터 선택
     SelectedActors.Add(Actor);
+    Actor->SetIsSelected(true);
+}
+
+void USelectionManager::SelectActors(const TArray<AActor*>& Actors, bool bAddToSelection)
+{
+    if (!bAddToSelection)
+    {
+        ClearSelection();
+    }
+
+    SelectedActors.Reserve(SelectedActors.Num() + Actors.Num());
+
+    for (AActor* Actor : Actors)
+    {
+        // 이미 선택된 액터는 해시 조회 한 번으로 걸러짐
+        if (!SelectedActors.Add(Actor))
+        {
+            continue;
+        }
+
+        Actor->SetIsPicked(true);
+        Actor->SetIsSelected(true);
+    }
 }
 
 void USelectionManager::DeselectActor(AActor* Actor)
 {
     if (!Actor) return;
     
-    auto it = std::find(SelectedActors.begin(), SelectedActors.end(), Actor);
-    if (it != SelectedActors.end())
+    if (SelectedActors.Remove(Actor))
     {
-        SelectedActors.erase(it);
+        Actor->SetIsSelected(false);
     }
 }
 
 void USelectionManager::ClearSelection()
 {
-    for (AActor* Actor : SelectedActors)
+    for (AActor* Actor : SelectedActors.GetActors())
     {
         if (Actor) // null 체크 추가
         {
             Actor->SetIsPicked(false);
+            Actor->SetIsSelected(false);
         }
     }
-    SelectedActors.clear();
+    SelectedActors.Reset();
 }
 
 bool USelectionManager::IsActorSelected(AActor* Actor) const
 {
     if (!Actor) return false;
     
-    return std::find(SelectedActors.begin(), SelectedActors.end(), Actor) != SelectedActors.end();
+    return SelectedActors.Contains(Actor);
 }
 
 AActor* USelectionManager::GetSelectedActor() const
 {
     // 첫 번째 유효한 액터 연기
-    for (AActor* Actor : SelectedActors)
+    for (AActor* Actor : SelectedActors.GetActors())
     {
         if (Actor) return Actor;
     }
@@ -68,10 +240,8 @@ AActor* USelectionManager::GetSelectedActor() const
 
 void USelectionManager::CleanupInvalidActors()
 {
-    // null이거나 삭제된 액터들을 제거
-    auto it = std::remove_if(SelectedActors.begin(), SelectedActors.end(), 
-        [](AActor* Actor) { return Actor == nullptr; });
-    SelectedActors.erase(it, SelectedActors.end());
+    // 해제된 자리(DeselectActor로 비워진 Dense 슬롯)를 정리 (집합에는 null이 들어가지 않음)
+    SelectedActors.GetActors();
 }
 
 USelectionManager::USelectionManager()
@@ -6,6 +6,51 @@
 // Forward Declarations
 class AActor;
 
+/**
+ * 선택된 액터 집합
+ * - 선형 탐사(open addressing) 해시 테이블: 액터 포인터 → Dense 인덱스
+ * - Dense 배열: 선택한 순서대로 순회 (제거 시 자리를 비워 두고 읽을 때 한 번에 압축)
+ * 추가/제거/포함 검사 모두 평균 O(1)
+ */
+class FSelectionSet
+{
+public:
+    bool Add(AActor* Actor);
+    bool Remove(AActor* Actor);
+    bool Contains(const AActor* Actor) const { return FindSlot(Actor) >= 0; }
+    void Reset();
+    void Reserve(int32 Count);
+
+    int32 Num() const { return NumActors; }
+
+    // 선택 순서대로 정렬된 액터 (빈 자리가 있으면 압축 후 반환)
+    const TArray<AActor*>& GetActors() const;
+
+private:
+    struct FSlot
+    {
+        AActor* Actor = nullptr;    // nullptr이면 빈 슬롯
+        int32 DenseIndex = -1;
+    };
+
+    int32 FindSlot(const AActor* Actor) const;
+    void Rehash(int32 NewCapacity) const;
+    void Compact() const;
+
+    static uint32 HashPointer(const AActor* Actor)
+    {
+        // 할당 정렬로 하위 비트가 비어 있으므로 곱셈 해시의 상위 비트 사용
+        const uint64 Key = reinterpret_cast<uintptr_t>(Actor) >> 4;
+        return static_cast<uint32>((Key * 0x9E3779B97F4A7C15ull) >> 32);
+    }
+
+    // 압축은 const 접근(GetActors)에서도 일어나므로 mutable
+    mutable TArray<FSlot> Slots;        // 용량은 2의 거듭제곱, 부하율 1/2 이하
+    mutable TArray<AActor*> Dense;      // 제거된 자리는 nullptr
+    mutable int32 NumHoles = 0;
+    int32 NumActors = 0;
+};
+
 /**
  * SelectionManager
  * - 액터 선택 상태를 관리하는 싱글톤 클래스
@@ -19,6 +64,8 @@ public:
     
     /** === 선택 관리 === */
     void SelectActor(AActor* Actor);
+    // 여러 액터를 한 번에 선택 (마퀴 선택 결과 등). bAddToSelection이 false면 기존 선택을 대체
+    void SelectActors(const TArray<AActor*>& Actors, bool bAddToSelection = false);
     void DeselectActor(AActor* Actor);
     void ClearSelection();
     
@@ -26,7 +73,7 @@ public:
     
     /** === 선택된 액터 접근 === */
     AActor* GetSelectedActor() const; // 단일 선택용
-    const TArray<AActor*>& GetSelectedActors() const { return SelectedActors; }
+    const TArray<AActor*>& GetSelectedActors() const { return SelectedActors.GetActors(); }
     
     int32 GetSelectionCount() const { return SelectedActors.Num(); }
     bool HasSelection() const { return SelectedActors.Num() > 0; }
@@ -44,5 +91,5 @@ protected:
     USelectionManager& operator=(const USelectionManager&) = delete;
     
     /** === 선택된 액터들 === */
-    TArray<AActor*> SelectedActors;
+    FSelectionSet SelectedActors;
 };
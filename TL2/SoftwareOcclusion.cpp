@@ -0,0 +1,262 @@
+﻿#include "pch.h"
+#include "SoftwareOcclusion.h"
+#include "AABoundingBoxComponent.h"
+#include <immintrin.h>
+#include <cfloat>
+
+namespace
+{
+	// 이 값보다 w가 작은 정점은 근평면 뒤로 보고 오클루더/오클루디에서 제외
+	constexpr float MinClipW = 1e-4f;
+
+	// 동일 평면 위의 면이 서로를 가리지 않도록 주는 깊이 여유
+	constexpr float OcclusionDepthBias = 1e-5f;
+}
+
+FSoftwareOcclusionBuffer::FSoftwareOcclusionBuffer()
+{
+	Depth.SetNum(Width * Height, 1.0f);
+	TileMaxDepth.SetNum(TilesX * TilesY, 1.0f);
+}
+
+void FSoftwareOcclusionBuffer::Begin(const FMatrix& InViewProjection)
+{
+	ViewProjection = InViewProjection;
+	std::fill(Depth.begin(), Depth.end(), 1.0f);
+	std::fill(TileMaxDepth.begin(), TileMaxDepth.end(), 1.0f);
+}
+
+int32 FSoftwareOcclusionBuffer::RasterizeMesh(const FStaticMesh& Mesh, const FMatrix& WorldMatrix)
+{
+	const FMatrix WorldViewProjection = WorldMatrix * ViewProjection;
+
+	// 1. 정점 변환은 메시당 한 번만
+	ScreenVertices.SetNum(Mesh.Vertices.Num());
+	for (int32 i = 0; i < Mesh.Vertices.Num(); ++i)
+	{
+		const FVector& P = Mesh.Vertices[i].pos;
+		FVector4 Clip = FVector4(P.X, P.Y, P.Z, 1.0f) * WorldViewProjection;
+
+		if (Clip.W < MinClipW)
+		{
+			ScreenVertices[i] = FVector4(0.0f, 0.0f, 0.0f, -1.0f);
+			continue;
+		}
+
+		const float InvW = 1.0f / Clip.W;
+		ScreenVertices[i] = FVector4(
+			(Clip.X * InvW * 0.5f + 0.5f) * Width,
+			(0.5f - Clip.Y * InvW * 0.5f) * Height,
+			Clip.Z * InvW,
+			Clip.W);
+	}
+
+	// 2. 삼각형 래스터화 (근평면을 가로지르는 삼각형은 건너뜀 - 오클루더가 줄어들 뿐 결과는 보수적)
+	int32 NumTriangles = 0;
+	const int32 NumIndices = Mesh.Indices.Num() - Mesh.Indices.Num() % 3;
+	for (int32 i = 0; i < NumIndices; i += 3)
+	{
+		const FVector4& V0 = ScreenVertices[Mesh.Indices[i]];
+		const FVector4& V1 = ScreenVertices[Mesh.Indices[i + 1]];
+		const FVector4& V2 = ScreenVertices[Mesh.Indices[i + 2]];
+		if (V0.W < 0.0f || V1.W < 0.0f || V2.W < 0.0f)
+			continue;
+
+		RasterizeTriangle(V0, V1, V2);
+		++NumTriangles;
+	}
+	return NumTriangles;
+}
+
+void FSoftwareOcclusionBuffer::RasterizeTriangle(const FVector4& V0, const FVector4& V1, const FVector4& V2)
+{
+	// 화면 밖이거나 근/원평면 밖이면 무시
+	if (std::min({ V0.Z, V1.Z, V2.Z }) < 0.0f || std::max({ V0.Z, V1.Z, V2.Z }) > 1.0f)
+		return;
+
+	float Area = (V1.X - V0.X) * (V2.Y - V0.Y) - (V2.X - V0.X) * (V1.Y - V0.Y);
+	if (std::fabs(Area) < 1e-8f)
+		return;
+
+	int32 MinX = std::max(0, static_cast<int32>(std::floor(std::min({ V0.X, V1.X, V2.X }))));
+	int32 MaxX = std::min(Width - 1, static_cast<int32>(std::ceil(std::max({ V0.X, V1.X, V2.X }))));
+	int32 MinY = std::max(0, static_cast<int32>(std::floor(std::min({ V0.Y, V1.Y, V2.Y }))));
+	int32 MaxY = std::min(Height - 1, static_cast<int32>(std::ceil(std::max({ V0.Y, V1.Y, V2.Y }))));
+	if (MinX > MaxX || MinY > MaxY)
+		return;
+
+	// 감는 방향과 무관하게 내부가 양수가 되도록 부호 정리 (양면 모두 오클루더로 사용)
+	const float Sign = Area > 0.0f ? 1.0f : -1.0f;
+
+	// 에지 함수 E(x, y) = A * x + B * y + C
+	const float A0 = (V1.Y - V2.Y) * Sign, B0 = (V2.X - V1.X) * Sign, C0 = (V1.X * V2.Y - V2.X * V1.Y) * Sign;
+	const float A1 = (V2.Y - V0.Y) * Sign, B1 = (V0.X - V2.X) * Sign, C1 = (V2.X * V0.Y - V0.X * V2.Y) * Sign;
+	const float A2 = (V0.Y - V1.Y) * Sign, B2 = (V1.X - V0.X) * Sign, C2 = (V0.X * V1.Y - V1.X * V0.Y) * Sign;
+
+	// 깊이 평면 z(x, y) = Z0 + DzDx * (x - V0.X) + DzDy * (y - V0.Y)
+	const float InvArea = 1.0f / Area;
+	const float DzDx = ((V1.Z - V0.Z) * (V2.Y - V0.Y) - (V2.Z - V0.Z) * (V1.Y - V0.Y)) * InvArea;
+	const float DzDy = ((V2.Z - V0.Z) * (V1.X - V0.X) - (V1.Z - V0.Z) * (V2.X - V0.X)) * InvArea;
+	const float Z0 = V0.Z - DzDx * V0.X - DzDy * V0.Y;
+
+	// 4픽셀 단위 SSE 처리 (행 시작은 4의 배수로 정렬)
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 LaneOffset = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	const __m128 VA0 = _mm_set1_ps(A0), VA1 = _mm_set1_ps(A1), VA2 = _mm_set1_ps(A2);
+	const __m128 VDzDx = _mm_set1_ps(DzDx);
+
+	const int32 StartX = MinX & ~3;
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		const float PixelY = static_cast<float>(Y) + 0.5f;
+		const __m128 RowE0 = _mm_set1_ps(B0 * PixelY + C0);
+		const __m128 RowE1 = _mm_set1_ps(B1 * PixelY + C1);
+		const __m128 RowE2 = _mm_set1_ps(B2 * PixelY + C2);
+		const __m128 RowZ = _mm_set1_ps(DzDy * PixelY + Z0);
+
+		float* Row = Depth.data() + Y * Width;
+		for (int32 X = StartX; X <= MaxX; X += 4)
+		{
+			const __m128 PixelX = _mm_add_ps(_mm_set1_ps(static_cast<float>(X)), LaneOffset);
+
+			const __m128 E0 = _mm_add_ps(_mm_mul_ps(VA0, PixelX), RowE0);
+			const __m128 E1 = _mm_add_ps(_mm_mul_ps(VA1, PixelX), RowE1);
+			const __m128 E2 = _mm_add_ps(_mm_mul_ps(VA2, PixelX), RowE2);
+
+			__m128 Inside = _mm_and_ps(_mm_cmpge_ps(E0, Zero), _mm_cmpge_ps(E1, Zero));
+			Inside = _mm_and_ps(Inside, _mm_cmpge_ps(E2, Zero));
+			if (_mm_movemask_ps(Inside) == 0)
+				continue;
+
+			const __m128 TriZ = _mm_add_ps(_mm_mul_ps(VDzDx, PixelX), RowZ);
+			const __m128 OldZ = _mm_loadu_ps(Row + X);
+			const __m128 NewZ = _mm_min_ps(OldZ, TriZ);
+
+			// 덮인 픽셀만 갱신 (SSE2 blend)
+			const __m128 Result = _mm_or_ps(_mm_and_ps(Inside, NewZ), _mm_andnot_ps(Inside, OldZ));
+			_mm_storeu_ps(Row + X, Result);
+		}
+	}
+}
+
+void FSoftwareOcclusionBuffer::BuildHierarchy()
+{
+	for (int32 TileY = 0; TileY < TilesY; ++TileY)
+	{
+		for (int32 TileX = 0; TileX < TilesX; ++TileX)
+		{
+			__m128 MaxZ = _mm_setzero_ps();
+			for (int32 Y = 0; Y < TileSize; ++Y)
+			{
+				const float* Row = Depth.data() + (TileY * TileSize + Y) * Width + TileX * TileSize;
+				for (int32 X = 0; X < TileSize; X += 4)
+				{
+					MaxZ = _mm_max_ps(MaxZ, _mm_loadu_ps(Row + X));
+				}
+			}
+
+			alignas(16) float Lanes[4];
+			_mm_store_ps(Lanes, MaxZ);
+			TileMaxDepth[TileY * TilesX + TileX] = std::max(std::max(Lanes[0], Lanes[1]), std::max(Lanes[2], Lanes[3]));
+		}
+	}
+}
+
+bool FSoftwareOcclusionBuffer::ProjectBounds(const FBound& WorldBounds, FScreenRect& OutRect) const
+{
+	OutRect.MinX = FLT_MAX;
+	OutRect.MinY = FLT_MAX;
+	OutRect.MaxX = -FLT_MAX;
+	OutRect.MaxY = -FLT_MAX;
+	OutRect.MinZ = FLT_MAX;
+
+	for (int32 i = 0; i < 8; ++i)
+	{
+		const FVector4 Corner(
+			(i & 1) ? WorldBounds.Max.X : WorldBounds.Min.X,
+			(i & 2) ? WorldBounds.Max.Y : WorldBounds.Min.Y,
+			(i & 4) ? WorldBounds.Max.Z : WorldBounds.Min.Z,
+			1.0f);
+
+		const FVector4 Clip = Corner * ViewProjection;
+		if (Clip.W < MinClipW)
+			return false;
+
+		const float InvW = 1.0f / Clip.W;
+		const float ScreenX = (Clip.X * InvW * 0.5f + 0.5f) * Width;
+		const float ScreenY = (0.5f - Clip.Y * InvW * 0.5f) * Height;
+
+		OutRect.MinX = std::min(OutRect.MinX, ScreenX);
+		OutRect.MaxX = std::max(OutRect.MaxX, ScreenX);
+		OutRect.MinY = std::min(OutRect.MinY, ScreenY);
+		OutRect.MaxY = std::max(OutRect.MaxY, ScreenY);
+		OutRect.MinZ = std::min(OutRect.MinZ, Clip.Z * InvW);
+	}
+	return true;
+}
+
+float FSoftwareOcclusionBuffer::GetScreenArea(const FBound& WorldBounds) const
+{
+	FScreenRect Rect;
+	if (!ProjectBounds(WorldBounds, Rect))
+		return -1.0f;
+
+	const float ClampedWidth = std::clamp(Rect.MaxX, 0.0f, static_cast<float>(Width)) - std::clamp(Rect.MinX, 0.0f, static_cast<float>(Width));
+	const float ClampedHeight = std::clamp(Rect.MaxY, 0.0f, static_cast<float>(Height)) - std::clamp(Rect.MinY, 0.0f, static_cast<float>(Height));
+	return ClampedWidth * ClampedHeight;
+}
+
+bool FSoftwareOcclusionBuffer::IsOccluded(const FBound& WorldBounds) const
+{
+	FScreenRect Rect;
+	if (!ProjectBounds(WorldBounds, Rect))
+		return false;
+
+	// 근평면에 걸치면 항상 보이는 것으로 처리
+	if (Rect.MinZ <= 0.0f)
+		return false;
+
+	const int32 MinX = std::max(0, static_cast<int32>(std::floor(Rect.MinX)));
+	const int32 MaxX = std::min(Width - 1, static_cast<int32>(std::floor(Rect.MaxX)));
+	const int32 MinY = std::max(0, static_cast<int32>(std::floor(Rect.MinY)));
+	const int32 MaxY = std::min(Height - 1, static_cast<int32>(std::floor(Rect.MaxY)));
+	if (MinX > MaxX || MinY > MaxY)
+		return false;
+
+	const float TestZ = Rect.MinZ - OcclusionDepthBias;
+	const __m128 VTestZ = _mm_set1_ps(TestZ);
+	const __m128 LaneIndex = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+
+	for (int32 TileY = MinY / TileSize; TileY <= MaxY / TileSize; ++TileY)
+	{
+		for (int32 TileX = MinX / TileSize; TileX <= MaxX / TileSize; ++TileX)
+		{
+			// 1단계: 타일 안 가장 먼 오클루더보다도 박스가 뒤에 있으면 타일 전체가 가려짐
+			if (TileMaxDepth[TileY * TilesX + TileX] < TestZ)
+				continue;
+
+			// 2단계: 사각형과 겹치는 픽셀만 SSE로 검사
+			const int32 X0 = std::max(MinX, TileX * TileSize);
+			const int32 X1 = std::min(MaxX, TileX * TileSize + TileSize - 1);
+			const int32 Y0 = std::max(MinY, TileY * TileSize);
+			const int32 Y1 = std::min(MaxY, TileY * TileSize + TileSize - 1);
+
+			const __m128 RangeMin = _mm_set1_ps(static_cast<float>(X0) - 0.5f);
+			const __m128 RangeMax = _mm_set1_ps(static_cast<float>(X1) + 0.5f);
+
+			for (int32 Y = Y0; Y <= Y1; ++Y)
+			{
+				const float* Row = Depth.data() + Y * Width;
+				for (int32 X = X0 & ~3; X <= X1; X += 4)
+				{
+					const __m128 PixelX = _mm_add_ps(_mm_set1_ps(static_cast<float>(X)), LaneIndex);
+					const __m128 InRange = _mm_and_ps(_mm_cmpgt_ps(PixelX, RangeMin), _mm_cmplt_ps(PixelX, RangeMax));
+					const __m128 Visible = _mm_and_ps(InRange, _mm_cmpge_ps(_mm_loadu_ps(Row + X), VTestZ));
+					if (_mm_movemask_ps(Visible) != 0)
+						return false;
+				}
+			}
+		}
+	}
+	return true;
+}
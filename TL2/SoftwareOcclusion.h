@@ -0,0 +1,59 @@
+﻿#pragma once
+
+struct FBound;
+struct FStaticMesh;
+
+/**
+ * FSoftwareOcclusionBuffer
+ * - CPU에서만 동작하는 저해상도 깊이 버퍼 기반 Occlusion Culling
+ * - 화면을 크게 덮는 오클루더 메시를 SSE로 래스터화해 가장 가까운 깊이를 기록하고,
+ *   8x8 타일마다 가장 먼 깊이를 모아 계층(Hi-Z) 한 단계를 만든다
+ * - 후보 AABB는 먼저 타일 최대 깊이로 빠르게 판정하고, 애매한 타일만 픽셀 단위로 검사한다
+ * - 깊이 규약은 D3D와 동일 (NDC z: 0 = near, 1 = far)
+ */
+class FSoftwareOcclusionBuffer
+{
+public:
+	static constexpr int32 Width = 256;
+	static constexpr int32 Height = 128;
+	static constexpr int32 TileSize = 8;
+	static constexpr int32 TilesX = Width / TileSize;
+	static constexpr int32 TilesY = Height / TileSize;
+
+	FSoftwareOcclusionBuffer();
+
+	// 깊이를 far(1.0)로 초기화하고 이번 뷰의 ViewProjection을 설정
+	void Begin(const FMatrix& InViewProjection);
+
+	// 메시 삼각형을 깊이 버퍼에 기록 (기록한 삼각형 수 반환)
+	int32 RasterizeMesh(const FStaticMesh& Mesh, const FMatrix& WorldMatrix);
+
+	// 타일별 최대 깊이 갱신 (래스터화를 모두 끝낸 뒤 한 번 호출)
+	void BuildHierarchy();
+
+	// 월드 AABB가 화면에서 차지하는 픽셀 수 (근평면을 가로지르면 -1)
+	float GetScreenArea(const FBound& WorldBounds) const;
+
+	// 월드 AABB가 기록된 오클루더 뒤에 완전히 가려지는지 검사 (보수적)
+	bool IsOccluded(const FBound& WorldBounds) const;
+
+private:
+	struct FScreenRect
+	{
+		float MinX, MinY, MaxX, MaxY;
+		float MinZ;
+	};
+
+	// AABB 8개 꼭짓점을 화면 공간으로 투영 (근평면 뒤 꼭짓점이 있으면 false)
+	bool ProjectBounds(const FBound& WorldBounds, FScreenRect& OutRect) const;
+
+	void RasterizeTriangle(const FVector4& V0, const FVector4& V1, const FVector4& V2);
+
+	FMatrix ViewProjection;
+
+	TArray<float> Depth;		// Width * Height, 가장 가까운 오클루더 깊이
+	TArray<float> TileMaxDepth;	// TilesX * TilesY, 타일 안에서 가장 먼 깊이
+
+	// 메시 정점 변환 결과 (화면 좌표 x, y / NDC z / clip w)
+	TArray<FVector4> ScreenVertices;
+};
@@ -0,0 +1,125 @@
+﻿#include "pch.h"
+#include "SpatialQuery.h"
+#include "World.h"
+#include "BVH.h"
+#include "OrientedBox.h"
+#include "Benchmark.h"
+#include <random>
+
+void FSpatialQueryBenchmark::Run(UWorld* World, int32 NumQueries)
+{
+    if (!World || NumQueries <= 0)
+        return;
+
+    const FBenchmark Bench("SPATIAL");
+
+    World->FlushBVHUpdates();
+    FBVH* BVH = World->GetBVH();
+    const TArray<AActor*>& Actors = World->GetActors();
+    if (!BVH || BVH->GetNodeCount() == 0 || Actors.IsEmpty())
+    {
+        Bench.LogInfo("No actors in BVH");
+        return;
+    }
+
+    // 질의 크기는 씬 크기에 비례 (씬 대각선의 2%)
+    const FBound& SceneBounds = BVH->GetNodes()[0].BoundingBox;
+    const float QueryRadius = FMath::Max((SceneBounds.Max - SceneBounds.Min).Size() * 0.02f, 1.0f);
+
+    // 질의 입력: 임의 액터 위치 주변 (고정 시드라 실행마다 같은 질의)
+    std::mt19937 Random(12345);
+    std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+    std::uniform_int_distribution<int32> PickActor(0, Actors.Num() - 1);
+
+    TArray<FSpatialSphere> Spheres;
+    TArray<FOrientedBox> Boxes;
+    TArray<FSpatialSweep> Sweeps;
+    TArray<FVector> Points;
+    Spheres.Reserve(NumQueries);
+    Boxes.Reserve(NumQueries);
+    Sweeps.Reserve(NumQueries);
+    Points.Reserve(NumQueries);
+
+    for (int32 i = 0; i < NumQueries; ++i)
+    {
+        AActor* Actor = Actors[PickActor(Random)];
+        const FVector Base = Actor ? Actor->GetActorLocation() : FVector();
+        const FVector Center = Base + FVector(Unit(Random), Unit(Random), Unit(Random)) * QueryRadius;
+        const FVector Direction = FVector(Unit(Random), Unit(Random), Unit(Random)).GetSafeNormal();
+
+        Spheres.Add({ Center, QueryRadius });
+        Boxes.Add(FOrientedBox(Center, FVector(QueryRadius, QueryRadius * 0.5f, QueryRadius * 0.25f),
+            FQuat::MakeFromEuler(FVector(Unit(Random), Unit(Random), Unit(Random)) * PI)));
+        Sweeps.Add({ Center, Center + Direction * (QueryRadius * 4.0f), QueryRadius * 0.25f });
+        Points.Add(Center);
+    }
+
+    // 결과 버퍼는 측정 전에 한 번만 할당
+    constexpr int32 MaxOverlapsPerQuery = 64;
+    constexpr int32 MaxHitsPerQuery = 8;
+    TArray<AActor*> ActorBuffer(static_cast<size_t>(NumQueries) * MaxOverlapsPerQuery);
+    TArray<FSpatialHit> HitBuffer(static_cast<size_t>(NumQueries) * MaxHitsPerQuery);
+    TArray<FSpatialQueryRange> Ranges(NumQueries);
+
+    std::span<AActor*> SingleActors(ActorBuffer.data(), MaxOverlapsPerQuery);
+    std::span<FSpatialHit> SingleHits(HitBuffer.data(), MaxHitsPerQuery);
+
+    Bench.LogInfo("%d actors, %d BVH nodes, %d queries, radius %.2f",
+        BVH->GetActorCount(), BVH->GetNodeCount(), NumQueries, QueryRadius);
+
+    auto Measure = [&Bench, NumQueries](const char* Label, auto&& Body)
+    {
+        int64 NumResults = 0;
+        const double Milliseconds = FBenchmark::MeasureMs([&]() { NumResults = Body(); });
+        Bench.LogResult(Label, Milliseconds, "%7.3f us/query  %6.2f results/query",
+            Milliseconds * 1000.0 / NumQueries, static_cast<double>(NumResults) / NumQueries);
+    };
+
+    Measure("OverlapSphere", [&]()
+    {
+        int64 Total = 0;
+        for (const FSpatialSphere& Sphere : Spheres)
+            Total += World->OverlapSphere(Sphere.Center, Sphere.Radius, SingleActors);
+        return Total;
+    });
+    Measure("OverlapSphereBatch", [&]()
+    {
+        return static_cast<int64>(World->OverlapSphereBatch(Spheres, ActorBuffer, Ranges));
+    });
+
+    Measure("OverlapOBB", [&]()
+    {
+        int64 Total = 0;
+        for (const FOrientedBox& Box : Boxes)
+            Total += World->OverlapOBB(Box, SingleActors);
+        return Total;
+    });
+    Measure("OverlapOBBBatch", [&]()
+    {
+        return static_cast<int64>(World->OverlapOBBBatch(Boxes, ActorBuffer, Ranges));
+    });
+
+    Measure("SweepSphere", [&]()
+    {
+        int64 Total = 0;
+        for (const FSpatialSweep& Sweep : Sweeps)
+            Total += World->SweepSphere(Sweep.Start, Sweep.End, Sweep.Radius, SingleHits);
+        return Total;
+    });
+    Measure("SweepSphereBatch", [&]()
+    {
+        return static_cast<int64>(World->SweepSphereBatch(Sweeps, MaxHitsPerQuery, HitBuffer, Ranges));
+    });
+
+    Measure("FindNearest(8)", [&]()
+    {
+        int64 Total = 0;
+        for (const FVector& Point : Points)
+            Total += World->FindNearest(Point, SingleHits);
+        return Total;
+    });
+    Measure("FindNearestBatch(8)", [&]()
+    {
+        return static_cast<int64>(World->FindNearestBatch(Points, MaxHitsPerQuery, HitBuffer, Ranges));
+    });
+}
@@ -0,0 +1,43 @@
+﻿#pragma once
+#include "Vector.h"
+
+class AActor;
+class UWorld;
+
+// 거리순 공간 질의 결과 (스윕: 시작점에서 닿기까지 이동 거리, 최근접: 액터 AABB까지 거리)
+struct FSpatialHit
+{
+	AActor* Actor = nullptr;
+	float Distance = 0.0f;
+};
+
+// 일괄 질의 입력
+struct FSpatialSphere
+{
+	FVector Center;
+	float Radius = 0.0f;
+};
+
+struct FSpatialSweep
+{
+	FVector Start;
+	FVector End;
+	float Radius = 0.0f;
+};
+
+// 일괄 질의에서 질의 하나가 공유 출력 버퍼에 쓴 구간
+struct FSpatialQueryRange
+{
+	int32 First = 0;
+	int32 Num = 0;
+};
+
+/**
+ * FSpatialQueryBenchmark
+ * - 현재 레벨 액터 위치에서 질의를 만들어 OverlapSphere/OverlapOBB/SweepSphere/FindNearest와
+ *   일괄 버전을 각각 측정하고 FBenchmark로 출력 (콘솔 BENCH SPATIAL)
+ */
+struct FSpatialQueryBenchmark
+{
+	static void Run(UWorld* World, int32 NumQueries = 10000);
+};
@@ -10,6 +10,8 @@
 #include "Renderer.h"
 #include "AABoundingBoxComponent.h"
 #include "Enums.h"
+#include "MeshDrawCommand.h"
+#include "Material.h"
 
 UStaticMeshComponent::UStaticMeshComponent()
 {
@@ -28,16 +30,14 @@ void UStaticMeshComponent::Render(URenderer* Renderer, const FMatrix& ViewMatrix
         return;
     }
 
-    //Light Upate
-    CalAffectingLight(Renderer);
-     
-     
+    // 라이트는 뷰마다 클러스터로 한 번에 올라가므로 메시별 업로드 없음
+
     // 1. 메쉬 렌더링 (SF_StaticMeshes 플래그 확인)
     if (Viewport->IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes))
     {
         Renderer->UpdateConstantBuffer(GetWorldMatrix(), ViewMatrix, ProjectionMatrix);
         Renderer->PrepareShader(GetMaterial()->GetShader());
-        Renderer->DrawIndexedPrimitiveComponent(GetStaticMesh(), D3D10_PRIMITIVE_TOPOLOGY_TRIANGLELIST, MaterailSlots);
+        Renderer->DrawIndexedPrimitiveComponent(GetStaticMesh(), ERHIPrimitiveTopology::TriangleList, MaterailSlots);
     }
 
     // 2. AABB Bounding Box 렌더링 (SF_BoundingBoxes 플래그 확인)
@@ -47,6 +47,40 @@ void UStaticMeshComponent::Render(URenderer* Renderer, const FMatrix& ViewMatrix
     }
 }
 
+void UStaticMeshComponent::RecordDrawCommands(URenderer* Renderer, FViewport* Viewport, FMeshDrawCommandList& OutCommands, float ViewDepth, bool bSelected)
+{
+    if (!StaticMesh || !Renderer || !Viewport)
+    {
+        return;
+    }
+
+    // 라이트 업로드는 제출 시점(컴포넌트가 바뀔 때)에 수행
+    if (Viewport->IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes))
+    {
+        OutCommands.AddStaticMesh(this, ViewDepth, bSelected);
+    }
+
+    if (Viewport->IsShowFlagEnabled(EEngineShowFlags::SF_BoundingBoxes))
+    {
+        RenderBoundingBox(Renderer);
+    }
+}
+
+UMaterial* UStaticMeshComponent::GetSlotMaterial(uint32 InMaterialSlotIndex)
+{
+    if (InMaterialSlotIndex >= MaterailSlots.size())
+    {
+        return nullptr;
+    }
+
+    FMaterialSlot& Slot = MaterailSlots[InMaterialSlotIndex];
+    if (!Slot.CachedMaterial)
+    {
+        Slot.CachedMaterial = UResourceManager::GetInstance().Get<UMaterial>(Slot.MaterialName);
+    }
+    return Slot.CachedMaterial;
+}
+
 void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
 {
 	StaticMesh = FObjManager::LoadObjStaticMesh(PathFileName);
@@ -63,6 +97,7 @@ void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
         if (MaterailSlots[i].bChangedByUser == false)
         {
             MaterailSlots[i].MaterialName = GroupInfos[i].InitialMaterialName;
+            MaterailSlots[i].CachedMaterial = nullptr;
         }
     }
 }
@@ -191,6 +226,7 @@ void UStaticMeshComponent::SetMaterialByUser(const uint32 InMaterialSlotIndex, c
     {
         MaterailSlots[InMaterialSlotIndex].MaterialName = InMaterialName;
         MaterailSlots[InMaterialSlotIndex].bChangedByUser = true;
+        MaterailSlots[InMaterialSlotIndex].CachedMaterial = nullptr;
     }
     else
     {
@@ -232,39 +268,6 @@ void UStaticMeshComponent::DuplicateSubObjects()
     Super_t::DuplicateSubObjects();
 }
 
-void UStaticMeshComponent::CalAffectingLight(URenderer* Renderer)
-{
-    const auto& Lights = Renderer->GetWorldLights();
-
-    TArray<FLightInfo> Affecting;
-    Affecting.reserve(Lights.size());
-    FBound MeshAABB = GetWorldBoundingBox();
-
-    for (const FLightInfo& L : Lights)
-    {
-        if (MeshAABB.SphereInstersects(L.LightPos, L.Radius))
-        {
-            Affecting.Add(L);
-        }
-    }
-
-    //MAX LIGHT가 정해져있기 때문에, sorting이 필수적이다.
-    const FVector MeshCenter = MeshAABB.GetCenter();
-    std::sort(Affecting.begin(), Affecting.end(), [&](const FLightInfo& A, const FLightInfo& B)
-        {
-            float DistA = (A.LightPos - MeshCenter).SizeSquared();
-            float DistB = (B.LightPos - MeshCenter).SizeSquared();
-            return DistA < DistB;
-        });
-
-    if (Affecting.size() > static_cast<size_t>(MAX_LIGHT_COUNT))
-    {
-        Affecting.resize(static_cast<size_t>(MAX_LIGHT_COUNT));
-    }
-
-    Renderer->UpdateLightBuffer(Affecting);
-}
-
 void UStaticMeshComponent::RenderBoundingBox(URenderer* Renderer)
 {
     if (!Renderer || !StaticMesh)
@@ -275,15 +278,8 @@ void UStaticMeshComponent::RenderBoundingBox(URenderer* Renderer)
     // World AABB 가져오기
     FBound WorldBound = GetWorldBoundingBox();
 
-    // Line 데이터 생성
-    TArray<FVector> Start;
-    TArray<FVector> End;
-    TArray<FVector4> Color;
-
-    CreateLineData(WorldBound.Min, WorldBound.Max, Start, End, Color);
-
-    // Line 렌더링
-    Renderer->AddLines(Start, End, Color);
+    // 12개 모서리를 배처에 바로 기록 (CreateLineData와 같은 노란색)
+    Renderer->AddBoxes(std::span<const FBound>(&WorldBound, 1), FVector4(1.0f, 1.0f, 0.0f, 1.0f));
 }
 
 void UStaticMeshComponent::CreateLineData(
@@ -8,12 +8,15 @@
 class UStaticMesh;
 class UShader;
 class UTexture;
+class UMaterial;
+class FMeshDrawCommandList;
 struct FPrimitiveData;
 
 struct FMaterialSlot
 {
     FString MaterialName;
     bool bChangedByUser = false; // user에 의해 직접 Material이 바뀐 적이 있는지.
+    UMaterial* CachedMaterial = nullptr; // MaterialName으로 조회한 결과 (이름이 바뀌면 nullptr로 초기화)
 };
 
 class UStaticMeshComponent : public UMeshComponent
@@ -45,14 +48,18 @@ public:
     void SetMaterialByUser(const uint32 InMaterialSlotIndex, const FString& InMaterialName);
 
     const TArray<FMaterialSlot>& GetMaterailSlots() const { return MaterailSlots; }
+
+    // 슬롯의 UMaterial (문자열 조회는 이름이 바뀐 뒤 처음 한 번만)
+    UMaterial* GetSlotMaterial(uint32 InMaterialSlotIndex);
+
+    // 정렬 드로우 경로: 직접 그리지 않고 섹션별 커맨드를 OutCommands에 기록 (Render와 같은 ShowFlag 처리)
+    void RecordDrawCommands(URenderer* Renderer, FViewport* Viewport, FMeshDrawCommandList& OutCommands, float ViewDepth, bool bSelected);
     
     UObject* Duplicate() override;
     UObject* Duplicate(FObjectDuplicationParameters Parameter) override;
    
     void DuplicateSubObjects() override;
 
-    void CalAffectingLight(URenderer* Renderer);
-
 protected:
     // [PIE] 주소 복사 / NOTE: 만약 복사 후에도 GPU 버퍼 내용을 다르게 갖고 싶은 경우 깊은 복사를 해서 버퍼를 2개 생성하는 방법도 고려
     UStaticMesh* StaticMesh = nullptr;
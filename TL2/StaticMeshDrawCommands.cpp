@@ -0,0 +1,63 @@
+﻿#include "pch.h"
+#include "MeshDrawCommand.h"
+#include "StaticMeshComponent.h"
+#include "StaticMesh.h"
+#include "Material.h"
+#include "ResourceManager.h"
+#include "D3D11CommandContext.h"
+
+// 엔진 객체(컴포넌트/메시/머티리얼)를 RHI 핸들로 해석해 FMeshDrawCommandList에 기록
+// - 정렬/제출 코어(MeshDrawCommand.cpp)는 pch 없이 컴파일되므로 엔진 헤더가 필요한 기록 단계만 이 파일에 둔다
+void FMeshDrawCommandList::AddStaticMesh(UStaticMeshComponent* Component, float ViewDepth, bool bSelected, EMeshPass Pass)
+{
+	UStaticMesh* Mesh = Component ? Component->GetStaticMesh() : nullptr;
+	if (!Mesh || !Component->GetMaterial())
+		return;
+
+	FMeshDrawCommand Command;
+	Command.Shader = FD3D11CommandContext::MakeShaderHandle(Component->GetMaterial()->GetShader());
+	Command.VertexBuffer = FD3D11CommandContext::MakeBufferHandle(Mesh->GetVertexBuffer());
+	Command.IndexBuffer = FD3D11CommandContext::MakeBufferHandle(Mesh->GetIndexBuffer());
+	Command.VertexStride = GetVertexStride(Mesh->GetVertexType());
+	Command.ObjectIndex = AddObject(Component->GetWorldMatrix());
+	Command.bSelected = bSelected;
+
+	if (!Mesh->HasMaterial())
+	{
+		Command.IndexCount = Mesh->GetIndexCount();
+		AddCommand(Command, ViewDepth, Pass);
+		return;
+	}
+
+	const TArray<FGroupInfo>& MeshGroupInfos = Mesh->GetMeshGroupInfo();
+	for (uint32 i = 0; i < static_cast<uint32>(MeshGroupInfos.size()); ++i)
+	{
+		const UMaterial* Material = Component->GetSlotMaterial(i);
+		Command.Material = Material ? &Material->GetMaterialInfo() : nullptr;
+		Command.Texture = FRHITextureHandle();
+		Command.StartIndex = MeshGroupInfos[i].StartIndex;
+		Command.IndexCount = MeshGroupInfos[i].IndexCount;
+
+		if (Command.Material)
+		{
+			if (const FRHITextureHandle* Cached = MaterialTextures.Find(Command.Material))
+			{
+				Command.Texture = *Cached;
+			}
+			else
+			{
+				if (!(Command.Material->DiffuseTextureFileName == FName::None()))
+				{
+					FTextureData* TextureData = UResourceManager::GetInstance().CreateOrGetTextureData(Command.Material->DiffuseTextureFileName);
+					if (TextureData)
+					{
+						Command.Texture = FD3D11CommandContext::MakeTextureHandle(TextureData->TextureSRV);
+					}
+				}
+				MaterialTextures.Add(Command.Material, Command.Texture);
+			}
+		}
+
+		AddCommand(Command, ViewDepth, Pass);
+	}
+}
@@ -0,0 +1,3 @@
+// StaticMeshShader의 인스턴싱 버전: 월드 행렬을 상수 버퍼 대신 인스턴스 스트림에서 읽음
+#define STATIC_MESH_INSTANCED 1
+#include "StaticMeshShader.hlsl"
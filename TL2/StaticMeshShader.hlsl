@@ -27,6 +27,13 @@ struct VS_INPUT
     float3 normal : NORMAL0;
     float4 color : COLOR; // Input color from vertex buffer
     float2 texCoord : TEXCOORD0;
+#ifdef STATIC_MESH_INSTANCED
+    // 인스턴스 스트림(슬롯 1): 월드 행렬의 행
+    float4 instanceRow0 : INSTANCEWORLD0;
+    float4 instanceRow1 : INSTANCEWORLD1;
+    float4 instanceRow2 : INSTANCEWORLD2;
+    float4 instanceRow3 : INSTANCEWORLD3;
+#endif
 };
 
 
@@ -76,6 +83,7 @@ struct PS_INPUT
     float4 color : COLOR; // Color to pass to the pixel shader
     float2 texCoord : TEXCOORD0;
     float3 worldPos : TEXCOORD1;
+    float viewDepth : TEXCOORD2; // 클러스터 슬라이스 계산용 뷰 공간 z
 };
 
 PS_INPUT mainVS(VS_INPUT input)
@@ -86,9 +94,16 @@ PS_INPUT mainVS(VS_INPUT input)
     // float3 scaledPosition = input.position.xyz * Scale;
     // output.position = float4(Offset + scaledPosition, 1.0);
     
-    float4x4 MVP = mul(mul(WorldMatrix, ViewMatrix), ProjectionMatrix); 
-    float4 worldPos = mul(float4(input.position, 1.0f), WorldMatrix);
-    output.position = mul(worldPos, mul(ViewMatrix, ProjectionMatrix));
+#ifdef STATIC_MESH_INSTANCED
+    float4x4 World = float4x4(input.instanceRow0, input.instanceRow1, input.instanceRow2, input.instanceRow3);
+#else
+    float4x4 World = WorldMatrix;
+#endif
+
+    float4 worldPos = mul(float4(input.position, 1.0f), World);
+    float4 viewPos = mul(worldPos, ViewMatrix);
+    output.position = mul(viewPos, ProjectionMatrix);
+    output.viewDepth = viewPos.z;
     
     
     // change color
@@ -117,7 +132,7 @@ PS_INPUT mainVS(VS_INPUT input)
     output.color = c;
      
     // w를 0으로 초기화하면, vector이기 때문에 Translation이 무시된다.
-    output.normal = normalize(mul(float4(input.normal, 0.0f), WorldMatrix).xyz); 
+    output.normal = normalize(mul(float4(input.normal, 0.0f), World).xyz); 
     //output.worldPos = worldPos.zx; 
     output.worldPos = worldPos.xyz;
     
@@ -153,11 +168,7 @@ float4 mainPS(PS_INPUT input) : SV_TARGET
     lighting = float3(0, 0, 0);
     //ambientColor;
     
-    [unroll]
-    for (int i = 0; i < MAX_LIGHTS; ++i)
-    {
-        lighting += Calculate_PointLight_Diffuse(Lights[i], worldPos, N);    
-    } 
+    lighting += Calculate_ClusteredPointLights_Diffuse(input.position.xy, input.viewDepth, worldPos, N);
     
     finalColor.rgb = saturate(finalColor.rgb * lighting); 
     
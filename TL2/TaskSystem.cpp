@@ -0,0 +1,132 @@
+﻿// pch.h 없이 컴파일: 헤드리스 RHI 코어(MeshDrawCommand.cpp의 병렬 정렬)와 함께 링크됨
+#include "RHIResources.h"	// 기본 타입 (int32/uint64)
+#include "TaskSystem.h"
+
+namespace
+{
+    // 워커 스레드 여부 (중첩 ParallelFor 직렬 실행용)
+    thread_local bool GIsTaskWorkerThread = false;
+}
+
+FTaskSystem& FTaskSystem::GetInstance()
+{
+    static FTaskSystem Instance;
+    return Instance;
+}
+
+FTaskSystem::FTaskSystem()
+{
+    // 메인 스레드도 작업에 참여하므로 코어 수 - 1 개만 생성
+    uint32 NumCores = std::thread::hardware_concurrency();
+    int32 NumWorkers = NumCores > 1 ? static_cast<int32>(NumCores) - 1 : 0;
+    NumWorkers = std::min(NumWorkers, 7);
+
+    Workers.reserve(NumWorkers);
+    for (int32 i = 0; i < NumWorkers; ++i)
+    {
+        Workers.emplace_back(&FTaskSystem::WorkerLoop, this);
+    }
+}
+
+FTaskSystem::~FTaskSystem()
+{
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        bShutdown = true;
+    }
+    WakeCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        if (Worker.joinable())
+        {
+            Worker.join();
+        }
+    }
+}
+
+void FTaskSystem::ParallelFor(int32 Num, const std::function<void(int32)>& Body)
+{
+    if (Num <= 0)
+    {
+        return;
+    }
+
+    // 작업이 하나뿐이거나 워커가 없으면 스레드 전환 비용 없이 바로 실행
+    if (Num == 1 || Workers.empty() || GIsTaskWorkerThread)
+    {
+        for (int32 i = 0; i < Num; ++i)
+        {
+            Body(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> SubmitLock(SubmitMutex);
+
+    FJob Job;
+    Job.Body = &Body;
+    Job.Num = Num;
+
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        CurrentJob = &Job;
+        ++JobGeneration;
+    }
+    WakeCondition.notify_all();
+
+    ProcessJob(Job);
+
+    // 모든 인덱스가 소진되고, Job을 참조하는 워커가 없을 때까지 대기
+    std::unique_lock<std::mutex> Lock(Mutex);
+    CurrentJob = nullptr;
+    DoneCondition.wait(Lock, [this]() { return ActiveWorkers == 0; });
+}
+
+void FTaskSystem::ProcessJob(FJob& Job)
+{
+    for (;;)
+    {
+        int32 Index = Job.NextIndex.fetch_add(1);
+        if (Index >= Job.Num)
+        {
+            break;
+        }
+        (*Job.Body)(Index);
+    }
+}
+
+void FTaskSystem::WorkerLoop()
+{
+    GIsTaskWorkerThread = true;
+
+    uint64 SeenGeneration = 0;
+    for (;;)
+    {
+        FJob* Job = nullptr;
+        {
+            std::unique_lock<std::mutex> Lock(Mutex);
+            WakeCondition.wait(Lock, [&]() { return bShutdown || JobGeneration != SeenGeneration; });
+            if (bShutdown)
+            {
+                return;
+            }
+
+            SeenGeneration = JobGeneration;
+            Job = CurrentJob;
+            if (!Job)
+            {
+                continue;
+            }
+            ++ActiveWorkers;
+        }
+
+        ProcessJob(*Job);
+
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            --ActiveWorkers;
+        }
+        DoneCondition.notify_one();
+    }
+}
@@ -0,0 +1,53 @@
+﻿#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+/**
+ * FTaskSystem
+ * - 프레임 단위 병렬 작업을 위한 고정 워커 스레드 풀
+ * - ParallelFor로 인덱스 범위를 나눠 실행하며, 호출 스레드도 작업에 참여한다
+ * - 워커 안에서 다시 ParallelFor를 호출하면 교착을 피하기 위해 직렬로 실행한다
+ */
+class FTaskSystem
+{
+public:
+    static FTaskSystem& GetInstance();
+
+    // [0, Num) 인덱스마다 Body를 호출하고 모두 끝날 때까지 대기
+    void ParallelFor(int32 Num, const std::function<void(int32)>& Body);
+
+    int32 GetNumWorkers() const { return static_cast<int32>(Workers.size()); }
+
+private:
+    FTaskSystem();
+    ~FTaskSystem();
+
+    FTaskSystem(const FTaskSystem&) = delete;
+    FTaskSystem& operator=(const FTaskSystem&) = delete;
+
+    struct FJob
+    {
+        const std::function<void(int32)>* Body = nullptr;
+        int32 Num = 0;
+        std::atomic<int32> NextIndex{ 0 };
+    };
+
+    void WorkerLoop();
+    static void ProcessJob(FJob& Job);
+
+    std::vector<std::thread> Workers;
+
+    std::mutex Mutex;
+    std::condition_variable WakeCondition;
+    std::condition_variable DoneCondition;
+
+    FJob* CurrentJob = nullptr;
+    uint64 JobGeneration = 0;
+    int32 ActiveWorkers = 0;
+    bool bShutdown = false;
+
+    // 동시에 하나의 ParallelFor만 실행
+    std::mutex SubmitMutex;
+};
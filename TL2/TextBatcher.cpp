@@ -0,0 +1,206 @@
+﻿#include "pch.h"
+#include "TextBatcher.h"
+#include "TextRenderComponent.h"
+#include "Material.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "VertexData.h"
+#include "RenderingStats.h"
+
+const FTextBatcher::FGlyph* FTextBatcher::GetGlyphTable()
+{
+	struct FGlyphTable
+	{
+		FGlyph Glyphs[256];
+
+		FGlyphTable()
+		{
+			const float TEXTURE_WH = 512.f;
+			const float SUBTEX_WH = 32.f;
+			const int COLROW = 16;
+
+			for (int c = 32; c <= 126; ++c)
+			{
+				int key = c - 32;
+				int col = key % COLROW;
+				int row = key / COLROW;
+
+				FGlyph& Glyph = Glyphs[c];
+				Glyph.U = col * SUBTEX_WH / TEXTURE_WH;
+				Glyph.V = row * SUBTEX_WH / TEXTURE_WH;
+				Glyph.W = SUBTEX_WH / TEXTURE_WH;
+				Glyph.H = SUBTEX_WH / TEXTURE_WH;
+				Glyph.bValid = true;
+			}
+		}
+	};
+
+	// 최초 호출 시 1번만 생성 (이후 문자 조회는 배열 인덱싱)
+	static const FGlyphTable Table;
+	return Table.Glyphs;
+}
+
+float FTextBatcher::GetGlyphAdvance()
+{
+	const FGlyph& Glyph = GetGlyph('A');
+	return Glyph.W / Glyph.H;
+}
+
+void FTextBatcher::Release()
+{
+	VertexRing.Release();
+	if (QuadIndexBuffer)
+	{
+		QuadIndexBuffer->Release();
+		QuadIndexBuffer = nullptr;
+	}
+	Labels.clear();
+}
+
+void FTextBatcher::Add(UTextRenderComponent* Text)
+{
+	if (Text)
+	{
+		Labels.Add(Text);
+	}
+}
+
+bool FTextBatcher::EnsureResources(ID3D11Device* Device)
+{
+	if (QuadIndexBuffer && VertexRing.IsInitialized())
+	{
+		return true;
+	}
+
+	if (!QuadIndexBuffer)
+	{
+		TArray<uint32> Indices;
+		Indices.Reserve(static_cast<int32>(MaxQuadsPerDraw * 6));
+		for (uint32 i = 0; i < MaxQuadsPerDraw; i++)
+		{
+			Indices.push_back(i * 4 + 0);
+			Indices.push_back(i * 4 + 1);
+			Indices.push_back(i * 4 + 2);
+
+			Indices.push_back(i * 4 + 2);
+			Indices.push_back(i * 4 + 1);
+			Indices.push_back(i * 4 + 3);
+		}
+
+		D3D11_BUFFER_DESC Desc = {};
+		Desc.ByteWidth = static_cast<UINT>(sizeof(uint32) * Indices.size());
+		Desc.Usage = D3D11_USAGE_IMMUTABLE;
+		Desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+
+		D3D11_SUBRESOURCE_DATA InitData = {};
+		InitData.pSysMem = Indices.data();
+
+		if (FAILED(Device->CreateBuffer(&Desc, &InitData, &QuadIndexBuffer)))
+		{
+			UE_LOG("FTextBatcher: 인덱스 버퍼 생성 실패");
+			QuadIndexBuffer = nullptr;
+			return false;
+		}
+	}
+
+	// 한 드로우 분량의 두 배: 같은 프레임의 이전 드로우가 읽는 영역을 덮기 전에 한 바퀴 돌도록
+	const uint32 RingBytes = MaxQuadsPerDraw * 4 * sizeof(FBillboardVertexInfo_GPU) * 2;
+	return VertexRing.IsInitialized() || VertexRing.Initialize(Device, RingBytes, D3D11_BIND_VERTEX_BUFFER);
+}
+
+void FTextBatcher::Flush(URenderer* Renderer, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix)
+{
+	if (Labels.IsEmpty())
+	{
+		return;
+	}
+
+	URHIDevice* RHIDevice = Renderer->GetRHIDevice();
+	if (!EnsureResources(RHIDevice->GetDevice()))
+	{
+		Labels.clear();
+		return;
+	}
+	ID3D11DeviceContext* Context = RHIDevice->GetDeviceContext();
+	URenderingStatsCollector& StatsCollector = URenderingStatsCollector::GetInstance();
+
+	Renderer->UpdateConstantBuffer(FMatrix::Identity(), ViewMatrix, ProjMatrix);
+	Renderer->RSSetState(EViewModeIndex::VMI_Unlit);
+
+	const UINT Stride = sizeof(FBillboardVertexInfo_GPU);
+	const uint32 MaxVerticesPerDraw = MaxQuadsPerDraw * 4;
+	ID3D11Buffer* VertexBuffer = VertexRing.GetBuffer();
+	UINT Offset = 0;
+	Context->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
+	Context->IASetIndexBuffer(QuadIndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+	Context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	RHIDevice->PSSetDefaultSampler(0);
+
+	for (int32 Begin = 0; Begin < Labels.Num();)
+	{
+		UMaterial* Material = Labels[Begin]->GetMaterial();
+
+		// 이 폰트의 라벨 범위와 총 정점 수 (텍스트/트랜스폼이 바뀐 라벨만 여기서 글리프를 다시 만듦)
+		int32 End = Begin;
+		uint32 NumVertices = 0;
+		Streams.clear();
+		for (; End < Labels.Num() && Labels[End]->GetMaterial() == Material; ++End)
+		{
+			const TArray<FBillboardVertexInfo_GPU>& Vertices = Labels[End]->GetWorldGlyphVertices();
+			if (!Vertices.IsEmpty())
+			{
+				Streams.Add(&Vertices);
+				NumVertices += static_cast<uint32>(Vertices.Num());
+			}
+		}
+		Begin = End;
+
+		if (NumVertices == 0 || !Material || !Material->GetShader() || !Material->GetTexture())
+		{
+			continue;
+		}
+
+		Renderer->PrepareShader(Material->GetShader());
+		ID3D11ShaderResourceView* TextureSRV = Material->GetTexture()->GetShaderResourceView();
+		Context->PSSetShaderResources(0, 1, &TextureSRV);
+		StatsCollector.IncrementMaterialChanges();
+		StatsCollector.IncrementTextureChanges();
+
+		// 라벨 경계와 무관하게 MaxQuadsPerDraw 단위로 링에 기록 → 드로우 (정점 수는 항상 4의 배수)
+		int32 StreamIndex = 0;
+		uint32 StreamOffset = 0;
+		while (NumVertices > 0)
+		{
+			const uint32 ChunkVertices = std::min(NumVertices, MaxVerticesPerDraw);
+			uint32 ByteOffset = 0;
+			uint8* Dest = VertexRing.BeginWrite(Context, ChunkVertices * Stride, Stride, ByteOffset);
+			if (!Dest)
+			{
+				break;
+			}
+
+			uint32 Written = 0;
+			while (Written < ChunkVertices)
+			{
+				const TArray<FBillboardVertexInfo_GPU>& Vertices = *Streams[StreamIndex];
+				const uint32 Count = std::min(static_cast<uint32>(Vertices.Num()) - StreamOffset, ChunkVertices - Written);
+				std::memcpy(Dest + Written * Stride, Vertices.data() + StreamOffset, Count * Stride);
+				Written += Count;
+				StreamOffset += Count;
+				if (StreamOffset == static_cast<uint32>(Vertices.Num()))
+				{
+					++StreamIndex;
+					StreamOffset = 0;
+				}
+			}
+			VertexRing.EndWrite(Context, Written * Stride);
+
+			Context->DrawIndexed(Written / 4 * 6, 0, static_cast<INT>(ByteOffset / Stride));
+			StatsCollector.IncrementDrawCalls();
+			NumVertices -= Written;
+		}
+	}
+
+	Labels.clear();
+	Streams.clear();
+}
@@ -0,0 +1,62 @@
+﻿#pragma once
+#include "DynamicRingBuffer.h"
+#include "VertexData.h"
+
+class URenderer;
+class UTextRenderComponent;
+
+/**
+ * FTextBatcher
+ * - FTranslucentQueue가 뒤→앞으로 정렬해 넘긴 텍스트 라벨들의 글리프 쿼드를 동적 버텍스 링 하나로 그림
+ *   (순서는 바꾸지 않고 같은 폰트(머티리얼)가 이어지는 구간마다 드로우, 블렌드 상태는 호출자가 설정)
+ * - 라벨은 월드 공간 글리프를 캐시해 두고 텍스트/트랜스폼이 바뀔 때만 다시 만들며, 여기서는 링에 복사만 한다
+ * - 인덱스 버퍼는 쿼드 패턴(0,1,2, 2,1,3)을 한 번 만들어 모든 드로우가 BaseVertexLocation으로 공유
+ */
+class FTextBatcher
+{
+public:
+	// 아틀라스 한 칸의 UV (U, V: 좌상단, W, H: 크기)
+	struct FGlyph
+	{
+		float U = 0.0f;
+		float V = 0.0f;
+		float W = 0.0f;
+		float H = 0.0f;
+		bool bValid = false;
+	};
+
+	// 문자 코드로 바로 인덱싱하는 256칸 글리프 표 (TextBillboard.dds: 512px, 32px 칸, 한 줄 16칸, ASCII 32~126)
+	static const FGlyph& GetGlyph(char C) { return GetGlyphTable()[static_cast<uint8>(C)]; }
+
+	// 글리프 한 칸의 가로/세로 비 (쿼드 높이 1 기준 가로 폭)
+	static float GetGlyphAdvance();
+
+	FTextBatcher() = default;
+	~FTextBatcher() { Release(); }
+
+	FTextBatcher(const FTextBatcher&) = delete;
+	FTextBatcher& operator=(const FTextBatcher&) = delete;
+
+	void Release();
+
+	// 이번 뷰에 그릴 라벨 추가 (Flush 전까지 포인터만 보관)
+	void Add(UTextRenderComponent* Text);
+	bool IsEmpty() const { return Labels.IsEmpty(); }
+
+	// 모인 라벨을 Add 순서대로 드로우 (글리프는 이미 월드 공간이므로 모델 행렬은 항등)
+	void Flush(URenderer* Renderer, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix);
+
+	// 한 드로우에 담는 최대 쿼드 수 (공유 인덱스 버퍼 크기)
+	static const uint32 MaxQuadsPerDraw = 16384;
+
+private:
+	static const FGlyph* GetGlyphTable();
+
+	bool EnsureResources(ID3D11Device* Device);
+
+	TArray<UTextRenderComponent*> Labels;
+	TArray<const TArray<FBillboardVertexInfo_GPU>*> Streams;	// Flush 중 한 폰트의 라벨별 정점 배열 (재사용)
+
+	FDynamicRingBuffer VertexRing;
+	ID3D11Buffer* QuadIndexBuffer = nullptr;
+};
@@ -11,30 +11,34 @@ protected:
 	~UTextRenderComponent() override;
 
 public:
-	void InitCharInfoMap();
-	TArray<FBillboardVertexInfo_GPU> CreateVerticesForString(const FString& text,const FVector& StartPos);
+	// Text의 글리프 쿼드(로컬 공간, 글자당 정점 4개)를 OutVertices에 채움 (기존 용량 재사용)
+	static void CreateVerticesForString(const FString& InText, const FVector& StartPos, TArray<FBillboardVertexInfo_GPU>& OutVertices);
+
+	// 월드 공간 글리프 정점 (텍스트나 월드 행렬이 바뀐 경우에만 다시 계산) - FTextBatcher가 그대로 복사해 그림
+	const TArray<FBillboardVertexInfo_GPU>& GetWorldGlyphVertices();
+
 	virtual void Render(URenderer* Renderer, const FMatrix& View, const FMatrix& Proj, FViewport* Viewport = nullptr) override;
 	
 	const FString GetText() { return Text; }
 	void SetText(FString InText);
 
-	UTextQuad* GetStaticMesh() const { return TextQuad; }
-
 	UObject* Duplicate() override;
 	//UObject* Duplicate(FObjectDuplicationParameters Parameter) override;
 	void DuplicateSubObjects() override;
 
 private:
 	static const uint32 MaxQuads = 100; // capacity
-	static TMap<char, FBillboardVertexInfo> CharInfoMap;	// ASCII 문자 코드를 UVRect로 변환하는 Map
 
 private:
 	// [PIE] 값 복사
 	FString Text;
 
-	// [PIE] 주소 복사 / NOTE: 만약 복사 후에도 GPU 버퍼 내용을 다르게 갖고 싶은 경우 깊은 복사를 해서 버퍼를 2개 생성하는 방법도 고려
-	UTextQuad* TextQuad = nullptr;
-
 	// [PIE] 값 복사
-	bool bIsDirty = true;	// Text 가 변경된 경우 true 후 TextQuad 업데이트
+	bool bIsDirty = true;	// Text 가 변경된 경우 true 후 LocalVertices 재생성
+
+	// 글리프 정점 캐시 (GPU 버퍼는 FTextBatcher가 모든 라벨과 공유)
+	TArray<FBillboardVertexInfo_GPU> LocalVertices;
+	TArray<FBillboardVertexInfo_GPU> WorldVertices;
+	FMatrix CachedWorldMatrix;
+	bool bWorldVerticesValid = false;
 };
\ No newline at end of file
@@ -0,0 +1,164 @@
+﻿#include "pch.h"
+#include "TranslucentQueue.h"
+#include "TextRenderComponent.h"
+#include "DecalComponent.h"
+#include "RenderingStats.h"
+#include "TaskSystem.h"
+#include <bit>
+
+void FTranslucentQueue::AddText(UTextRenderComponent* Text)
+{
+	if (!Text)
+	{
+		return;
+	}
+
+	Items.Add({ Text->GetWorldLocation(), ETranslucentItemType::Text, static_cast<uint32>(Texts.Num()) });
+	Texts.Add(Text);
+}
+
+void FTranslucentQueue::AddBillboard(const FBillboardSprite& Sprite)
+{
+	if (!Sprite.Texture)
+	{
+		return;
+	}
+
+	Items.Add({ Sprite.Position, ETranslucentItemType::Billboard, static_cast<uint32>(Sprites.Num()) });
+	Sprites.Add(Sprite);
+}
+
+void FTranslucentQueue::AddDecal(UDecalComponent* Decal, const TArray<UStaticMeshComponent*>& Receivers)
+{
+	if (!Decal || Receivers.IsEmpty())
+	{
+		return;
+	}
+
+	Items.Add({ Decal->GetWorldLocation(), ETranslucentItemType::Decal, static_cast<uint32>(Decals.Num()) });
+	Decals.Add({ Decal, &Receivers });
+}
+
+void FTranslucentQueue::Reset()
+{
+	Items.clear();
+	Texts.clear();
+	Sprites.clear();
+	Decals.clear();
+}
+
+void FTranslucentQueue::BuildSortKeys(const FMatrix& ViewMatrix)
+{
+	const int32 Count = Items.Num();
+	SortEntries.SetNum(Count);
+
+	// 뷰 공간 Z (행 벡터: z = P * View의 2열)
+	const float Z0 = ViewMatrix.M[0][2];
+	const float Z1 = ViewMatrix.M[1][2];
+	const float Z2 = ViewMatrix.M[2][2];
+	const float Z3 = ViewMatrix.M[3][2];
+
+	auto BuildRange = [&](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
+		{
+			const FVector& P = Items[i].Position;
+			const float ViewZ = std::max(P.X * Z0 + P.Y * Z1 + P.Z * Z2 + Z3, 0.0f);
+
+			// 양수 float 비트는 크기 순서와 같으므로 상위 24비트로 양자화하고 반전 → 오름차순 = 뒤→앞
+			// (같은 키끼리는 추가 순서 유지)
+			const uint32 DepthBits = std::bit_cast<uint32>(ViewZ);
+			SortEntries[i] = { static_cast<uint64>(~DepthBits >> 8), static_cast<uint32>(i) };
+		}
+	};
+
+	if (Count < ParallelRadixSortThreshold)
+	{
+		BuildRange(0, Count);
+		return;
+	}
+
+	FTaskSystem& TaskSystem = FTaskSystem::GetInstance();
+	const int32 NumBlocks = TaskSystem.GetNumWorkers() + 1;
+	const int32 BlockSize = (Count + NumBlocks - 1) / NumBlocks;
+	TaskSystem.ParallelFor(NumBlocks, [&](int32 Block)
+	{
+		BuildRange(Block * BlockSize, std::min(Count, (Block + 1) * BlockSize));
+	});
+}
+
+void FTranslucentQueue::Submit(URenderer* Renderer, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix)
+{
+	if (Items.IsEmpty() || !Renderer)
+	{
+		Reset();
+		return;
+	}
+
+	URenderingStatsCollector& StatsCollector = URenderingStatsCollector::GetInstance();
+	const uint32 DrawCallsBefore = StatsCollector.GetCurrentFrameStats().TotalDrawCalls;
+	const uint32 DecalDrawCallsBefore = StatsCollector.GetDecalStats().DecalDrawCalls;
+
+	BuildSortKeys(ViewMatrix);
+	ParallelRadixSortDrawKeys(SortEntries, SortScratch);
+
+	// 패스 전체에서 블렌드 상태 변경은 켜고 끄는 한 번씩
+	Renderer->OMSetBlendState(true);
+
+	for (int32 RunStart = 0; RunStart < SortEntries.Num();)
+	{
+		const ETranslucentItemType Type = Items[SortEntries[RunStart].CommandIndex].Type;
+		int32 RunEnd = RunStart + 1;
+		while (RunEnd < SortEntries.Num() && Items[SortEntries[RunEnd].CommandIndex].Type == Type)
+		{
+			++RunEnd;
+		}
+
+		SubmitRun(Renderer, ViewMatrix, ProjMatrix, RunStart, RunEnd);
+		RunStart = RunEnd;
+	}
+
+	Renderer->OMSetBlendState(false);
+
+	StatsCollector.AddTranslucentPassDrawCalls(
+		(StatsCollector.GetCurrentFrameStats().TotalDrawCalls - DrawCallsBefore) +
+		(StatsCollector.GetDecalStats().DecalDrawCalls - DecalDrawCallsBefore));
+
+	Reset();
+}
+
+void FTranslucentQueue::SubmitRun(URenderer* Renderer, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix, int32 RunStart, int32 RunEnd)
+{
+	switch (Items[SortEntries[RunStart].CommandIndex].Type)
+	{
+	case ETranslucentItemType::Text:
+	{
+		FTextBatcher& TextBatcher = Renderer->GetTextBatcher();
+		for (int32 i = RunStart; i < RunEnd; ++i)
+		{
+			TextBatcher.Add(Texts[Items[SortEntries[i].CommandIndex].Payload]);
+		}
+		TextBatcher.Flush(Renderer, ViewMatrix, ProjMatrix);
+		break;
+	}
+	case ETranslucentItemType::Billboard:
+	{
+		FBillboardBatcher& BillboardBatcher = Renderer->GetBillboardBatcher();
+		for (int32 i = RunStart; i < RunEnd; ++i)
+		{
+			BillboardBatcher.Add(Sprites[Items[SortEntries[i].CommandIndex].Payload]);
+		}
+		BillboardBatcher.Flush(Renderer, ViewMatrix, ProjMatrix);
+		break;
+	}
+	case ETranslucentItemType::Decal:
+	{
+		for (int32 i = RunStart; i < RunEnd; ++i)
+		{
+			const FDecalItem& Item = Decals[Items[SortEntries[i].CommandIndex].Payload];
+			Item.Decal->RenderDecalProjection(Renderer, ViewMatrix, ProjMatrix, *Item.Receivers);
+		}
+		break;
+	}
+	}
+}
@@ -0,0 +1,67 @@
+﻿#pragma once
+#include "BillboardBatcher.h"
+#include "MeshDrawCommand.h"
+
+class URenderer;
+class UTextRenderComponent;
+class UDecalComponent;
+class UStaticMeshComponent;
+
+// 반투명 큐 항목 종류 (정렬 후 같은 종류가 연속된 구간을 해당 배처로 한 번에 그림)
+enum class ETranslucentItemType : uint8
+{
+	Text,
+	Billboard,
+	Decal,
+};
+
+/**
+ * FTranslucentQueue
+ * - 한 뷰의 반투명 프리미티브(텍스트 라벨, 빌보드/에디터 아이콘, 데칼 투영)를 모아 불투명 패스 이후에 제출
+ * - 항목마다 뷰 깊이를 양자화한 키로 뒤→앞 정렬 (ParallelRadixSortDrawKeys)
+ * - 블렌드 상태는 제출 시작/끝에 한 번씩만 바꾸고, 정렬 순서대로 같은 종류가 이어지는 구간을
+ *   FTextBatcher/FBillboardBatcher에 넘겨 구간마다 Flush (배처는 순서를 바꾸지 않고 같은 텍스처끼리만 묶음)
+ */
+class FTranslucentQueue
+{
+public:
+	void AddText(UTextRenderComponent* Text);
+	void AddBillboard(const FBillboardSprite& Sprite);
+
+	// Receivers는 Submit까지 유효해야 함 (FDecalReceiverCache 결과)
+	void AddDecal(UDecalComponent* Decal, const TArray<UStaticMeshComponent*>& Receivers);
+
+	bool IsEmpty() const { return Items.IsEmpty(); }
+	int32 Num() const { return Items.Num(); }
+
+	// 뒤→앞으로 정렬해 그리고 큐를 비움. 이 패스의 드로우 수를 TranslucentPassDrawCalls에 더함
+	void Submit(URenderer* Renderer, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix);
+
+	// 버리기 (뷰 렌더링이 중간에 끝난 경우)
+	void Reset();
+
+private:
+	struct FItem
+	{
+		FVector Position;			// 깊이 계산용 월드 위치
+		ETranslucentItemType Type;
+		uint32 Payload;				// 종류별 배열 인덱스
+	};
+
+	struct FDecalItem
+	{
+		UDecalComponent* Decal;
+		const TArray<UStaticMeshComponent*>* Receivers;
+	};
+
+	void BuildSortKeys(const FMatrix& ViewMatrix);
+	void SubmitRun(URenderer* Renderer, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix, int32 RunStart, int32 RunEnd);
+
+	TArray<FItem> Items;
+	TArray<UTextRenderComponent*> Texts;
+	TArray<FBillboardSprite> Sprites;
+	TArray<FDecalItem> Decals;
+
+	TArray<FMeshDrawSortEntry> SortEntries;
+	TArray<FMeshDrawSortEntry> SortScratch;
+};
@@ -214,12 +214,15 @@ void UStatsOverlayD2D::Draw()
         uint64 NumAttempts = Instance.GetNumPickingAttempts();
         double AccumulatedTime = Instance.GetAccumulatedPickingTime();
 
-        swprintf_s(buf, L"Picking Time %f ms : Num Attempts %llu : Accumulated Time %f ms",
+        swprintf_s(buf, L"Picking Time %f ms : Num Attempts %llu : Accumulated Time %f ms\nPicking Cache Hit %.1f%% (%llu / %llu)",
             LastPickingTime,
             NumAttempts,
-            AccumulatedTime);
+            AccumulatedTime,
+            Instance.GetPickingCacheHitRate() * 100.0f,
+            Instance.GetPickingCacheHits(),
+            Instance.GetPickingCacheLookups());
 
-        D2D1_RECT_F rc = D2D1::RectF(margin, nextY, margin + panelWidth * 3.0f, nextY + panelHeight / 2.0f);
+        D2D1_RECT_F rc = D2D1::RectF(margin, nextY, margin + panelWidth * 3.0f, nextY + panelHeight);
 
         // 4. 헬퍼 함수를 사용해 텍스트를 그립니다.
         DrawTextBlock(
@@ -227,7 +230,7 @@ void UStatsOverlayD2D::Draw()
             D2D1::ColorF(0, 0, 0, 0.6f),
             D2D1::ColorF(D2D1::ColorF::Green)
         );
-        nextY += panelHeight / 2.0f + 8.0f;
+        nextY += panelHeight + 8.0f;
     }
 
     if (bShowMemory)
@@ -283,17 +286,22 @@ void UStatsOverlayD2D::Draw()
         AvgTextureChanges /= STATS_HISTORY_SIZE;
         AvgShaderChanges /= STATS_HISTORY_SIZE;
         
+        const FRenderingStats& AvgStats = URenderingStatsCollector::GetInstance().GetAverageStats();
+
         wchar_t Buffer[256];
-        swprintf_s(Buffer, L"DrawCalls: %u\nMaterials: %u\nTextures: %u\nShaders: %u", 
-                  AvgDrawCalls, AvgMaterialChanges, AvgTextureChanges, AvgShaderChanges);
+        swprintf_s(Buffer, L"DrawCalls: %u\nMaterials: %u\nTextures: %u\nShaders: %u\nFrustum Culled: %u (%.3f ms)\nOcclusion Culled: %u (%u tris, %.3f ms)\nCB Map/Unmap: %u / %u (%.1f KB)", 
+                  AvgDrawCalls, AvgMaterialChanges, AvgTextureChanges, AvgShaderChanges,
+                  AvgStats.FrustumCulledActors, AvgStats.FrustumCullTime,
+                  AvgStats.OcclusionCulledPrimitives, AvgStats.OccluderTriangles, AvgStats.OcclusionCullTime,
+                  AvgStats.ConstantBufferMaps, AvgStats.ConstantBufferUnmaps, AvgStats.ConstantBytesUploaded / 1024.0f);
 
-        D2D1_RECT_F rc = D2D1::RectF(margin, nextY, margin + panelWidth, nextY + panelHeight * 1.5f);
+        D2D1_RECT_F rc = D2D1::RectF(margin, nextY, margin + panelWidth, nextY + panelHeight * 1.5f + 54.0f);
         DrawTextBlock(
             d2dCtx, dwrite, Buffer, rc, 14.0f,
             D2D1::ColorF(0, 0, 0, 0.6f),
             D2D1::ColorF(D2D1::ColorF::Cyan));
 
-		nextY += panelHeight * 1.5f + 8.0f;
+		nextY += panelHeight * 1.5f + 54.0f + 8.0f;
     }
 
     if (bShowDecal)
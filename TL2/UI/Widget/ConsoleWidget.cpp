@@ -3,11 +3,20 @@
 #include "../../ObjectFactory.h"
 #include "../GlobalConsole.h"
 #include "../StatsOverlayD2D.h"
+#include "../../OrientedBox.h"
+#include "../../MeshDrawCommand.h"
+#include "../../ClusteredLightCulling.h"
+#include "../../Picking.h"
+#include "../UIManager.h"
+#include "../../World.h"
+#include "../../SpatialQuery.h"
+#include "../../HeadlessRenderDriver.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
 #include <cstring>
 #include <algorithm>
+#include <chrono>
 
 using std::max;
 using std::min;
@@ -45,6 +54,17 @@ void UConsoleWidget::Initialize()
 	Commands.Add("STAT PICKING");
 	Commands.Add("STAT RENDER");
     Commands.Add("STAT NONE");
+    Commands.Add("BENCH OBB");
+    Commands.Add("BENCH DRAWS");
+    Commands.Add("BENCH LIGHTS");
+    Commands.Add("PICKING IDBUFFER");
+    Commands.Add("PICKING RAY");
+    Commands.Add("FIND");
+    Commands.Add("BENCH SPATIAL");
+    Commands.Add("RENDER OCCLUSION");
+    Commands.Add("RENDER HEADLESS");
+    Commands.Add("RHI NULL");
+    Commands.Add("RHI D3D11");
     
     // Add welcome messages
     AddLog("=== Console Widget Initialized ===");
@@ -297,6 +317,100 @@ void UConsoleWidget::ExecCommand(const char* command_line)
         UStatsOverlayD2D::Get().SetShowDecal(true);
         AddLog("STAT DECAL: ON");
 	}
+    else if (Stricmp(command_line, "PICKING IDBUFFER") == 0)
+    {
+        CPickingSystem::SetIDBufferPickingEnabled(true);
+        AddLog("PICKING: CPU ID buffer tile");
+    }
+    else if (Stricmp(command_line, "PICKING RAY") == 0)
+    {
+        CPickingSystem::SetIDBufferPickingEnabled(false);
+        AddLog("PICKING: ray + BVH");
+    }
+    else if (Stricmp(command_line, "BENCH SPATIAL") == 0)
+    {
+        // 월드 공간 질의(겹침/스윕/최근접, 단건/일괄) 측정 결과는 UE_LOG로 출력
+        FSpatialQueryBenchmark::Run(UUIManager::GetInstance().GetWorld());
+    }
+    else if (Stricmp(command_line, "RENDER OCCLUSION") == 0)
+    {
+        // 소프트웨어 오클루전 컬링 켜기/끄기 (캐시된 뷰 결과는 버리고 다음 프레임부터 반영)
+        UWorld* World = UUIManager::GetInstance().GetWorld();
+        if (!World)
+        {
+            AddLog("RENDER OCCLUSION: No world");
+        }
+        else
+        {
+            FSceneVisibility& SceneVisibility = World->GetSceneVisibility();
+            SceneVisibility.SetOcclusionCullingEnabled(!SceneVisibility.IsOcclusionCullingEnabled());
+            SceneVisibility.Invalidate();
+            AddLog("RENDER OCCLUSION: %s", SceneVisibility.IsOcclusionCullingEnabled() ? "ON" : "OFF");
+        }
+    }
+    else if (Stricmp(command_line, "RENDER HEADLESS") == 0)
+    {
+        // 렌더러/디바이스 컨텍스트 없이 현재 씬의 정적 메시를 기록해 Null 컨텍스트에서 실행
+        FHeadlessRenderDriver::Run(UUIManager::GetInstance().GetWorld());
+    }
+    else if (Stricmp(command_line, "RHI NULL") == 0)
+    {
+        UWorld* World = UUIManager::GetInstance().GetWorld();
+        URenderer* Renderer = World ? World->GetRenderer() : nullptr;
+        if (!Renderer)
+        {
+            AddLog("RHI: No renderer");
+        }
+        else
+        {
+            Renderer->GetNullCommandContext().Reset();
+            Renderer->SetCommandContext(&Renderer->GetNullCommandContext());
+            AddLog("RHI: Null context (static mesh pass is counted, not drawn)");
+        }
+    }
+    else if (Stricmp(command_line, "RHI D3D11") == 0)
+    {
+        UWorld* World = UUIManager::GetInstance().GetWorld();
+        URenderer* Renderer = World ? World->GetRenderer() : nullptr;
+        if (!Renderer)
+        {
+            AddLog("RHI: No renderer");
+        }
+        else
+        {
+            const FNullRHICommandContext& NullContext = Renderer->GetNullCommandContext();
+            AddLog("RHI: D3D11 context (null context ran %u draws, %u state changes)", NullContext.DrawCalls, NullContext.GetNumStateChanges());
+            Renderer->SetCommandContext(nullptr);
+        }
+    }
+    else if (Strnicmp(command_line, "FIND ", 5) == 0)
+    {
+        // 이름 일부로 레벨 액터 검색 (월드 검색 인덱스 사용)
+        const char* Query = command_line + 5;
+        UWorld* World = UUIManager::GetInstance().GetWorld();
+        if (!World)
+        {
+            AddLog("FIND: No world");
+        }
+        else
+        {
+            TArray<AActor*> FoundActors;
+            auto StartTime = std::chrono::high_resolution_clock::now();
+            int32 NumFound = World->FindActorsByName(Query, FoundActors);
+            std::chrono::duration<double, std::milli> Elapsed = std::chrono::high_resolution_clock::now() - StartTime;
+
+            AddLog("FIND '%s': %d actor(s), %.3f ms", Query, NumFound, Elapsed.count());
+            const int32 MaxListed = 20;
+            for (int32 i = 0; i < min(NumFound, MaxListed); ++i)
+            {
+                AddLog("- %s", FoundActors[i]->GetName().ToString().c_str());
+            }
+            if (NumFound > MaxListed)
+            {
+                AddLog("  ... %d more", NumFound - MaxListed);
+            }
+        }
+    }
     else if (Stricmp(command_line, "STAT NONE") == 0)
     {
         UStatsOverlayD2D::Get().SetShowFPS(false);
@@ -306,6 +420,21 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowDecal(false);
         AddLog("STAT: OFF");
     }
+    else if (Stricmp(command_line, "BENCH OBB") == 0)
+    {
+        // 스칼라/SSE SAT 결과 비교 후 스칼라 vs SSE vs IntersectsMany 시간 측정
+        FOrientedBoxBenchmark::Run();
+    }
+    else if (Stricmp(command_line, "BENCH DRAWS") == 0)
+    {
+        // 합성 드로우 10만 개를 실제 Sort/Submit 경로로 정렬/제출하고 정렬 전/후 상태 변경 수 비교
+        FMeshDrawSortBenchmark::Run();
+    }
+    else if (Stricmp(command_line, "BENCH LIGHTS") == 0)
+    {
+        // 합성 라이트 1k/10k/50k개로 클러스터 라이트 컬링 Build 시간 측정
+        FClusteredLightCullingBenchmark::Run();
+    }
     else
     {
         AddLog("Unknown command: '%s'", command_line);
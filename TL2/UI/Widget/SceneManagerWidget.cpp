@@ -49,65 +49,8 @@ void USceneManagerWidget::Update()
     float DeltaTime = ImGui::GetIO().DeltaTime;
     UpdateCameraAnimation(DeltaTime);
     
-    // Check if we need to refresh (world changed or actors added/removed)
-    static size_t LastActorCount = 0;
-    
-    UWorld* World = GetCurrentWorld();
-    if (World)
-    {
-        size_t CurrentActorCount = World->GetActors().size();
-        if (CurrentActorCount != LastActorCount)
-        {
-            RefreshActorTree();
-            LastActorCount = CurrentActorCount;
-        }
-        
-        // 추가: 트리의 액터들이 실제로 World에 존재하는지 확인
-        bool bNeedRefresh = false;
-        const TArray<AActor*>& WorldActors = World->GetActors();
-        
-        for (auto* RootNode : RootNodes)
-        {
-            if (RootNode && RootNode->IsActor())
-            {
-                // 노드의 액터가 null이거나, World에 없으면 새로고침
-                if (!RootNode->Actor || 
-                    std::find(WorldActors.begin(), WorldActors.end(), RootNode->Actor) == WorldActors.end())
-                {
-                    bNeedRefresh = true;
-                    break;
-                }
-            }
-            
-            // 카테고리 노드의 자식들도 확인
-            if (RootNode && RootNode->IsCategory())
-            {
-                for (auto* Child : RootNode->Children)
-                {
-                    if (Child && Child->IsActor())
-                    {
-                        if (!Child->Actor || 
-                            std::find(WorldActors.begin(), WorldActors.end(), Child->Actor) == WorldActors.end())
-                        {
-                            bNeedRefresh = true;
-                            break;
-                        }
-                    }
-                }
-                if (bNeedRefresh) break;
-            }
-        }
-        
-        if (bNeedRefresh)
-        {
-            RequestDelayedRefresh();
-        }
-    }
-    else if (LastActorCount != 0)
-    {
-        RefreshActorTree();
-        LastActorCount = 0;
-    }
+    // 레벨에서 추가/제거/이름 변경된 액터만 트리에 반영
+    SyncWithLevel();
     
     // Sync selection from viewport
     SyncSelectionFromViewport();
@@ -138,66 +81,50 @@ void USceneManagerWidget::RenderWidget()
         return;
     }
     
+    // Update 이후 같은 프레임에 삭제된 액터가 행에 남지 않도록 그리기 직전에 한 번 더 반영
+    SyncWithLevel();
+    
     ImGui::Text("Objects: %zu", World->GetActors().size());
+
+    // 이름 검색 (입력이 바뀔 때만 인덱스 조회 후 행 재구성)
+    ImGui::SetNextItemWidth(-1.0f);
+    if (ImGui::InputTextWithHint("##ActorSearch", "Search...", SearchBuffer, IM_ARRAYSIZE(SearchBuffer)))
+    {
+        SearchFilter = SearchBuffer;
+        bVisibleRowsDirty = true;
+    }
     ImGui::Separator();
     
     // Actor tree view
     ImGui::BeginChild("ActorTreeView", ImVec2(0, 240), true);
     
-    // 렌더링 전에 트리 유효성 사전 검사
-    bool bTreeNeedsRefresh = false;
-    if (World)
+    // 선택 필터는 선택이 바뀔 때마다 결과가 달라지므로 켜져 있는 동안은 매 프레임 재구성
+    if (bVisibleRowsDirty || bShowOnlySelectedObjects)
     {
-        const TArray<AActor*>& WorldActors = World->GetActors();
-        for (auto* RootNode : RootNodes)
-        {
-            if (RootNode && RootNode->IsActor())
-            {
-                if (!RootNode->Actor || 
-                    std::find(WorldActors.begin(), WorldActors.end(), RootNode->Actor) == WorldActors.end())
-                {
-                    bTreeNeedsRefresh = true;
-                    break;
-                }
-            }
-            if (RootNode && RootNode->IsCategory())
-            {
-                for (auto* Child : RootNode->Children)
-                {
-                    if (Child && Child->IsActor())
-                    {
-                        if (!Child->Actor || 
-                            std::find(WorldActors.begin(), WorldActors.end(), Child->Actor) == WorldActors.end())
-                        {
-                            bTreeNeedsRefresh = true;
-                            break;
-                        }
-                    }
-                }
-                if (bTreeNeedsRefresh) break;
-            }
-        }
+        RebuildVisibleRows();
     }
     
-    if (bTreeNeedsRefresh)
-    {
-        ImGui::Text("로딩 중...");
-        RequestDelayedRefresh();
-    }
-    else
+    // 스크롤 영역에 보이는 행만 위젯을 만들고 그림
+    ImGuiListClipper Clipper;
+    Clipper.Begin(VisibleRows.Num());
+    while (Clipper.Step())
     {
-        for (auto* RootNode : RootNodes)
+        for (int32 RowIndex = Clipper.DisplayStart; RowIndex < Clipper.DisplayEnd; ++RowIndex)
         {
-            if (RootNode)
+            FActorTreeNode* Node = VisibleRows[RowIndex];
+            if (Node->IsCategory())
             {
-                // Categories are always shown, individual actors are filtered
-                if (RootNode->IsCategory() || ShouldShowActor(RootNode->Actor))
-                {
-                    RenderActorNode(RootNode);
-                }
+                RenderCategoryNode(Node);
+            }
+            else
+            {
+                ImGui::Indent();
+                RenderActorNode(Node, 1);
+                ImGui::Unindent();
             }
         }
     }
+    Clipper.End();
     
     ImGui::EndChild();
     
@@ -243,19 +170,300 @@ UWorld* USceneManagerWidget::GetCurrentWorld() const
 void USceneManagerWidget::RefreshActorTree()
 {
     UWorld* World = GetCurrentWorld();
-    if (!World)
+    ULevel* Level = World ? World->GetLevel() : nullptr;
+
+    // 지금까지 쌓인 이벤트는 전체 목록에 이미 반영되므로 버림
+    if (Level)
     {
-        ClearActorTree();
-        return;
+        bool bUnusedFullRebuild = false;
+        Level->ConsumeActorEvents(PendingLevelEvents, bUnusedFullRebuild);
+        PendingLevelEvents.clear();
     }
-    
+    TrackedLevel = Level;
+    TrackedLevelSerial = Level ? Level->GetLevelSerial() : 0;
+
     // Clear existing tree
     ClearActorTree();
+
+    if (!World)
+    {
+        return;
+    }
     
     // Build new hierarchy
     BuildActorHierarchy();
 }
 
+void USceneManagerWidget::SyncWithLevel()
+{
+    UWorld* World = GetCurrentWorld();
+    ULevel* Level = World ? World->GetLevel() : nullptr;
+
+    // 월드/레벨이 바뀌었으면(PIE 진입·종료 등) 전체 재구성
+    if (Level != TrackedLevel || (Level && Level->GetLevelSerial() != TrackedLevelSerial))
+    {
+        RefreshActorTree();
+        return;
+    }
+
+    if (!Level)
+    {
+        return;
+    }
+
+    bool bNeedsFullRebuild = false;
+    Level->ConsumeActorEvents(PendingLevelEvents, bNeedsFullRebuild);
+    if (bNeedsFullRebuild)
+    {
+        RefreshActorTree();
+        return;
+    }
+
+    if (!PendingLevelEvents.IsEmpty())
+    {
+        ApplyLevelEvents();
+    }
+}
+
+void USceneManagerWidget::ApplyLevelEvents()
+{
+    // 액터별 최종 상태만 반영 (추가 후 같은 프레임에 삭제된 액터는 노드를 만들지 않음)
+    enum class EActorChange : uint8
+    {
+        Renamed,
+        Present,
+        Absent,
+    };
+
+    TMap<AActor*, EActorChange> FinalChanges;
+    TArray<AActor*> ChangedActors;
+    FinalChanges.reserve(PendingLevelEvents.Num());
+    ChangedActors.Reserve(PendingLevelEvents.Num());
+
+    for (const FLevelActorEvent& Event : PendingLevelEvents)
+    {
+        auto [It, bInserted] = FinalChanges.try_emplace(Event.Actor, EActorChange::Renamed);
+        if (bInserted)
+        {
+            ChangedActors.Add(Event.Actor);
+        }
+
+        switch (Event.Type)
+        {
+        case ELevelActorEvent::Added:
+            It->second = EActorChange::Present;
+            break;
+        case ELevelActorEvent::Removed:
+            It->second = EActorChange::Absent;
+            break;
+        case ELevelActorEvent::Renamed:
+            break;
+        }
+    }
+    PendingLevelEvents.clear();
+
+    for (AActor* Actor : ChangedActors)
+    {
+        switch (*FinalChanges.Find(Actor))
+        {
+        case EActorChange::Absent:
+            // 이미 해제됐을 수 있으므로 역참조하지 않고 키로만 제거
+            RemoveActorNode(Actor);
+            break;
+        case EActorChange::Present:
+            if (FindNodeByActor(Actor))
+            {
+                RefreshActorNode(Actor);
+            }
+            else
+            {
+                AddActorNode(Actor);
+            }
+            break;
+        case EActorChange::Renamed:
+            // 레벨 밖에서 이름만 바뀐 액터(클립보드 원본 등)는 무시
+            if (FindNodeByActor(Actor))
+            {
+                RefreshActorNode(Actor);
+            }
+            break;
+        }
+    }
+
+    CompactCategoryNodes();
+    bVisibleRowsDirty = true;
+}
+
+void USceneManagerWidget::AddActorNode(AActor* Actor)
+{
+    if (!Actor)
+        return;
+
+    FActorTreeNode* CategoryNode = FindOrCreateCategoryNode(GetActorCategory(Actor));
+
+    FActorTreeNode* ActorNode = new FActorTreeNode(Actor);
+    ActorNode->Parent = CategoryNode;
+    ActorNode->IndexInParent = CategoryNode->Children.Num();
+    // Initialize node visibility from actor's actual visibility state
+    ActorNode->bIsVisible = Actor->IsActorVisible();
+
+    // Category is visible if any child is visible
+    CategoryNode->bIsVisible = CategoryNode->Children.IsEmpty() ? ActorNode->bIsVisible : (CategoryNode->bIsVisible || ActorNode->bIsVisible);
+    CategoryNode->Children.Add(ActorNode);
+
+    ActorNodeIndex.Add(Actor, ActorNode);
+}
+
+void USceneManagerWidget::RemoveActorNode(AActor* Actor)
+{
+    FActorTreeNode** Found = ActorNodeIndex.Find(Actor);
+    if (!Found)
+        return;
+
+    FActorTreeNode* Node = *Found;
+    ActorNodeIndex.Remove(Actor);
+
+    // 자리만 비워두고 CompactCategoryNodes에서 한 번에 당김
+    if (FActorTreeNode* Parent = Node->Parent)
+    {
+        Parent->Children[Node->IndexInParent] = nullptr;
+        Parent->bHasRemovedChildren = true;
+    }
+    delete Node;
+
+    if (ContextMenuTarget == Actor)
+    {
+        ContextMenuTarget = nullptr;
+    }
+    if (DragSource == Actor)
+    {
+        DragSource = nullptr;
+    }
+}
+
+void USceneManagerWidget::RefreshActorNode(AActor* Actor)
+{
+    FActorTreeNode* Node = FindNodeByActor(Actor);
+    if (!Node)
+        return;
+
+    // 표시 이름은 그릴 때 액터에서 읽으므로 카테고리(이름 접두어)가 바뀐 경우만 옮김
+    FString CategoryName = GetActorCategory(Actor);
+    FActorTreeNode* OldCategoryNode = Node->Parent;
+    if (OldCategoryNode && OldCategoryNode->CategoryName == CategoryName)
+        return;
+
+    if (OldCategoryNode)
+    {
+        OldCategoryNode->Children[Node->IndexInParent] = nullptr;
+        OldCategoryNode->bHasRemovedChildren = true;
+    }
+
+    FActorTreeNode* CategoryNode = FindOrCreateCategoryNode(CategoryName);
+    Node->Parent = CategoryNode;
+    Node->IndexInParent = CategoryNode->Children.Num();
+    CategoryNode->bIsVisible = CategoryNode->Children.IsEmpty() ? Node->bIsVisible : (CategoryNode->bIsVisible || Node->bIsVisible);
+    CategoryNode->Children.Add(Node);
+}
+
+void USceneManagerWidget::CompactCategoryNodes()
+{
+    bool bRemovedCategory = false;
+    for (FActorTreeNode*& CategoryNode : RootNodes)
+    {
+        if (!CategoryNode || !CategoryNode->bHasRemovedChildren)
+            continue;
+
+        // 순서를 유지하며 구멍을 당김
+        TArray<FActorTreeNode*>& Children = CategoryNode->Children;
+        int32 WriteIndex = 0;
+        for (int32 ReadIndex = 0; ReadIndex < Children.Num(); ++ReadIndex)
+        {
+            if (FActorTreeNode* Child = Children[ReadIndex])
+            {
+                Child->IndexInParent = WriteIndex;
+                Children[WriteIndex++] = Child;
+            }
+        }
+        Children.resize(WriteIndex);
+        CategoryNode->bHasRemovedChildren = false;
+
+        // 비어버린 카테고리는 제거
+        if (Children.IsEmpty())
+        {
+            CategoryIndex.Remove(CategoryNode->CategoryName);
+            delete CategoryNode;
+            CategoryNode = nullptr;
+            bRemovedCategory = true;
+        }
+    }
+
+    if (bRemovedCategory)
+    {
+        RootNodes.erase(std::remove(RootNodes.begin(), RootNodes.end(), nullptr), RootNodes.end());
+    }
+}
+
+void USceneManagerWidget::RebuildVisibleRows()
+{
+    VisibleRows.clear();
+    bVisibleRowsDirty = false;
+
+    UWorld* World = GetCurrentWorld();
+    if (!SearchFilter.empty() && World)
+    {
+        // 검색 중에는 전체 노드 대신 인덱스가 찾은 액터만 카테고리별로 묶어 표시 (일치 항목이 없는 카테고리는 숨김)
+        SearchResults.clear();
+        World->FindActorsByName(SearchFilter, SearchResults);
+
+        TMap<FActorTreeNode*, TArray<FActorTreeNode*>> MatchesByCategory;
+        for (AActor* Actor : SearchResults)
+        {
+            FActorTreeNode* Node = FindNodeByActor(Actor);
+            if (Node && Node->Parent && ShouldShowActor(Actor))
+            {
+                MatchesByCategory[Node->Parent].Add(Node);
+            }
+        }
+
+        VisibleRows.Reserve(SearchResults.Num() + MatchesByCategory.Num());
+        for (FActorTreeNode* CategoryNode : RootNodes)
+        {
+            const TArray<FActorTreeNode*>* Matches = MatchesByCategory.Find(CategoryNode);
+            if (!Matches)
+                continue;
+
+            VisibleRows.Add(CategoryNode);
+            if (CategoryNode->bIsExpanded)
+            {
+                VisibleRows.insert(VisibleRows.end(), Matches->begin(), Matches->end());
+            }
+        }
+        return;
+    }
+
+    VisibleRows.Reserve(ActorNodeIndex.Num() + RootNodes.Num());
+
+    for (FActorTreeNode* CategoryNode : RootNodes)
+    {
+        if (!CategoryNode)
+            continue;
+
+        // Categories are always shown, individual actors are filtered
+        VisibleRows.Add(CategoryNode);
+        if (!CategoryNode->bIsExpanded)
+            continue;
+
+        for (FActorTreeNode* Child : CategoryNode->Children)
+        {
+            if (Child && ShouldShowActor(Child->Actor))
+            {
+                VisibleRows.Add(Child);
+            }
+        }
+    }
+}
+
 void USceneManagerWidget::BuildActorHierarchy()
 {
     UWorld* World = GetCurrentWorld();
@@ -280,15 +488,12 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
     
     // Handle actor nodes
     if (!Node->Actor)
-        return; // 이미 사전 검사에서 걸러졌어야 하지만 방어 코드
+        return;
     
     AActor* Actor = Node->Actor;
     
-    // Skip if doesn't pass filters
-    if (!ShouldShowActor(Actor))
-        return;
-    
-    ImGuiTreeNodeFlags NodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth;
+    // 액터 행은 항상 리프 (들여쓰기는 호출 측에서 처리하므로 TreePush 없음)
+    ImGuiTreeNodeFlags NodeFlags = ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
     
     // Check if selected
     bool bIsSelected = SelectionManager->IsActorSelected(Actor);
@@ -297,23 +502,9 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
         NodeFlags |= ImGuiTreeNodeFlags_Selected;
     }
     
-    // Leaf node if no children
-    if (Node->Children.empty())
-    {
-        NodeFlags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
-    }
-    
     // Create unique ID for ImGui
     ImGui::PushID(Actor);
     
-    // 액터 유효성 재확인 - 삭제된 액터일 수 있음
-    if (!Actor)
-    {
-        ImGui::PopID();
-        RefreshActorTree();
-        return;
-    }
-    
     // Sync node visibility with actual actor state each frame
     Node->bIsVisible = Actor->IsActorVisible();
     
@@ -329,12 +520,7 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
     ImGui::SameLine();
     
     // Actor name and tree node
-    if (!Actor)
-    {
-        return;
-    }
-
-    bool bNodeOpen = ImGui::TreeNodeEx(Actor->GetName().ToString().c_str(), NodeFlags);
+    ImGui::TreeNodeEx(Actor->GetName().ToString().c_str(), NodeFlags);
     
     // Handle selection
     if (ImGui::IsItemClicked())
@@ -393,20 +579,6 @@ void USceneManagerWidget::RenderActorNode(FActorTreeNode* Node, int32 Depth)
         ImGui::EndDragDropTarget();
     }
     
-    // Render children if node is open
-    if (bNodeOpen && !Node->Children.empty())
-    {
-        for (FActorTreeNode* Child : Node->Children)
-        {
-            RenderActorNode(Child, Depth + 1);
-        }
-    }
-    
-    if (bNodeOpen && !Node->Children.empty())
-    {
-        ImGui::TreePop();
-    }
-    
     ImGui::PopID();
 }
 
@@ -479,15 +651,43 @@ void USceneManagerWidget::HandleActorDelete(AActor* Actor)
     UWorld* World = GetCurrentWorld();
     if (World)
     {
+        // 파괴 후에는 액터에 접근할 수 없으므로 이름을 먼저 복사
+        FString ActorName = Actor->GetName().ToString();
         World->DestroyActor(Actor);
-        UE_LOG("SceneManager: Deleted actor %s", Actor->GetName().ToString().c_str());
+        UE_LOG("SceneManager: Deleted actor %s", ActorName.c_str());
     }
 }
 
 void USceneManagerWidget::HandleActorDuplicate(AActor* Actor)
 {
-    // TODO: Implement actor duplication
-    UE_LOG("SceneManager: Duplicate not implemented yet");
+    if (!Actor)
+        return;
+
+    UWorld* World = GetCurrentWorld();
+    if (!World || !SelectionManager)
+        return;
+
+    // 선택된 액터에서 연 메뉴면 선택 전체를, 아니면 그 액터만 한 번에 복제
+    TArray<AActor*> SourceActors;
+    if (SelectionManager->IsActorSelected(Actor))
+    {
+        SourceActors = SelectionManager->GetSelectedActors();
+    }
+    else
+    {
+        SourceActors.Add(Actor);
+    }
+
+    TArray<AActor*> DuplicatedActors = World->DuplicateActors(SourceActors);
+    if (DuplicatedActors.IsEmpty())
+        return;
+
+    SelectionManager->SelectActors(DuplicatedActors);
+    if (UIManager)
+    {
+        UIManager->SetPickedActor(DuplicatedActors[0]);
+    }
+    UE_LOG("SceneManager: Duplicated %d actor(s)", DuplicatedActors.Num());
 }
 
 void USceneManagerWidget::RenderContextMenu()
@@ -662,6 +862,10 @@ void USceneManagerWidget::ClearActorTree()
         delete Node;
     }
     RootNodes.clear();
+    ActorNodeIndex.clear();
+    CategoryIndex.clear();
+    VisibleRows.clear();
+    bVisibleRowsDirty = true;
 }
 
 USceneManagerWidget::FActorTreeNode* USceneManagerWidget::FindNodeByActor(AActor* Actor)
@@ -669,28 +873,8 @@ USceneManagerWidget::FActorTreeNode* USceneManagerWidget::FindNodeByActor(AActor
     if (!Actor)
         return nullptr;
     
-    // Search through categories and their children
-    for (FActorTreeNode* RootNode : RootNodes)
-    {
-        if (!RootNode)
-            continue;
-            
-        // Check if this root node is the actor (for backward compatibility)
-        if (RootNode->IsActor() && RootNode->Actor == Actor)
-            return RootNode;
-            
-        // Search within category children
-        if (RootNode->IsCategory())
-        {
-            for (FActorTreeNode* Child : RootNode->Children)
-            {
-                if (Child && Child->IsActor() && Child->Actor == Actor)
-                    return Child;
-            }
-        }
-    }
-    
-    return nullptr;
+    FActorTreeNode** Found = ActorNodeIndex.Find(Actor);
+    return Found ? *Found : nullptr;
 }
 
 void USceneManagerWidget::SyncSelectionFromViewport()
@@ -740,18 +924,17 @@ FString USceneManagerWidget::GetActorCategory(AActor* Actor) const
 
 USceneManagerWidget::FActorTreeNode* USceneManagerWidget::FindOrCreateCategoryNode(const FString& CategoryName)
 {
-    // Look for existing category node in root nodes
-    for (FActorTreeNode* Node : RootNodes)
+    // Look for existing category node
+    if (FActorTreeNode** Found = CategoryIndex.Find(CategoryName))
     {
-        if (Node && Node->IsCategory() && Node->CategoryName == CategoryName)
-        {
-            return Node;
-        }
+        return *Found;
     }
     
     // Create new category node if not found
     FActorTreeNode* CategoryNode = new FActorTreeNode(CategoryName);
     RootNodes.push_back(CategoryNode);
+    CategoryIndex.Add(CategoryName, CategoryNode);
+    bVisibleRowsDirty = true;
     return CategoryNode;
 }
 
@@ -762,42 +945,15 @@ void USceneManagerWidget::BuildCategorizedHierarchy()
         return;
     
     const TArray<AActor*>& Actors = World->GetActors();
+    ActorNodeIndex.reserve(Actors.size());
     
     // Group actors by category
     for (AActor* Actor : Actors)
     {
-        if (!Actor)
-            continue;
-            
-        FString CategoryName = GetActorCategory(Actor);
-        FActorTreeNode* CategoryNode = FindOrCreateCategoryNode(CategoryName);
-        
-        // Create actor node and add to category
-        FActorTreeNode* ActorNode = new FActorTreeNode(Actor);
-        ActorNode->Parent = CategoryNode;
-        // Initialize node visibility from actor's actual visibility state
-        ActorNode->bIsVisible = Actor->IsActorVisible();
-        CategoryNode->Children.push_back(ActorNode);
+        AddActorNode(Actor);
     }
     
-    // Initialize category visibility based on child actors
-    for (FActorTreeNode* CategoryNode : RootNodes)
-    {
-        if (CategoryNode && CategoryNode->IsCategory())
-        {
-            // Category is visible if any child is visible
-            bool bAnyCategoryChildVisible = false;
-            for (FActorTreeNode* Child : CategoryNode->Children)
-            {
-                if (Child && Child->bIsVisible)
-                {
-                    bAnyCategoryChildVisible = true;
-                    break;
-                }
-            }
-            CategoryNode->bIsVisible = bAnyCategoryChildVisible;
-        }
-    }
+    bVisibleRowsDirty = true;
 }
 
 void USceneManagerWidget::HandleCategorySelection(FActorTreeNode* CategoryNode)
@@ -841,20 +997,13 @@ void USceneManagerWidget::RenderCategoryNode(FActorTreeNode* CategoryNode, int32
     if (!CategoryNode || !CategoryNode->IsCategory())
         return;
         
-    ImGuiTreeNodeFlags NodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth;
+    // 자식 행은 VisibleRows에 평탄화돼 있으므로 TreePush 없이 펼침 상태만 관리
+    ImGuiTreeNodeFlags NodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_NoTreePushOnOpen;
     
-    // Categories are always expandable
-    if (!CategoryNode->Children.empty())
+    // Empty category - show as leaf
+    if (CategoryNode->Children.empty())
     {
-        if (CategoryNode->bIsExpanded)
-        {
-            NodeFlags |= ImGuiTreeNodeFlags_DefaultOpen;
-        }
-    }
-    else
-    {
-        // Empty category - show as leaf
-        NodeFlags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+        NodeFlags |= ImGuiTreeNodeFlags_Leaf;
     }
     
     // Create unique ID for ImGui using category name
@@ -873,6 +1022,7 @@ void USceneManagerWidget::RenderCategoryNode(FActorTreeNode* CategoryNode, int32
     
     // Category name with object count
     FString DisplayText = CategoryNode->CategoryName + " (" + std::to_string(CategoryNode->Children.size()) + ")";
+    ImGui::SetNextItemOpen(CategoryNode->bIsExpanded);
     bool bNodeOpen = ImGui::TreeNodeEx(DisplayText.c_str(), NodeFlags);
     
     // Handle category click
@@ -881,18 +1031,12 @@ void USceneManagerWidget::RenderCategoryNode(FActorTreeNode* CategoryNode, int32
         HandleCategorySelection(CategoryNode);
     }
     
-    // Update expansion state based on ImGui tree state
-    CategoryNode->bIsExpanded = bNodeOpen;
-    
-    // Render child actors if category is expanded
-    if (bNodeOpen && !CategoryNode->Children.empty())
+    // Update expansion state based on ImGui tree state (다음 프레임 행 목록에 반영)
+    if (CategoryNode->bIsExpanded != bNodeOpen)
     {
-        for (FActorTreeNode* Child : CategoryNode->Children)
-        {
-            RenderActorNode(Child, Depth + 1);
-        }
-        ImGui::TreePop();
+        bVisibleRowsDirty = true;
     }
+    CategoryNode->bIsExpanded = bNodeOpen;
     
     ImGui::PopID();
 }
@@ -906,6 +1050,7 @@ void USceneManagerWidget::ExpandAllCategories()
             RootNode->bIsExpanded = true;
         }
     }
+    bVisibleRowsDirty = true;
     UE_LOG("SceneManager: Expanded all categories");
 }
 
@@ -918,6 +1063,7 @@ void USceneManagerWidget::CollapseAllCategories()
             RootNode->bIsExpanded = false;
         }
     }
+    bVisibleRowsDirty = true;
     UE_LOG("SceneManager: Collapsed all categories");
 }
 
@@ -2,6 +2,7 @@
 #include "Widget.h"
 #include "../../Vector.h"
 #include "../../UEContainer.h"
+#include "../../Level.h"
 
 class UUIManager;
 class UWorld;
@@ -36,6 +37,8 @@ private:
     bool bShowOnlySelectedObjects = false;
     bool bShowHiddenObjects = true;
     FString SearchFilter = "";
+    char SearchBuffer[128] = {};
+    TArray<AActor*> SearchResults; // 월드 검색 인덱스 결과 (행 재구성 때만 갱신)
     
     // Node types for tree hierarchy
     enum class ETreeNodeType
@@ -52,6 +55,8 @@ private:
         FString CategoryName = "";
         TArray<FActorTreeNode*> Children;
         FActorTreeNode* Parent = nullptr;
+        int32 IndexInParent = -1;      // Parent->Children 내 위치 (O(1) 제거용)
+        bool bHasRemovedChildren = false; // 제거로 Children에 nullptr 구멍이 생김 → 압축 필요
         bool bIsExpanded = true;
         bool bIsVisible = true;
         
@@ -65,7 +70,7 @@ private:
         {
             for (auto* Child : Children)
             {
-                delete Child;
+                delete Child; // 구멍(nullptr)은 delete가 무시
             }
         }
         
@@ -81,6 +86,19 @@ private:
     };
     
     TArray<FActorTreeNode*> RootNodes;
+
+    // 액터/카테고리 → 노드 해시 인덱스 (FindNodeByActor, 이벤트 반영을 O(1)로)
+    TMap<AActor*, FActorTreeNode*> ActorNodeIndex;
+    TMap<FString, FActorTreeNode*> CategoryIndex;
+
+    // 추적 중인 레벨 (주소 재사용에 대비해 고유 번호까지 비교)
+    ULevel* TrackedLevel = nullptr;
+    uint32 TrackedLevelSerial = 0;
+    TArray<FLevelActorEvent> PendingLevelEvents;
+
+    // 화면에 그릴 평탄화된 행 (카테고리 + 펼쳐진 카테고리의 액터), 리스트 클리퍼로 보이는 행만 그림
+    TArray<FActorTreeNode*> VisibleRows;
+    bool bVisibleRowsDirty = true;
     
     // Helper Methods
     UWorld* GetCurrentWorld() const;
@@ -88,6 +106,7 @@ private:
     void BuildActorHierarchy();
     void RenderActorNode(FActorTreeNode* Node, int32 Depth = 0);
     void RenderCategoryNode(FActorTreeNode* CategoryNode, int32 Depth = 0);
+    void RebuildVisibleRows();
     bool ShouldShowActor(AActor* Actor) const;
     void HandleActorSelection(AActor* Actor);
     void HandleActorVisibilityToggle(AActor* Actor);
@@ -112,6 +131,14 @@ private:
     // Tree management
     void ClearActorTree();
     FActorTreeNode* FindNodeByActor(AActor* Actor);
+
+    // 레벨 이벤트 기반 증분 갱신
+    void SyncWithLevel();
+    void ApplyLevelEvents();
+    void AddActorNode(AActor* Actor);
+    void RemoveActorNode(AActor* Actor);
+    void RefreshActorNode(AActor* Actor);
+    void CompactCategoryNodes();
     void ExpandParentsOfSelected();
     
     // Category management
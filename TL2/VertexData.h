@@ -83,4 +83,20 @@ struct FBillboardVertexInfo_GPU {
         UVRect[2] = src.color.Z;
         UVRect[3] = src.color.W;
     }
-};
\ No newline at end of file
+};
+
+// 정점 레이아웃별 정점 버퍼 스트라이드 (알 수 없는 레이아웃이면 0)
+inline uint32 GetVertexStride(EVertexLayoutType VertexType)
+{
+    switch (VertexType)
+    {
+    case EVertexLayoutType::PositionColor:
+        return sizeof(FVertexSimple);
+    case EVertexLayoutType::PositionColorTexturNormal:
+        return sizeof(FVertexDynamic);
+    case EVertexLayoutType::PositionBillBoard:
+        return sizeof(FBillboardVertexInfo_GPU);
+    default:
+        return 0;
+    }
+}
@@ -17,6 +17,7 @@
 #include "Frustum.h"
 #include "Octree.h"
 #include "BVH.h"
+#include "OrientedBox.h"
 #include "UEContainer.h"
 #include "DecalComponent.h"
 #include "DecalActor.h"
@@ -287,6 +288,8 @@ void UWorld::RenderSceneGraph()
     {
         return;
     }
+    // 이전에 그린 씬 그래프 라인을 지우고 현재 트리로 다시 채움 (이후 프레임은 업로드 없이 그대로 그림)
+    Renderer->ClearPersistentLines();
     Octree->Render(nullptr);
 }
 
@@ -300,6 +303,9 @@ void UWorld::Render()
     Renderer->BeginFrame();
     UIManager.Render();
 
+    // 모든 활성 뷰포트의 가시성을 먼저 병렬로 계산하고, 아래 드로우 제출에서 결과만 소비
+    ComputeViewVisibility();
+
     // UIManager의 뷰포트 전환 상태에 따라 렌더링 변경 SWidget으로 변경해줄거임
 
     if (MultiViewport)
@@ -309,32 +315,94 @@ void UWorld::Render()
      
     PostProcessing(); 
 
+    SceneVisibility.EndFrame();
+
     //프레임 종료 
     Renderer->EndFrame();
     UIManager.EndFrame();
     Renderer->GetRHIDevice()->Present();
 }
 
-void UWorld::RenderViewports(ACameraActor* Camera, FViewport* Viewport)
+static void CalculateViewportMatrices(ACameraActor* Camera, FViewport* Viewport, FMatrix& OutViewMatrix, FMatrix& OutProjectionMatrix)
 {
     // 뷰포트의 실제 크기로 aspect ratio 계산
-    float ViewportAspectRatio = static_cast<float>(Viewport->GetSizeX()) / static_cast<float>(
-        Viewport->GetSizeY());
-    if (Viewport->GetSizeY() == 0)
+    float ViewportAspectRatio = 1.0f; // 0으로 나누기 방지
+    if (Viewport->GetSizeY() != 0)
     {
-        ViewportAspectRatio = 1.0f;
-    } // 0으로 나누기 방지
+        ViewportAspectRatio = static_cast<float>(Viewport->GetSizeX()) / static_cast<float>(Viewport->GetSizeY());
+    }
 
-    FMatrix ViewMatrix = Camera->GetViewMatrix();
-    FMatrix ProjectionMatrix = Camera->GetProjectionMatrix(ViewportAspectRatio, Viewport);
+    OutViewMatrix = Camera->GetViewMatrix();
+    OutProjectionMatrix = Camera->GetProjectionMatrix(ViewportAspectRatio, Viewport);
+}
+
+void UWorld::ComputeViewVisibility()
+{
+    if (!MultiViewport || !Level)
+    {
+        return;
+    }
+
+    const TArray<AActor*>& LevelActors = Level->GetActors();
+
+    // 워커가 읽는 동안 BVH가 바뀌지 않도록 재빌드/Refit을 메인 스레드에서 먼저 끝냄
+    FlushBVHUpdates();
+    SceneVisibility.BeginFrame(LevelActors);
+
+    auto AddViewportView = [&](SViewportWindow* Window)
+    {
+        if (!Window)
+        {
+            return;
+        }
+
+        FViewport* Viewport = Window->GetViewport();
+        FViewportClient* Client = Window->GetViewportClient();
+        if (!Viewport || !Client)
+        {
+            return;
+        }
+
+        ACameraActor* Camera = Client->PrepareCamera(Viewport);
+        if (!Camera)
+        {
+            return;
+        }
+
+        FMatrix ViewMatrix;
+        FMatrix ProjectionMatrix;
+        CalculateViewportMatrices(Camera, Viewport, ViewMatrix, ProjectionMatrix);
+        SceneVisibility.AddView(Viewport, ViewMatrix, ProjectionMatrix);
+    };
+
+    if (MultiViewport->GetCurrentLayoutMode() == EViewportLayoutMode::FourSplit)
+    {
+        SViewportWindow** Viewports = MultiViewport->GetViewports();
+        for (int i = 0; i < 4; ++i)
+        {
+            AddViewportView(Viewports[i]);
+        }
+    }
+    else
+    {
+        AddViewportView(MultiViewport->GetMainViewport());
+    }
+
+    SceneVisibility.ComputeViews(BVH, LevelActors);
+}
+
+void UWorld::RenderViewports(ACameraActor* Camera, FViewport* Viewport)
+{
+    FMatrix ViewMatrix;
+    FMatrix ProjectionMatrix;
+    CalculateViewportMatrices(Camera, Viewport, ViewMatrix, ProjectionMatrix);
     if (!Renderer)
     {
         return;
     }
    FVector rgb(1.0f, 1.0f, 1.0f);
 
-    FFrustum ViewFrustum;
-    ViewFrustum.Update(ViewMatrix * ProjectionMatrix);
+    const TArray<AActor*>& LevelActors = Level ? Level->GetActors() : TArray<AActor*>();
 
     Renderer->BeginLineBatch();
 
@@ -343,156 +411,132 @@ void UWorld::RenderViewports(ACameraActor* Camera, FViewport* Viewport)
     // ====================================================================
     Renderer->SetViewModeType(ViewModeIndex);
 
-    int AllActorCount = 0;
-    int FrustumCullCount = 0;
     int32 TotalDecalCount = 0;
 
+    // 데칼 목록은 프레임당 한 번만 수집 (뷰포트마다 전체 액터를 훑지 않음)
+    SceneVisibility.EnsureSceneLists(LevelActors);
+
     // ====================================================================
-    // Pass 0: Visible Lights 를 Pruning하는 과정
+    // Pass 0: Visible Lights 를 클러스터(화면 타일 x 깊이 슬라이스)에 배정하는 과정
     // ====================================================================
     {
         TArray<FLightInfo> VisibleFrameLights;
 
         FHeatInfo HeatCB; // 새로 추가: 이 뷰포트용 HeatCB
         D3D11RHI* RHI = static_cast<D3D11RHI*>(Renderer->GetRHIDevice());
-        IDXGISwapChain* SwapChain = RHI->GetSwapChain();
-        DXGI_SWAP_CHAIN_DESC swapDesc;
-        SwapChain->GetDesc(&swapDesc);
-        HeatCB.InvRes = FVector2D(1.0f / swapDesc.BufferDesc.Width, 1.0f / swapDesc.BufferDesc.Height);
+        HeatCB.InvRes = FVector2D(1.0f / RHI->GetBackBufferWidth(), 1.0f / RHI->GetBackBufferHeight());
         HeatCB.FalloffExp = 2.2f;       // 시작값
         HeatCB.DistortionPx = 0.8f;     // 시작값
         HeatCB.EmissiveMul = 0.12f;     // 시작값
         HeatCB.TimeSec =  GetTimeSeconds(); /*엔진 시간 전달*/ 
 
-        const TArray<AActor*>& Actors = Level ? Level->GetActors() : TArray<AActor*>();
+        // 레지스트리 BVH로 이 뷰의 절두체에 닿는 라이트만 수집 (라이트 수 제한 없음, 픽셀마다 자기 클러스터만 계산)
+        FFrustum ViewFrustum;
+        ViewFrustum.Update(ViewMatrix * ProjectionMatrix);
+        LightRegistry.GatherVisibleLights(ViewFrustum, VisibleFrameLights);
 
-        for (AActor* Actor : Actors)
+        for (const FLightInfo& LightInfo : VisibleFrameLights)
         {
-            if (!Actor || Actor->GetActorHiddenInGame()) continue;
-
-            for (UActorComponent* Comp : Actor->GetComponents())
+            // 열 왜곡 스팟은 상수 버퍼 크기만큼만
+            if (HeatCB.NumSpots < static_cast<uint32>(std::size(HeatCB.Spots)))
             {
-                USceneComponent* SceneComp = Cast<USceneComponent>(Comp);
-                if (SceneComp == nullptr) continue;
+                FVector2D OutUV;
+                float OutViewZ = 0.0f;
+                if (!WorldToScreenOutViewZ(LightInfo.LightPos, ViewMatrix, ProjectionMatrix, OutUV, OutViewZ))
+                    continue; // clip.W<=0 혹은 기타 예외
 
-                if (UPointLightComponent* PointLightComp = Cast<UPointLightComponent>(SceneComp))
-                {
-                    FLightInfo LightInfo;
-                    LightInfo.Type = ELighType::Point;
-
-                    LightInfo.LightPos = PointLightComp->GetWorldLocation();
-                    LightInfo.Radius = PointLightComp->GetAttenuationRadius();
-                    LightInfo.RadiusFallOff = PointLightComp->GetFalloff();
-                    LightInfo.Color = PointLightComp->GetLightColor();
-                    LightInfo.Intensity = PointLightComp->GetIntensity();
-                    
-                    if (VisibleFrameLights.size() < 8)
-                    {
-                        VisibleFrameLights.Add(LightInfo); 
-
-                        FVector2D OutUV;
-                        float OutViewZ = 0.0f;
-                        if (!WorldToScreenOutViewZ(LightInfo.LightPos, ViewMatrix, ProjectionMatrix, OutUV, OutViewZ))
-                            continue; // clip.W<=0 혹은 기타 예외
-
-                        // 화면 밖이면 스킵(선택): uv clamp해서 낮은 strength로 처리하는 옵션도 가능
-                        if (OutUV.X < 0.f || OutUV.X > 1.f || OutUV.Y < 0.f || OutUV.Y > 1.f)
-                            continue;
-
-                        float RadiusPx = 0.0f;
-
-                        UCameraComponent* Cam = MainCameraActor->GetCameraComponent();
-                        RadiusPx = WorldRadiusToPixelRadius_Persp(LightInfo.Radius, OutViewZ, Cam->GetFOV() * PI/ 180 , MainViewport->GetHeight());
-
-                        //float RadiusPx = 120.0f;
-                        float Strength = FMath::Clamp(LightInfo.Intensity * 0.5f, 0.0f, 1.0f);
-                        
-                        FHeatSpot Heat{};
-                        Heat.UV = OutUV;
-                        Heat.RadiusPx = RadiusPx;
-                        Heat.Strength = Strength;
-                        Heat.Color = LightInfo.Color;
-                        HeatCB.Spots[HeatCB.NumSpots++] = Heat; 
-                    }
+                // 화면 밖이면 스킵(선택): uv clamp해서 낮은 strength로 처리하는 옵션도 가능
+                if (OutUV.X < 0.f || OutUV.X > 1.f || OutUV.Y < 0.f || OutUV.Y > 1.f)
+                    continue;
 
-                }
-            
+                float RadiusPx = 0.0f;
+
+                UCameraComponent* Cam = MainCameraActor->GetCameraComponent();
+                RadiusPx = WorldRadiusToPixelRadius_Persp(LightInfo.Radius, OutViewZ, Cam->GetFOV() * PI/ 180 , MainViewport->GetHeight());
+
+                //float RadiusPx = 120.0f;
+                float Strength = FMath::Clamp(LightInfo.Intensity * 0.5f, 0.0f, 1.0f);
+                
+                FHeatSpot Heat{};
+                Heat.UV = OutUV;
+                Heat.RadiusPx = RadiusPx;
+                Heat.Strength = Strength;
+                Heat.Color = LightInfo.Color;
+                HeatCB.Spots[HeatCB.NumSpots++] = Heat; 
             }
+
         }
 
         Renderer->SetWorldLights(VisibleFrameLights);
-        Renderer->UpdateLightBuffer();
+        Renderer->UpdateLightBuffer(ViewMatrix, ProjectionMatrix,
+            FVector4(static_cast<float>(Viewport->GetStartX()), static_cast<float>(Viewport->GetStartY()),
+                static_cast<float>(Viewport->GetSizeX()), static_cast<float>(Viewport->GetSizeY())));
         Renderer->UpdateHeatConstantBuffer(HeatCB); //TODO 
     }
 
 
 	Renderer->BeginSceneRendering();
 
-    const TArray<AActor*>& LevelActors = Level ? Level->GetActors() : TArray<AActor*>();
+    // ====================================================================
+    // Visibility: 프레임 시작에 병렬로 계산된 컬링/정렬 결과 사용
+    // - 카메라가 그 사이 바뀌었거나 캐시가 무효화되었으면 여기서 즉시 계산
+    // ====================================================================
+    const FViewVisibility* Visibility = SceneVisibility.FindView(Viewport, ViewMatrix, ProjectionMatrix);
+    if (!Visibility)
+    {
+        FlushBVHUpdates();
+        Visibility = &SceneVisibility.ComputeViewImmediate(Viewport, ViewMatrix, ProjectionMatrix, BVH, LevelActors);
+    }
 
     // ====================================================================
-    // Pass 1: 일반 렌더링 - Depth Buffer 채우기
+    // Pass 1: 일반 렌더링 - Depth Buffer 채우기 (정렬된 프리미티브 목록 순서대로)
     // ====================================================================
-    
-    for (AActor* Actor : LevelActors)
+    if (Viewport->IsShowFlagEnabled(EEngineShowFlags::SF_Primitives))
     {
-        if (!Viewport->IsShowFlagEnabled(EEngineShowFlags::SF_Primitives))
-        {
-            continue;
-        }
-        if (!Actor)
-        {
-            continue;
-        }
-        if (Actor->GetActorHiddenInGame())
+        URenderingStatsCollector::GetInstance().AddFrustumCullStats(Visibility->CulledActorCount, Visibility->CullTimeMs);
+        URenderingStatsCollector::GetInstance().AddOcclusionCullStats(
+            Visibility->OcclusionCulledCount, Visibility->OccluderTriangleCount, Visibility->OcclusionTimeMs);
+
+        const TArray<FVisiblePrimitive>& Primitives = Visibility->Primitives;
+        int32 PrimitiveIndex = 0;
+
+        // 정적 메시(목록 앞부분)는 섹션 단위 커맨드로 기록 → 상태 키로 정렬 → 중복 바인딩 없이 제출
+        FMeshDrawCommandList& MeshDrawCommands = Renderer->GetMeshDrawCommands();
+        MeshDrawCommands.Reset();
+        for (; PrimitiveIndex < Primitives.Num() && Primitives[PrimitiveIndex].Type == EVisiblePrimitiveType::StaticMesh; ++PrimitiveIndex)
         {
-            continue;
+            const FVisiblePrimitive& Item = Primitives[PrimitiveIndex];
+            bool bIsSelected = Item.Owner && Item.Owner->IsSelected();
+            static_cast<UStaticMeshComponent*>(Item.Primitive)->RecordDrawCommands(Renderer, Viewport, MeshDrawCommands, Item.ViewDepth, bIsSelected);
         }
+        Renderer->SubmitMeshDrawCommands(ViewMatrix, ProjectionMatrix, rgb);
 
-        AllActorCount++;
-        for (UActorComponent* Component : Actor->GetComponents())
+        const bool bShowBillboardText = Viewport->IsShowFlagEnabled(EEngineShowFlags::SF_BillboardText);
+        for (; PrimitiveIndex < Primitives.Num(); ++PrimitiveIndex)
         {
-            if (!Component)
+            const FVisiblePrimitive& Item = Primitives[PrimitiveIndex];
+            if (Item.Type == EVisiblePrimitiveType::Text)
             {
-                continue;
-            }
-
-            if (UActorComponent* ActorComp = Cast<UActorComponent>(Component))
-            {
-                if (!ActorComp->IsActive())
+                // 텍스트는 반투명 큐로 (불투명 이후 빌보드/데칼과 함께 뒤→앞으로 그림)
+                if (bShowBillboardText)
                 {
-                    continue;
+                    Renderer->GetTranslucentQueue().AddText(static_cast<UTextRenderComponent*>(Item.Primitive));
                 }
-            }
-
-            if (Cast<UTextRenderComponent>(Component) &&
-                !Viewport->IsShowFlagEnabled(EEngineShowFlags::SF_BillboardText))
-            {
-                continue;
-            }
-
-            // Decal Component는 Editor Visuals만 렌더링
-            if (UDecalComponent* DecalComp = Cast<UDecalComponent>(Component))
-            {
-                DecalComp->RenderEditorVisuals(Renderer, ViewMatrix, ProjectionMatrix);
-                TotalDecalCount++;
                 continue;
             }
 
-            if (UHeightFogComponent* HeightFogComponent = Cast<UHeightFogComponent>(Component))
-            {
-                //HeightFogComponent->Render(Renderer, ViewMatrix, ProjectionMatrix);
-                continue;
-            }
+            // 빌보드 컴포넌트는 여기서 반투명 큐에 스프라이트만 추가
+            bool bIsSelected = Item.Owner && Item.Owner->IsSelected();
+            Renderer->UpdateHighLightConstantBuffer(bIsSelected, rgb, 0, 0, 0, 0);
+            Item.Primitive->Render(Renderer, ViewMatrix, ProjectionMatrix, Viewport);
+        }
 
-            if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
-            {
-                bool bIsSelected = SelectionManager.IsActorSelected(Actor);
-                Renderer->UpdateHighLightConstantBuffer(bIsSelected, rgb, 0, 0, 0, 0);
-                Primitive->Render(Renderer, ViewMatrix, ProjectionMatrix, Viewport);
-            }
+        // Decal Component는 Editor Visuals만 렌더링 (아이콘은 반투명 큐로)
+        for (UDecalComponent* DecalComp : Visibility->Decals)
+        {
+            DecalComp->RenderEditorVisuals(Renderer, ViewMatrix, ProjectionMatrix);
+            TotalDecalCount++;
         }
-        Renderer->OMSetBlendState(false);
     }
 
     // 엔진 액터들 (그리드 등) 렌더링
@@ -501,9 +545,11 @@ void UWorld::RenderViewports(ACameraActor* Camera, FViewport* Viewport)
     URenderingStatsCollector& StatsCollector = URenderingStatsCollector::GetInstance();
 
     // ====================================================================
-    // Pass 2: Decal Projection Pass (Scene Depth 모드가 아닐 때만)
+    // Pass 2: Translucent Pass - 텍스트/빌보드/데칼 투영(Scene Depth 모드가 아닐 때만)을 뒤→앞으로 정렬해 제출
     // ====================================================================
-    if (ViewModeIndex != EViewModeIndex::VMI_SceneDepth)
+    FTranslucentQueue& TranslucentQueue = Renderer->GetTranslucentQueue();
+    const bool bDecalPass = ViewModeIndex != EViewModeIndex::VMI_SceneDepth;
+    if (bDecalPass)
     {
         StatsCollector.BeginDecalPass();
         FDecalRenderingStats& DecalStats = StatsCollector.GetDecalStats();
@@ -513,22 +559,20 @@ void UWorld::RenderViewports(ACameraActor* Camera, FViewport* Viewport)
             Viewport->IsShowFlagEnabled(EEngineShowFlags::SF_Decals) &&
             Viewport->IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes))
         {
-            for (AActor* Actor : LevelActors)
-            {
-                if (!Actor || Actor->GetActorHiddenInGame())
-                {
-                    continue;
-                }
+            // 모든 데칼의 충돌 검사를 한 번에 (변경이 없으면 이전 결과 재사용)
+            DecalStats.CollisionCheckTimeMs = DecalReceiverCache.Update(SceneVisibility.GetDecals(), BVH, LevelActors);
 
-                for (UActorComponent* Component : Actor->GetComponents())
-                {
-                    if (UDecalComponent* DecalComp = Cast<UDecalComponent>(Component))
-                    {
-                        DecalComp->RenderDecalProjection(Renderer, ViewMatrix, ProjectionMatrix);
-                    }
-                }
+            for (UDecalComponent* DecalComp : SceneVisibility.GetDecals())
+            {
+                TranslucentQueue.AddDecal(DecalComp, DecalReceiverCache.GetReceivers(DecalComp));
             }
         }
+    }
+
+    TranslucentQueue.Submit(Renderer, ViewMatrix, ProjectionMatrix);
+
+    if (bDecalPass)
+    {
         StatsCollector.EndDecalPass();
     }
 
@@ -789,6 +833,31 @@ FString UWorld::GenerateUniqueActorName(const FString& ActorType)
     return UniqueName;
 }
 
+int32 UWorld::ReserveActorNameRange(const FString& ActorType, int32 Count)
+{
+    int32& CurrentCount = ObjectTypeCounts[ActorType];
+    const int32 FirstIndex = CurrentCount;
+    CurrentCount += Count;
+    return FirstIndex;
+}
+
+int32 UWorld::FindActorsByName(const FString& Query, TArray<AActor*>& OutActors, const UClass* ClassFilter, int32 MaxResults) const
+{
+    if (!Level)
+    {
+        return 0;
+    }
+    return Level->GetActorSearchIndex().FindByName(Query, OutActors, ClassFilter, MaxResults);
+}
+
+void UWorld::GetActorsOfClass(const UClass* Class, TArray<AActor*>& OutActors, bool bIncludeSubclasses) const
+{
+    if (Level)
+    {
+        Level->GetActorSearchIndex().GetActorsOfClass(Class, OutActors, bIncludeSubclasses);
+    }
+}
+
 //
 // 액터 제거
 //
@@ -813,6 +882,7 @@ bool UWorld::DestroyActor(AActor* Actor)
     if (Level)
     {
         Level->RemoveActor(Actor);
+        LightRegistry.UnregisterActor(Actor);
 
         // 메모리 해제
         ObjectFactory::DeleteObject(Actor);
@@ -864,6 +934,7 @@ void UWorld::CreateNewScene()
     // Safety: clear interactions that may hold stale pointers
     SelectionManager.ClearSelection();
     UIManager.ResetPickedActor();
+    CPickingSystem::InvalidatePickingCache();
     // Level의 Actors 정리
     if (Level)
     {
@@ -871,12 +942,16 @@ void UWorld::CreateNewScene()
         {
             ObjectFactory::DeleteObject(Actor);
         }
-        Level->GetActors().clear();
+        Level->ClearActors();
     }
 
     if (Octree)
     {
         Octree->Release();//새로운 씬이 생기면 Octree를 지워준다.
+        if (Renderer)
+        {
+            Renderer->ClearPersistentLines();
+        }
     }
     if (BVH)
     {
@@ -1638,6 +1713,7 @@ void UWorld::LoadSceneV2(const FString& SceneName)
     {
         AActor* Actor = Pair.second;
         Level->AddActor(Actor);
+        LightRegistry.RegisterActor(Actor);
 
         // StaticMeshActor 전용 포인터 재설정
         if (AStaticMeshActor* StaticMeshActor = Cast<AStaticMeshActor>(Actor))
@@ -1780,6 +1856,7 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* EditorWorld)
                     {
                         PIELevel->AddActor(PIEActor);
                         PIEActor->SetWorld(PIEWorld);
+                        PIEWorld->LightRegistry.RegisterActor(PIEActor);
                     }
                 }
             }
@@ -2171,21 +2248,110 @@ void UWorld::CopySceneToFXAARenderTarget(FViewport* Viewport)
  */
 void UWorld::SpawnActor(AActor* InActor)
 {
+    // 월드에 붙이기 전에 최종 이름을 정함 (붙은 뒤의 SetName은 이름 변경으로 취급)
+    if (UStaticMeshComponent* ActorComp = Cast<UStaticMeshComponent>(InActor->RootComponent))
+    {
+        FString ActorName = GenerateUniqueActorName(
+            GetBaseNameNoExt(ActorComp->GetStaticMesh()->GetAssetPathFileName())
+        );
+        InActor->SetName(ActorName);
+    }
     InActor->SetWorld(this);
 
+    Level->AddActor(InActor);
+    LightRegistry.RegisterActor(InActor);
+
+    // BVH 더티 플래그 설정
+    MarkBVHDirty();
+}
+
+void UWorld::SpawnActors(const TArray<AActor*>& InActors)
+{
+    if (!Level || InActors.IsEmpty())
+    {
+        return;
+    }
 
-        if (UStaticMeshComponent* ActorComp = Cast<UStaticMeshComponent>(InActor->RootComponent))
+    // 1. 메시 이름별 개수를 세어 이름 번호 구간을 타입마다 한 번만 예약
+    TArray<FString> BaseNames;
+    BaseNames.SetNum(InActors.Num());
+    TMap<FString, int32> NameCounts;
+    for (int32 i = 0; i < InActors.Num(); ++i)
+    {
+        UStaticMeshComponent* ActorComp = InActors[i] ? Cast<UStaticMeshComponent>(InActors[i]->RootComponent) : nullptr;
+        if (ActorComp && ActorComp->GetStaticMesh())
         {
-            FString ActorName = GenerateUniqueActorName(
-                GetBaseNameNoExt(ActorComp->GetStaticMesh()->GetAssetPathFileName())
-            );
-            InActor->SetName(ActorName);
+            BaseNames[i] = GetBaseNameNoExt(ActorComp->GetStaticMesh()->GetAssetPathFileName());
+            ++NameCounts[BaseNames[i]];
         }
+    }
 
-    Level->GetActors().Add(InActor);
+    TMap<FString, int32> NextNameIndex;
+    for (const auto& Pair : NameCounts)
+    {
+        NextNameIndex.Add(Pair.first, ReserveActorNameRange(Pair.first, Pair.second));
+    }
 
-    // BVH 더티 플래그 설정
-    MarkBVHDirty();
+    // 2. 이름/월드 설정 후 레벨에 한 번에 추가 (배열은 한 번만 늘림)
+    FString ActorName;
+    for (int32 i = 0; i < InActors.Num(); ++i)
+    {
+        AActor* Actor = InActors[i];
+        if (!Actor)
+        {
+            continue;
+        }
+
+        // 월드에 붙이기 전에 최종 이름을 정함 (붙은 뒤의 SetName은 이름 변경으로 취급)
+        if (!BaseNames[i].empty())
+        {
+            int32& NameIndex = *NextNameIndex.Find(BaseNames[i]);
+            ActorName.assign(BaseNames[i]);
+            ActorName.push_back('_');
+            ActorName.append(std::to_string(NameIndex++));
+            Actor->SetName(ActorName);
+        }
+        Actor->SetWorld(this);
+
+        LightRegistry.RegisterActor(Actor);
+    }
+    Level->AddActors(InActors);
+
+    // 3. BVH: 이미 구축돼 있으면 새 액터만 서브트리로 붙이고, 아니면 다음 쿼리에서 전체 빌드
+    if (BVH)
+    {
+        BVH->InsertActors(InActors);
+    }
+    NotifySceneStructureChanged();
+}
+
+TArray<AActor*> UWorld::DuplicateActors(const TArray<AActor*>& SourceActors, const FVector& LocationOffset)
+{
+    TArray<AActor*> DuplicatedActors;
+    DuplicatedActors.Reserve(SourceActors.Num());
+
+    // 액터 + 루트/충돌 컴포넌트 정도를 미리 확보 (생성자가 만들고 지우는 기본 컴포넌트 포함)
+    ObjectFactory::ReserveObjects(SourceActors.Num() * 4);
+
+    for (AActor* SourceActor : SourceActors)
+    {
+        if (!SourceActor)
+        {
+            continue;
+        }
+
+        AActor* DuplicatedActor = Cast<AActor>(SourceActor->Duplicate());
+        if (!DuplicatedActor)
+        {
+            continue;
+        }
+
+        DuplicatedActor->SetActorLocation(SourceActor->GetActorLocation() + LocationOffset);
+        DuplicatedActors.Add(DuplicatedActor);
+    }
+
+    SpawnActors(DuplicatedActors);
+    return DuplicatedActors;
 }
 
 void UWorld::MarkBVHDirty()
@@ -2194,6 +2360,165 @@ void UWorld::MarkBVHDirty()
     {
         BVH->MarkDirty();
     }
+    NotifySceneStructureChanged();
+}
+
+void UWorld::NotifySceneStructureChanged()
+{
+    SceneVersion = GenerateVersion();
+
+    // 액터 구성이 바뀌었으므로 이번 프레임에 미리 계산한 가시성 목록은 더 이상 안전하지 않음
+    SceneVisibility.Invalidate();
+    DecalReceiverCache.Invalidate();
+}
+
+void UWorld::MarkActorBoundsDirty(AActor* Actor)
+{
+    if (BVH)
+    {
+        BVH->MarkActorBoundsDirty(Actor);
+    }
+
+    // 기즈모는 뷰포트마다 화면 고정 스케일로 바뀌므로 씬 버전에서 제외 (기즈모 호버 캐시는 대상 액터 버전 사용)
+    if (Actor != GizmoActor)
+    {
+        SceneVersion = GenerateVersion();
+    }
+
+    DecalReceiverCache.NotifyActorMoved(Actor);
+    LightRegistry.NotifyActorMoved(Actor);
+}
+
+void UWorld::FlushBVHUpdates()
+{
+    if (!BVH || !Level)
+    {
+        return;
+    }
+
+    if (BVH->IsDirty())
+    {
+        BVH->Build(Level->GetActors());
+    }
+    else if (BVH->HasDirtyBounds())
+    {
+        BVH->RefitDirtyBounds();
+    }
+}
+
+namespace
+{
+    // 겹침 일괄 질의: 질의마다 남은 버퍼에 이어서 기록, 필요한 전체 크기 반환
+    template<typename QueryType, typename FQueryFunc>
+    int32 RunOverlapBatch(std::span<const QueryType> Queries, std::span<AActor*> OutActors, std::span<FSpatialQueryRange> OutRanges, FQueryFunc&& Query)
+    {
+        const size_t NumQueries = std::min(Queries.size(), OutRanges.size());
+        int32 NumWritten = 0;
+        int32 NumRequired = 0;
+        for (size_t i = 0; i < NumQueries; ++i)
+        {
+            std::span<AActor*> Remaining = OutActors.subspan(NumWritten);
+            const int32 NumHits = Query(Queries[i], Remaining);
+            const int32 NumStored = std::min(NumHits, static_cast<int32>(Remaining.size()));
+            OutRanges[i] = { NumWritten, NumStored };
+            NumWritten += NumStored;
+            NumRequired += NumHits;
+        }
+        return NumRequired;
+    }
+
+    // 거리순 일괄 질의: 질의마다 최대 MaxHitsPerQuery개 구간을 잘라 넘김, 기록한 전체 수 반환
+    template<typename QueryType, typename FQueryFunc>
+    int32 RunNearestBatch(std::span<const QueryType> Queries, int32 MaxHitsPerQuery, std::span<FSpatialHit> OutHits, std::span<FSpatialQueryRange> OutRanges, FQueryFunc&& Query)
+    {
+        const size_t NumQueries = std::min(Queries.size(), OutRanges.size());
+        int32 NumWritten = 0;
+        for (size_t i = 0; i < NumQueries; ++i)
+        {
+            std::span<FSpatialHit> Remaining = OutHits.subspan(NumWritten);
+            std::span<FSpatialHit> Slice = Remaining.first(std::min(Remaining.size(), static_cast<size_t>(FMath::Max(MaxHitsPerQuery, 0))));
+            const int32 NumHits = Query(Queries[i], Slice);
+            OutRanges[i] = { NumWritten, NumHits };
+            NumWritten += NumHits;
+        }
+        return NumWritten;
+    }
+}
+
+int32 UWorld::OverlapSphere(const FVector& Center, float Radius, std::span<AActor*> OutActors)
+{
+    FlushBVHUpdates();
+    return BVH ? BVH->OverlapSphere(Center, Radius, OutActors) : 0;
+}
+
+int32 UWorld::OverlapOBB(const FOrientedBox& Box, std::span<AActor*> OutActors)
+{
+    FlushBVHUpdates();
+    return BVH ? BVH->OverlapOBB(Box, OutActors) : 0;
+}
+
+int32 UWorld::SweepSphere(const FVector& Start, const FVector& End, float Radius, std::span<FSpatialHit> OutHits)
+{
+    FlushBVHUpdates();
+    return BVH ? BVH->SweepSphere(Start, End, Radius, OutHits) : 0;
+}
+
+int32 UWorld::FindNearest(const FVector& Point, std::span<FSpatialHit> OutHits, float MaxDistance)
+{
+    FlushBVHUpdates();
+    return BVH ? BVH->FindNearest(Point, OutHits, MaxDistance) : 0;
+}
+
+int32 UWorld::OverlapSphereBatch(std::span<const FSpatialSphere> Queries, std::span<AActor*> OutActors, std::span<FSpatialQueryRange> OutRanges)
+{
+    FlushBVHUpdates();
+    if (!BVH)
+    {
+        return 0;
+    }
+    return RunOverlapBatch(Queries, OutActors, OutRanges, [this](const FSpatialSphere& Sphere, std::span<AActor*> Out)
+    {
+        return BVH->OverlapSphere(Sphere.Center, Sphere.Radius, Out);
+    });
+}
+
+int32 UWorld::OverlapOBBBatch(std::span<const FOrientedBox> Queries, std::span<AActor*> OutActors, std::span<FSpatialQueryRange> OutRanges)
+{
+    FlushBVHUpdates();
+    if (!BVH)
+    {
+        return 0;
+    }
+    return RunOverlapBatch(Queries, OutActors, OutRanges, [this](const FOrientedBox& Box, std::span<AActor*> Out)
+    {
+        return BVH->OverlapOBB(Box, Out);
+    });
+}
+
+int32 UWorld::SweepSphereBatch(std::span<const FSpatialSweep> Queries, int32 MaxHitsPerQuery, std::span<FSpatialHit> OutHits, std::span<FSpatialQueryRange> OutRanges)
+{
+    FlushBVHUpdates();
+    if (!BVH)
+    {
+        return 0;
+    }
+    return RunNearestBatch(Queries, MaxHitsPerQuery, OutHits, OutRanges, [this](const FSpatialSweep& Sweep, std::span<FSpatialHit> Out)
+    {
+        return BVH->SweepSphere(Sweep.Start, Sweep.End, Sweep.Radius, Out);
+    });
+}
+
+int32 UWorld::FindNearestBatch(std::span<const FVector> Points, int32 MaxHitsPerQuery, std::span<FSpatialHit> OutHits, std::span<FSpatialQueryRange> OutRanges, float MaxDistance)
+{
+    FlushBVHUpdates();
+    if (!BVH)
+    {
+        return 0;
+    }
+    return RunNearestBatch(Points, MaxHitsPerQuery, OutHits, OutRanges, [this, MaxDistance](const FVector& Point, std::span<FSpatialHit> Out)
+    {
+        return BVH->FindNearest(Point, Out, MaxDistance);
+    });
 }
 
 void UWorld::UpdateBVHIfNeeded()
@@ -2233,6 +2558,11 @@ void UWorld::UpdateBVHIfNeeded()
     {
         BVH->Build(Level->GetActors()); // Rebuild 대신 Build 사용 (더티 플래그 체크 없이 무조건 빌드)
     }
+    else if (BVH->HasDirtyBounds())
+    {
+        // 이동한 액터만 Refit
+        BVH->RefitDirtyBounds();
+    }
 }
 
 void UWorld::PostProcessing()
@@ -2381,7 +2711,7 @@ void UWorld::RenderBillboards(FViewport* Viewport, ACameraActor* Camera)
     FMatrix ViewMatrix = Camera->GetViewMatrix();
     FMatrix ProjectionMatrix = Camera->GetProjectionMatrix(ViewportAspectRatio, Viewport);
 
-    // 3. Level의 모든 Actor를 순회하며 빌보드 렌더링
+    // 3. Level의 모든 Actor를 순회하며 빌보드 수집
     const TArray<AActor*>& LevelActors = Level->GetActors();
     for (AActor* Actor : LevelActors)
     {
@@ -2422,7 +2752,10 @@ void UWorld::RenderBillboards(FViewport* Viewport, ACameraActor* Camera)
         }
     }
 
-    // 4. 상태 복원
+    // 4. 모은 빌보드를 뒤→앞으로 정렬해 그림
+    Renderer->GetTranslucentQueue().Submit(Renderer, ViewMatrix, ProjectionMatrix);
+
+    // 5. 상태 복원
     // RenderTarget 언바인딩 (다음 렌더링을 위해)
     DeviceContext->OMSetRenderTargets(0, nullptr, nullptr);
 }
@@ -7,6 +7,11 @@
 #include"Engine.h"
 #include"Level.h"
 #include"Frustum.h"
+#include "SceneVisibility.h"
+#include "DecalReceiverCache.h"
+#include "LightRegistry.h"
+#include "SpatialQuery.h"
+#include <span>
 
 // Forward Declarations
 class UResourceManager;
@@ -25,6 +30,7 @@ class SViewportWindow;
 class UOctree;
 class FBVH;
 class ULevel;
+struct FOrientedBox;
 
 class FFrustum;
 /**
@@ -73,6 +79,12 @@ public:
 
 	void SpawnActor(AActor* InActor);
 
+	// 이미 생성한 액터 묶음을 한 번에 등록 (타입별 이름 구간 일괄 예약, BVH는 재빌드 대신 한 번의 증분 삽입)
+	void SpawnActors(const TArray<AActor*>& InActors);
+
+	// 액터들을 복제해 SpawnActors로 한 번에 등록 (붙여넣기/복제용, 위치 오프셋 적용)
+	TArray<AActor*> DuplicateActors(const TArray<AActor*>& SourceActors, const FVector& LocationOffset = FVector(0, 0, 0));
+
 	bool DestroyActor(AActor* Actor);
 
 	void CreateNewScene();
@@ -91,6 +103,9 @@ public:
 	/** Generate unique name for actor based on type */
 	FString GenerateUniqueActorName(const FString& ActorType);
 
+	/** 같은 타입 이름 Count개를 위한 번호 구간을 한 번에 예약 (첫 번호 반환) */
+	int32 ReserveActorNameRange(const FString& ActorType, int32 Count);
+
 	/** === 타임 / 틱 === */
 	virtual void Tick(float DeltaSeconds);
 	float GetTimeSeconds() const;
@@ -100,6 +115,8 @@ public:
 	/** === 렌더 === */
 	void Render();
 	void RenderViewports(ACameraActor* Camera, FViewport* Viewport);
+	// 활성 뷰포트 전체의 가시성을 워커 스레드에서 미리 계산 (드로우 제출 전에 호출)
+	void ComputeViewVisibility();
 	void RenderEngineActors(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix, FViewport* Viewport);
 	//void GameRender(ACameraActor* Camera, FViewport* Viewport);
 
@@ -117,15 +134,45 @@ public:
 	  /** === 필요한 엑터 게터 === */
 	const TArray<AActor*>& GetActors() { return Level ? Level->GetActors() : Actors; }
 	const TArray<AActor*>& GetEngineActors() const { return EngineActors; }
+
+	// 이름(부분 문자열, 대소문자 무시)으로 레벨 액터 검색. ClassFilter가 있으면 그 클래스와 하위 클래스만
+	// MaxResults가 음수면 제한 없음. OutActors에 추가한 개수 반환
+	int32 FindActorsByName(const FString& Query, TArray<AActor*>& OutActors, const UClass* ClassFilter = nullptr, int32 MaxResults = -1) const;
+	// 클래스별 레벨 액터 목록 (전체 액터 순회 없음)
+	void GetActorsOfClass(const UClass* Class, TArray<AActor*>& OutActors, bool bIncludeSubclasses = true) const;
 	AGizmoActor* GetGizmoActor();
 	AGridActor* GetGridActor() { return GridActor; }
 
 	UOctree* GetOctree() { return Octree; }
 	FBVH* GetBVH() { return BVH; }
+	FLightRegistry& GetLightRegistry() { return LightRegistry; }
+	FSceneVisibility& GetSceneVisibility() { return SceneVisibility; }
 
 	// BVH 관리
 	void MarkBVHDirty();
+	void MarkActorBoundsDirty(AActor* Actor);
 	void UpdateBVHIfNeeded();
+	// 쿼리 직전 호출: 구조 변경은 재빌드, 트랜스폼 변경은 Refit
+	void FlushBVHUpdates();
+
+	/** === 공간 질의 (월드 BVH, 액터 AABB 기준, 숨김 액터 제외) === */
+	// 결과는 호출자 버퍼에 기록하며 할당하지 않음. 질의 전에 밀린 BVH 갱신을 반영
+	// 겹침: 전체 결과 수 반환 (버퍼보다 크면 버퍼 크기까지만 기록) / 스윕·최근접: 가까운 순으로 기록한 수 반환
+	int32 OverlapSphere(const FVector& Center, float Radius, std::span<AActor*> OutActors);
+	int32 OverlapOBB(const FOrientedBox& Box, std::span<AActor*> OutActors);
+	int32 SweepSphere(const FVector& Start, const FVector& End, float Radius, std::span<FSpatialHit> OutHits);
+	int32 FindNearest(const FVector& Point, std::span<FSpatialHit> OutHits, float MaxDistance = FLT_MAX);
+
+	// 일괄 질의: BVH 갱신은 한 번만 하고, 질의 i의 결과는 공유 버퍼의 OutRanges[i] 구간 (OutRanges는 질의 수만큼)
+	// 겹침 일괄 질의는 필요한 전체 버퍼 크기를 반환 (OutActors.size()보다 크면 잘린 질의가 있음)
+	int32 OverlapSphereBatch(std::span<const FSpatialSphere> Queries, std::span<AActor*> OutActors, std::span<FSpatialQueryRange> OutRanges);
+	int32 OverlapOBBBatch(std::span<const FOrientedBox> Queries, std::span<AActor*> OutActors, std::span<FSpatialQueryRange> OutRanges);
+	// 거리순 일괄 질의는 질의마다 최대 MaxHitsPerQuery개, 기록한 전체 수 반환
+	int32 SweepSphereBatch(std::span<const FSpatialSweep> Queries, int32 MaxHitsPerQuery, std::span<FSpatialHit> OutHits, std::span<FSpatialQueryRange> OutRanges);
+	int32 FindNearestBatch(std::span<const FVector> Points, int32 MaxHitsPerQuery, std::span<FSpatialHit> OutHits, std::span<FSpatialQueryRange> OutRanges, float MaxDistance = FLT_MAX);
+
+	// 피킹 결과 캐시 무효화용: 액터 구성/숨김/트랜스폼이 바뀔 때마다 전역 카운터에서 새로 발급 (기즈모 제외)
+	uint64 GetSceneVersion() const { return SceneVersion; }
 
 	// BVH 주기적 재빌드 설정
 	void SetBVHRebuildInterval(int32 FrameInterval) { BVHRebuildInterval = FrameInterval; }
@@ -205,6 +252,20 @@ private:
 	UOctree* Octree;
 	FBVH* BVH;
 
+	// 뷰포트별 컬링/정렬 결과 (프레임 단위)
+	FSceneVisibility SceneVisibility;
+
+	// 데칼 → 투영 대상 메시 (뷰포트/프레임 간 재사용)
+	FDecalReceiverCache DecalReceiverCache;
+
+	// 월드에 속한 라이트 컴포넌트 (등록/해제 시점에만 갱신, 뷰마다 BVH로 질의)
+	FLightRegistry LightRegistry;
+
+	uint64 SceneVersion = GenerateVersion();
+
+	// 액터 구성이 바뀌었을 때 씬 버전/가시성/데칼 캐시를 무효화 (BVH 처리는 호출자 몫)
+	void NotifySceneStructureChanged();
+
 	// BVH 주기적 재빌드 관련
 	int32 BVHRebuildInterval = 30; // 0 = 더티 플래그만 사용, N = N프레임마다 재빌드
 	int32 BVHFrameCounter = 0;
@@ -234,6 +295,7 @@ inline T* UWorld::SpawnActor(const FTransform& Transform)
 	{
 		Level->AddActor(NewActor);
 	}
+	LightRegistry.RegisterActor(NewActor);
 
 	// BVH 더티 플래그 설정
 	MarkBVHDirty();